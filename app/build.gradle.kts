@@ -48,6 +48,12 @@ android {
         }
     }
 
+    androidResources {
+        // Grids are memory-mapped straight out of the APK, which requires
+        // them to be stored uncompressed
+        noCompress += listOf("pxgd")
+    }
+
     packagingOptions {
         // Keep debug symbols in release builds
         doNotStrip += "**/**.so"
@@ -2,18 +2,28 @@
 #include <string>
 #include <sstream>
 #include <memory>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <limits>
 #include <android/asset_manager_jni.h>
 
 // Include all our headers
 #include "telemetry/TelemetryEngine.hpp"
 #include "navigation/NavigationEngine.hpp"
+#include "navigation/RouteOptimizer.hpp"
 #include "sensorsim/SensorSim.hpp"
 #include "sensorfusion/EkfAttitude.hpp"
 #include "sensorfusion/MathQuat.hpp"
+#include "sensorfusion/FusionPipeline.hpp"
 #include "geospatial/GeoidModel.hpp"
 #include "geospatial/MagneticModel.hpp"
 #include "geospatial/ElevationLookup.hpp"
+#include "geospatial/TileStore.hpp"
 #include "logparser/LogParser.hpp"
+#include "common/TaskGraph.hpp"
+#include "common/ThreadPool.hpp"
 
 #ifdef PIXHAWKCORE_VERBOSE
 #include <android/log.h>
@@ -31,13 +41,60 @@ static std::unique_ptr<TelemetryEngine> g_telemetryEngine;
 static std::unique_ptr<NavigationEngine> g_navigationEngine;
 static std::unique_ptr<SensorSim> g_sensorSim;
 static std::unique_ptr<EkfAttitude> g_ekfAttitude;
+static std::unique_ptr<FusionPipeline> g_fusionPipeline;
 static std::unique_ptr<GeoidModel> g_geoidModel;
 static std::unique_ptr<MagneticModel> g_magneticModel;
 static std::unique_ptr<ElevationLookup> g_elevationLookup;
+static std::unique_ptr<TileStore> g_tileStore;
 static std::unique_ptr<LogParser> g_logParser;
+static std::unique_ptr<ThreadPool> g_threadPool;
 
 static bool g_systemsInitialized = false;
 
+// Everything but telemetry and log parsing loads in the background, so
+// telemetry can start while models and indexes are still being read. JNI
+// calls into a subsystem fail with a "not ready" error until its task has
+// succeeded.
+struct InitTasks {
+    int geoid = -1;
+    int magnetic = -1;
+    int elevation = -1;
+    int navigation = -1;
+    int fusion = -1;
+    int mapTiles = -1;
+};
+static std::unique_ptr<TaskGraph> g_initGraph;
+static InitTasks g_initTasks;
+static jobject g_assetManagerRef = nullptr;     // keeps the assets alive for the loaders
+static double g_initCallMs = 0.0;
+
+// Escapes a string for use inside a JSON string literal; names, URIs and
+// error text all come from outside
+static std::string jsonEscape(const std::string& value) {
+    static const char HEX[] = "0123456789abcdef";
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (char c : value) {
+        const unsigned char byte = static_cast<unsigned char>(c);
+        switch (c) {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\r': escaped += "\\r"; break;
+            case '\t': escaped += "\\t"; break;
+            default:
+                if (byte < 0x20) {
+                    escaped += "\\u00";
+                    escaped += HEX[byte >> 4];
+                    escaped += HEX[byte & 0x0F];
+                } else {
+                    escaped += c;
+                }
+        }
+    }
+    return escaped;
+}
+
 // Helper function to create JSON responses
 std::string createJsonResponse(bool success, const std::string& data = "", const std::string& error = "") {
     std::ostringstream json;
@@ -48,21 +105,140 @@ std::string createJsonResponse(bool success, const std::string& data = "", const
     }
     
     if (!error.empty()) {
-        json << ",\"error\":\"" << error << "\"";
+        json << ",\"error\":\"" << jsonEscape(error) << "\"";
     }
     
     json << "}";
     return json.str();
 }
 
+// Batch queries over Java double[] arrays. The inputs are copied out once
+// and the results written back once, so the worker threads never touch JNI.
+template <typename Query>
+static jboolean runArrayBatch(JNIEnv* env, jdoubleArray lat, jdoubleArray lon, jdoubleArray out, Query query) {
+    if (!lat || !lon || !out) return JNI_FALSE;
+    const jsize count = env->GetArrayLength(lat);
+    if (env->GetArrayLength(lon) != count || env->GetArrayLength(out) < count) return JNI_FALSE;
+
+    std::vector<double> latValues(static_cast<size_t>(count));
+    std::vector<double> lonValues(static_cast<size_t>(count));
+    std::vector<double> results(static_cast<size_t>(count));
+    env->GetDoubleArrayRegion(lat, 0, count, latValues.data());
+    env->GetDoubleArrayRegion(lon, 0, count, lonValues.data());
+    query(latValues.data(), lonValues.data(), static_cast<size_t>(count), results.data());
+    env->SetDoubleArrayRegion(out, 0, count, results.data());
+    return JNI_TRUE;
+}
+
+// Batch queries over direct ByteBuffers of native-order doubles, read and
+// written in place without copying
+template <typename Query>
+static jboolean runDirectBatch(JNIEnv* env, jobject lat, jobject lon, jobject out, jint count, Query query) {
+    if (!lat || !lon || !out || count < 0) return JNI_FALSE;
+    const jlong bytes = static_cast<jlong>(count) * static_cast<jlong>(sizeof(double));
+    for (jobject buffer : {lat, lon, out}) {
+        if (!env->GetDirectBufferAddress(buffer) || env->GetDirectBufferCapacity(buffer) < bytes) return JNI_FALSE;
+    }
+
+    query(static_cast<const double*>(env->GetDirectBufferAddress(lat)),
+          static_cast<const double*>(env->GetDirectBufferAddress(lon)),
+          static_cast<size_t>(count),
+          static_cast<double*>(env->GetDirectBufferAddress(out)));
+    return JNI_TRUE;
+}
+
+// Layout of getVehicleState's output. A message type not received yet
+// leaves its timestamp at 0 and its values NaN.
+enum VehicleStateField {
+    VEHICLE_ATTITUDE_TS,
+    VEHICLE_YAW,
+    VEHICLE_PITCH,
+    VEHICLE_ROLL,
+    VEHICLE_GPS_TS,
+    VEHICLE_LAT,
+    VEHICLE_LON,
+    VEHICLE_ALT,
+    VEHICLE_BATTERY_TS,
+    VEHICLE_VOLTAGE,
+    VEHICLE_CURRENT,
+    VEHICLE_REMAINING,
+    VEHICLE_HEARTBEAT_TS,
+    VEHICLE_ARMED,
+    VEHICLE_STATE_FIELDS
+};
+
+static std::string sequenceJson(const SequenceCounts& counts) {
+    std::ostringstream json;
+    json << "\"received\":" << counts.received << ",";
+    json << "\"lost\":" << counts.lost << ",";
+    json << "\"duplicates\":" << counts.duplicates << ",";
+    json << "\"reordered\":" << counts.reordered << ",";
+    json << "\"resyncs\":" << counts.resyncs;
+    return json.str();
+}
+
+static bool isReady(int task) {
+    return g_systemsInitialized && g_initGraph && g_initGraph->isReady(task);
+}
+
+static std::string notReadyResponse(int task) {
+    if (!g_systemsInitialized || !g_initGraph) {
+        return createJsonResponse(false, "", "Systems not initialized");
+    }
+    const std::vector<TaskGraph::TaskStatus> status = g_initGraph->getStatus();
+    if (task < 0 || static_cast<size_t>(task) >= status.size()) {
+        return createJsonResponse(false, "", "Systems not initialized");
+    }
+    // e.g. "geoid running" or "navigation skipped: dependency elevation did not succeed"
+    const TaskGraph::TaskStatus& entry = status[static_cast<size_t>(task)];
+    std::string error = entry.name + " " + TaskGraph::stateName(entry.state);
+    if (!entry.error.empty()) {
+        error += ": " + entry.error;
+    }
+    return createJsonResponse(false, "", error);
+}
+
+static std::string waypointsJson(const std::vector<Waypoint>& waypoints) {
+    std::ostringstream json;
+    json.precision(10);
+    json << "[";
+    for (size_t i = 0; i < waypoints.size(); i++) {
+        if (i > 0) json << ",";
+        json << "[" << waypoints[i].lat << "," << waypoints[i].lon << "," << waypoints[i].alt << "]";
+    }
+    json << "]";
+    return json.str();
+}
+
+static void declinationBatch(const double* lat, const double* lon, size_t count, double* out) {
+    g_magneticModel->getDeclinationBatch(*g_threadPool, lat, lon, nullptr, count, out);
+}
+
+static void geoidSeparationBatch(const double* lat, const double* lon, size_t count, double* out) {
+    g_geoidModel->getGeoidSeparationBatch(*g_threadPool, lat, lon, count, out);
+}
+
 extern "C" {
 
 JNIEXPORT jstring JNICALL
 Java_com_pixhawk_gcslab_SystemBridge_initSystems(JNIEnv *env, jobject /* this */, jobject assetManager) {
     LOGI("Initializing systems");
+    const auto began = std::chrono::steady_clock::now();
     
     try {
-        // Initialize all subsystems
+        // Loaders from a previous call write into the instances about to be
+        // replaced, so they have to finish first
+        if (g_initGraph) {
+            g_initGraph->waitAll();
+        }
+        g_systemsInitialized = false;
+        g_initGraph.reset();
+        
+        // The fusion thread uses the sensor and filter instances, so it has
+        // to be torn down before they are replaced
+        g_fusionPipeline.reset();
+
+        // Construction is cheap; loading happens in the task graph below
         g_telemetryEngine = std::make_unique<TelemetryEngine>();
         g_navigationEngine = std::make_unique<NavigationEngine>();
         g_sensorSim = std::make_unique<SensorSim>();
@@ -70,29 +246,67 @@ Java_com_pixhawk_gcslab_SystemBridge_initSystems(JNIEnv *env, jobject /* this */
         g_geoidModel = std::make_unique<GeoidModel>();
         g_magneticModel = std::make_unique<MagneticModel>();
         g_elevationLookup = std::make_unique<ElevationLookup>();
+        g_tileStore = std::make_unique<TileStore>();
         g_logParser = std::make_unique<LogParser>();
-        
-        // Initialize components that need it
-        if (!g_navigationEngine->initialize()) {
-            return env->NewStringUTF(createJsonResponse(false, "", "Failed to initialize navigation engine").c_str());
+        if (!g_threadPool) {
+            g_threadPool = std::make_unique<ThreadPool>();
         }
         
-        if (!g_geoidModel->initialize()) {
-            return env->NewStringUTF(createJsonResponse(false, "", "Failed to initialize geoid model").c_str());
+        if (g_assetManagerRef) {
+            env->DeleteGlobalRef(g_assetManagerRef);
+            g_assetManagerRef = nullptr;
         }
-        
-        if (!g_magneticModel->initialize()) {
-            return env->NewStringUTF(createJsonResponse(false, "", "Failed to initialize magnetic model").c_str());
+        AAssetManager* assets = nullptr;
+        if (assetManager) {
+            g_assetManagerRef = env->NewGlobalRef(assetManager);
+            assets = AAssetManager_fromJava(env, g_assetManagerRef);
         }
         
-        if (!g_elevationLookup->initialize()) {
-            return env->NewStringUTF(createJsonResponse(false, "", "Failed to initialize elevation lookup").c_str());
-        }
+        g_initGraph = std::make_unique<TaskGraph>(*g_threadPool);
+        TaskGraph& graph = *g_initGraph;
+        
+        // The GCS works within one area, so point queries come from grids
+        // built around it on first use
+        g_initTasks.geoid = graph.add("geoid", [assets]() {
+            if (!g_geoidModel->initialize(assets)) return false;
+            g_geoidModel->setRegionalCache(true);
+            return true;
+        });
+        g_initTasks.magnetic = graph.add("magnetic", []() {
+            if (!g_magneticModel->initialize()) return false;
+            g_magneticModel->setLookupMode(MagneticModel::LookupMode::REGIONAL);
+            return true;
+        });
+        g_initTasks.elevation = graph.add("elevation", []() {
+            return g_elevationLookup->initialize();
+        });
+        g_initTasks.navigation = graph.add("navigation", []() {
+            if (!g_navigationEngine->initialize()) return false;
+            g_navigationEngine->setElevationSource(g_elevationLookup.get());
+            return true;
+        }, {g_initTasks.elevation});
+        g_initTasks.fusion = graph.add("fusion", []() {
+            auto pipeline = std::make_unique<FusionPipeline>(*g_sensorSim, *g_ekfAttitude);
+            if (!pipeline->start()) return false;
+            g_fusionPipeline = std::move(pipeline);
+            return true;
+        });
+        // Offline maps are optional; without chunks every tile lookup misses
+        g_initTasks.mapTiles = graph.add("map_tiles", [assets]() {
+            const size_t chunks = g_tileStore->addChunks(assets, "payload");
+            LOGI("Loaded %zu offline map tile chunks", chunks);
+            return true;
+        });
         
         g_systemsInitialized = true;
-        LOGI("All systems initialized successfully");
+        graph.start();
         
-        return env->NewStringUTF(createJsonResponse(true).c_str());
+        g_initCallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - began).count();
+        LOGI("Systems initialized in %.1f ms, loading in background", g_initCallMs);
+        
+        std::ostringstream dataJson;
+        dataJson << "\"init_ms\":" << g_initCallMs;
+        return env->NewStringUTF(createJsonResponse(true, dataJson.str()).c_str());
         
     } catch (const std::exception& e) {
         LOGE("Exception during initialization: %s", e.what());
@@ -100,6 +314,41 @@ Java_com_pixhawk_gcslab_SystemBridge_initSystems(JNIEnv *env, jobject /* this */
     }
 }
 
+// Per-subsystem state and timings of the background initialization
+JNIEXPORT jstring JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_getInitStatus(JNIEnv *env, jobject /* this */) {
+    if (!g_systemsInitialized || !g_initGraph) {
+        return env->NewStringUTF(createJsonResponse(false, "", "Systems not initialized").c_str());
+    }
+    
+    try {
+        std::ostringstream dataJson;
+        dataJson << "\"init_ms\":" << g_initCallMs << ",";
+        dataJson << "\"elapsed_ms\":" << g_initGraph->getElapsedMs() << ",";
+        dataJson << "\"complete\":" << (g_initGraph->isComplete() ? "true" : "false") << ",";
+        dataJson << "\"subsystems\":[";
+        const std::vector<TaskGraph::TaskStatus> status = g_initGraph->getStatus();
+        for (size_t i = 0; i < status.size(); ++i) {
+            if (i > 0) dataJson << ",";
+            const auto& entry = status[i];
+            dataJson << "{";
+            dataJson << "\"name\":\"" << jsonEscape(entry.name) << "\",";
+            dataJson << "\"state\":\"" << jsonEscape(TaskGraph::stateName(entry.state)) << "\",";
+            dataJson << "\"start_ms\":" << entry.start_ms << ",";
+            dataJson << "\"duration_ms\":" << entry.duration_ms;
+            if (!entry.error.empty()) {
+                dataJson << ",\"error\":\"" << jsonEscape(entry.error) << "\"";
+            }
+            dataJson << "}";
+        }
+        dataJson << "]";
+        
+        return env->NewStringUTF(createJsonResponse(true, dataJson.str()).c_str());
+    } catch (const std::exception& e) {
+        return env->NewStringUTF(createJsonResponse(false, "", std::string("Exception: ") + e.what()).c_str());
+    }
+}
+
 JNIEXPORT jstring JNICALL
 Java_com_pixhawk_gcslab_SystemBridge_startTelemetry(JNIEnv *env, jobject /* this */) {
     LOGI("Starting telemetry");
@@ -165,7 +414,7 @@ Java_com_pixhawk_gcslab_SystemBridge_getTelemetryBatch(JNIEnv *env, jobject /* t
                     dataJson << "HEARTBEAT\",";
                     dataJson << "\"seq\":" << msg.seq << ",";
                     dataJson << "\"ts_ms\":" << msg.timestamp_ms << ",";
-                    dataJson << "\"mode\":\"" << msg.data.mode << "\",";
+                    dataJson << "\"mode\":\"" << jsonEscape(msg.data.mode) << "\",";
                     dataJson << "\"armed\":" << (msg.data.armed ? "true" : "false");
                     break;
                 case MessageType::ATTITUDE:
@@ -194,6 +443,7 @@ Java_com_pixhawk_gcslab_SystemBridge_getTelemetryBatch(JNIEnv *env, jobject /* t
                     break;
             }
             
+            dataJson << ",\"sysid\":" << msg.sysid;
             dataJson << "}";
         }
         
@@ -220,7 +470,59 @@ Java_com_pixhawk_gcslab_SystemBridge_getTelemetryStats(JNIEnv *env, jobject /* t
         dataJson << "\"rate_hz\":" << stats.rate_hz << ",";
         dataJson << "\"avg_altitude\":" << stats.avg_altitude << ",";
         dataJson << "\"avg_batt_v\":" << stats.avg_batt_v << ",";
-        dataJson << "\"message_count\":" << stats.message_count;
+        dataJson << "\"message_count\":" << stats.message_count << ",";
+        
+        // Link quality, per link and per vehicle on each link
+        const int64_t nowUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        std::vector<LinkStats> links;
+        std::vector<LinkSenderStats> senders;
+        g_telemetryEngine->getLinkQuality().getLinkStats(nowUs, links);
+        g_telemetryEngine->getLinkQuality().getSenderStats(nowUs, senders);
+        
+        dataJson << "\"links\":[";
+        for (size_t i = 0; i < links.size(); ++i) {
+            if (i > 0) dataJson << ",";
+            const auto& link = links[i];
+            dataJson << "{";
+            dataJson << "\"link\":" << link.linkId << ",";
+            dataJson << sequenceJson(link.sequence) << ",";
+            dataJson << "\"jitter_ms\":" << link.jitter_ms << ",";
+            dataJson << "\"interval_histogram\":[";
+            for (size_t b = 0; b < LinkStats::HISTOGRAM_BUCKETS; ++b) {
+                if (b > 0) dataJson << ",";
+                dataJson << link.interval_histogram[b];
+            }
+            dataJson << "],";
+            dataJson << "\"rate_hz\":{";
+            dataJson << "\"heartbeat\":" << link.rate_hz[static_cast<int>(MessageType::HEARTBEAT)] << ",";
+            dataJson << "\"attitude\":" << link.rate_hz[static_cast<int>(MessageType::ATTITUDE)] << ",";
+            dataJson << "\"gps\":" << link.rate_hz[static_cast<int>(MessageType::GPS)] << ",";
+            dataJson << "\"battery\":" << link.rate_hz[static_cast<int>(MessageType::BATTERY)];
+            dataJson << "},";
+            dataJson << "\"bytes_per_s\":" << link.bytes_per_s << ",";
+            dataJson << "\"total_messages\":" << link.total_messages << ",";
+            dataJson << "\"total_bytes\":" << link.total_bytes << ",";
+            dataJson << "\"last_arrival_ms\":" << link.last_arrival_ms;
+            dataJson << "}";
+        }
+        dataJson << "],";
+        
+        dataJson << "\"vehicles\":[";
+        for (size_t i = 0; i < senders.size(); ++i) {
+            if (i > 0) dataJson << ",";
+            const auto& sender = senders[i];
+            dataJson << "{";
+            dataJson << "\"link\":" << sender.linkId << ",";
+            dataJson << "\"sysid\":" << sender.sysid << ",";
+            dataJson << "\"compid\":" << sender.compid << ",";
+            dataJson << sequenceJson(sender.sequence) << ",";
+            dataJson << "\"jitter_ms\":" << sender.jitter_ms << ",";
+            dataJson << "\"rate_hz\":" << sender.rate_hz << ",";
+            dataJson << "\"last_arrival_ms\":" << sender.last_arrival_ms;
+            dataJson << "}";
+        }
+        dataJson << "]";
         
         return env->NewStringUTF(createJsonResponse(true, dataJson.str()).c_str());
         
@@ -230,21 +532,323 @@ Java_com_pixhawk_gcslab_SystemBridge_getTelemetryStats(JNIEnv *env, jobject /* t
     }
 }
 
+// Newest attitude, position, battery and heartbeat of one vehicle, written
+// into 'out' (VEHICLE_STATE_FIELDS doubles). Reads the engine's latest-value
+// seqlocks, so it neither locks nor allocates; false if nothing has arrived
+// from the vehicle.
+JNIEXPORT jboolean JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_getVehicleState(JNIEnv *env, jobject /* this */, jint sysid, jdoubleArray out) {
+    if (!g_systemsInitialized || !g_telemetryEngine || !out || env->GetArrayLength(out) < VEHICLE_STATE_FIELDS) {
+        return JNI_FALSE;
+    }
+    
+    double state[VEHICLE_STATE_FIELDS];
+    std::fill(std::begin(state), std::end(state), std::numeric_limits<double>::quiet_NaN());
+    state[VEHICLE_ATTITUDE_TS] = state[VEHICLE_GPS_TS] = state[VEHICLE_BATTERY_TS] = state[VEHICLE_HEARTBEAT_TS] = 0.0;
+    
+    bool received = false;
+    TelemetryMessage msg;
+    if (g_telemetryEngine->getLatest(sysid, MessageType::ATTITUDE, msg)) {
+        state[VEHICLE_ATTITUDE_TS] = static_cast<double>(msg.timestamp_ms);
+        state[VEHICLE_YAW] = msg.data.yaw;
+        state[VEHICLE_PITCH] = msg.data.pitch;
+        state[VEHICLE_ROLL] = msg.data.roll;
+        received = true;
+    }
+    if (g_telemetryEngine->getLatest(sysid, MessageType::GPS, msg)) {
+        state[VEHICLE_GPS_TS] = static_cast<double>(msg.timestamp_ms);
+        state[VEHICLE_LAT] = msg.data.lat;
+        state[VEHICLE_LON] = msg.data.lon;
+        state[VEHICLE_ALT] = msg.data.alt;
+        received = true;
+    }
+    if (g_telemetryEngine->getLatest(sysid, MessageType::BATTERY, msg)) {
+        state[VEHICLE_BATTERY_TS] = static_cast<double>(msg.timestamp_ms);
+        state[VEHICLE_VOLTAGE] = msg.data.voltage;
+        state[VEHICLE_CURRENT] = msg.data.current;
+        state[VEHICLE_REMAINING] = msg.data.remaining;
+        received = true;
+    }
+    if (g_telemetryEngine->getLatest(sysid, MessageType::HEARTBEAT, msg)) {
+        state[VEHICLE_HEARTBEAT_TS] = static_cast<double>(msg.timestamp_ms);
+        state[VEHICLE_ARMED] = msg.data.armed ? 1.0 : 0.0;
+        received = true;
+    }
+    if (!received) {
+        return JNI_FALSE;
+    }
+    
+    env->SetDoubleArrayRegion(out, 0, VEHICLE_STATE_FIELDS, state);
+    return JNI_TRUE;
+}
+
+// Fences checked against every GPS fix; the add calls return the fence id,
+// or 0 if the shape is invalid
+JNIEXPORT jint JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_addGeofencePolygon(JNIEnv *env, jobject /* this */,
+                                                        jdoubleArray lat, jdoubleArray lon, jboolean exclusion) {
+    if (!g_systemsInitialized || !g_telemetryEngine || !lat || !lon) {
+        return 0;
+    }
+    
+    try {
+        const jsize count = env->GetArrayLength(lat);
+        if (env->GetArrayLength(lon) != count) return 0;
+        std::vector<double> latValues(static_cast<size_t>(count));
+        std::vector<double> lonValues(static_cast<size_t>(count));
+        env->GetDoubleArrayRegion(lat, 0, count, latValues.data());
+        env->GetDoubleArrayRegion(lon, 0, count, lonValues.data());
+        const Geofence::Kind kind = exclusion ? Geofence::Kind::EXCLUSION : Geofence::Kind::INCLUSION;
+        return g_telemetryEngine->getGeofence().addPolygon(kind, latValues, lonValues);
+    } catch (const std::exception& e) {
+        LOGE("Adding geofence failed: %s", e.what());
+        return 0;
+    }
+}
+
+JNIEXPORT jint JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_addGeofenceCircle(JNIEnv *env, jobject /* this */,
+                                                       jdouble lat, jdouble lon, jdouble radius, jboolean exclusion) {
+    if (!g_systemsInitialized || !g_telemetryEngine) {
+        return 0;
+    }
+    
+    try {
+        const Geofence::Kind kind = exclusion ? Geofence::Kind::EXCLUSION : Geofence::Kind::INCLUSION;
+        return g_telemetryEngine->getGeofence().addCircle(kind, lat, lon, radius);
+    } catch (const std::exception& e) {
+        LOGE("Adding geofence failed: %s", e.what());
+        return 0;
+    }
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_removeGeofence(JNIEnv *env, jobject /* this */, jint id) {
+    if (!g_systemsInitialized || !g_telemetryEngine) {
+        return JNI_FALSE;
+    }
+    return g_telemetryEngine->getGeofence().remove(id) ? JNI_TRUE : JNI_FALSE;
+}
+
+// Takes up to maxCount queued fence events, oldest first
+JNIEXPORT jstring JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_getGeofenceEvents(JNIEnv *env, jobject /* this */, jint maxCount) {
+    if (!g_systemsInitialized || !g_telemetryEngine) {
+        return env->NewStringUTF(createJsonResponse(false, "", "Systems not initialized").c_str());
+    }
+    
+    try {
+        auto events = g_telemetryEngine->getGeofenceEvents(maxCount);
+        
+        std::ostringstream dataJson;
+        dataJson.precision(10);
+        dataJson << "\"events\":[";
+        for (size_t i = 0; i < events.size(); ++i) {
+            if (i > 0) dataJson << ",";
+            const auto& event = events[i];
+            dataJson << "{";
+            dataJson << "\"fence\":" << event.fenceId << ",";
+            dataJson << "\"sysid\":" << event.sysid << ",";
+            dataJson << "\"entered\":" << (event.entered ? "true" : "false") << ",";
+            dataJson << "\"breach\":" << (event.breach ? "true" : "false") << ",";
+            dataJson << "\"ts_ms\":" << event.timestamp_ms << ",";
+            dataJson << "\"lat\":" << event.lat << ",";
+            dataJson << "\"lon\":" << event.lon << ",";
+            dataJson << "\"alt\":" << event.alt;
+            dataJson << "}";
+        }
+        dataJson << "]";
+        
+        return env->NewStringUTF(createJsonResponse(true, dataJson.str()).c_str());
+    } catch (const std::exception& e) {
+        LOGE("Exception getting geofence events: %s", e.what());
+        return env->NewStringUTF(createJsonResponse(false, "", std::string("Exception: ") + e.what()).c_str());
+    }
+}
+
+// Alert rules compiled once and run as telemetry arrives; see AlertEngine.hpp
+// for the expression syntax. Returns the rule id, or the compile error.
+JNIEXPORT jstring JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_addAlertRule(JNIEnv *env, jobject /* this */, jstring name,
+                                                  jstring condition, jstring clearCondition,
+                                                  jint forMs, jint severity) {
+    if (!g_systemsInitialized || !g_telemetryEngine) {
+        return env->NewStringUTF(createJsonResponse(false, "", "Systems not initialized").c_str());
+    }
+    if (!name || !condition) {
+        return env->NewStringUTF(createJsonResponse(false, "", "Missing name or condition").c_str());
+    }
+    
+    try {
+        auto toString = [env](jstring value) {
+            if (!value) return std::string();
+            const char* chars = env->GetStringUTFChars(value, nullptr);
+            std::string result(chars);
+            env->ReleaseStringUTFChars(value, chars);
+            return result;
+        };
+        
+        AlertEngine::RuleSpec spec;
+        spec.name = toString(name);
+        spec.condition = toString(condition);
+        spec.clearCondition = toString(clearCondition);
+        spec.forMs = forMs;
+        spec.severity = severity;
+        
+        std::string error;
+        const int id = g_telemetryEngine->getAlerts().addRule(spec, error);
+        if (id == 0) {
+            return env->NewStringUTF(createJsonResponse(false, "", error).c_str());
+        }
+        return env->NewStringUTF(createJsonResponse(true, "\"id\":" + std::to_string(id)).c_str());
+    } catch (const std::exception& e) {
+        LOGE("Adding alert rule failed: %s", e.what());
+        return env->NewStringUTF(createJsonResponse(false, "", std::string("Exception: ") + e.what()).c_str());
+    }
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_removeAlertRule(JNIEnv *env, jobject /* this */, jint id) {
+    if (!g_systemsInitialized || !g_telemetryEngine) {
+        return JNI_FALSE;
+    }
+    return g_telemetryEngine->getAlerts().removeRule(id) ? JNI_TRUE : JNI_FALSE;
+}
+
+// Takes up to maxCount queued alert events, oldest first
+JNIEXPORT jstring JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_getAlertEvents(JNIEnv *env, jobject /* this */, jint maxCount) {
+    if (!g_systemsInitialized || !g_telemetryEngine) {
+        return env->NewStringUTF(createJsonResponse(false, "", "Systems not initialized").c_str());
+    }
+    
+    try {
+        auto events = g_telemetryEngine->getAlertEvents(maxCount);
+        
+        std::ostringstream dataJson;
+        dataJson << "\"events\":[";
+        for (size_t i = 0; i < events.size(); ++i) {
+            if (i > 0) dataJson << ",";
+            const auto& event = events[i];
+            dataJson << "{";
+            dataJson << "\"rule\":" << event.ruleId << ",";
+            dataJson << "\"name\":\"" << jsonEscape(event.name) << "\",";
+            dataJson << "\"severity\":" << event.severity << ",";
+            dataJson << "\"sysid\":" << event.sysid << ",";
+            dataJson << "\"raised\":" << (event.raised ? "true" : "false") << ",";
+            dataJson << "\"ts_ms\":" << event.timestamp_ms;
+            dataJson << "}";
+        }
+        dataJson << "]";
+        
+        return env->NewStringUTF(createJsonResponse(true, dataJson.str()).c_str());
+    } catch (const std::exception& e) {
+        LOGE("Exception getting alert events: %s", e.what());
+        return env->NewStringUTF(createJsonResponse(false, "", std::string("Exception: ") + e.what()).c_str());
+    }
+}
+
+// Real telemetry links, e.g. "udp://:14550", "tcp://192.168.4.1:5760" or
+// "serial:/dev/ttyACM0:115200"; see LinkReactor::open. Returns the link id.
+JNIEXPORT jstring JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_openLink(JNIEnv *env, jobject /* this */, jstring uri) {
+    if (!g_systemsInitialized || !g_telemetryEngine) {
+        return env->NewStringUTF(createJsonResponse(false, "", "Systems not initialized").c_str());
+    }
+    if (!uri) {
+        return env->NewStringUTF(createJsonResponse(false, "", "Missing link").c_str());
+    }
+    
+    try {
+        const char* uriChars = env->GetStringUTFChars(uri, nullptr);
+        std::string uriString(uriChars);
+        env->ReleaseStringUTFChars(uri, uriChars);
+        
+        std::string error;
+        const int32_t id = g_telemetryEngine->openLink(uriString, error);
+        if (id == 0) {
+            LOGE("Opening link failed: %s", error.c_str());
+            return env->NewStringUTF(createJsonResponse(false, "", error).c_str());
+        }
+        return env->NewStringUTF(createJsonResponse(true, "\"id\":" + std::to_string(id)).c_str());
+    } catch (const std::exception& e) {
+        LOGE("Exception opening link: %s", e.what());
+        return env->NewStringUTF(createJsonResponse(false, "", std::string("Exception: ") + e.what()).c_str());
+    }
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_closeLink(JNIEnv *env, jobject /* this */, jint id) {
+    if (!g_systemsInitialized || !g_telemetryEngine) {
+        return JNI_FALSE;
+    }
+    return g_telemetryEngine->closeLink(id) ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jstring JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_getLinks(JNIEnv *env, jobject /* this */) {
+    if (!g_systemsInitialized || !g_telemetryEngine) {
+        return env->NewStringUTF(createJsonResponse(false, "", "Systems not initialized").c_str());
+    }
+    
+    try {
+        const auto links = g_telemetryEngine->getLinks();
+        
+        std::ostringstream dataJson;
+        dataJson << "\"links\":[";
+        for (size_t i = 0; i < links.size(); ++i) {
+            if (i > 0) dataJson << ",";
+            const auto& link = links[i];
+            dataJson << "{";
+            dataJson << "\"id\":" << link.id << ",";
+            dataJson << "\"type\":\"" << jsonEscape(LinkReactor::typeName(link.type)) << "\",";
+            dataJson << "\"endpoint\":\"" << jsonEscape(link.endpoint) << "\",";
+            dataJson << "\"parent\":" << link.parentId << ",";
+            dataJson << "\"open\":" << (link.open ? "true" : "false") << ",";
+            if (!link.error.empty()) {
+                dataJson << "\"error\":\"" << jsonEscape(link.error) << "\",";
+            }
+            dataJson << "\"bytes\":" << link.bytes << ",";
+            dataJson << "\"packets\":" << link.packets << ",";
+            dataJson << "\"reads\":" << link.reads;
+            DecoderStats decoder;
+            if (g_telemetryEngine->getDecoderStats(link.id, decoder)) {
+                dataJson << ",\"frames\":" << decoder.frames;
+                dataJson << ",\"decoded\":" << decoder.decoded;
+                dataJson << ",\"crc_errors\":" << decoder.crcErrors;
+                dataJson << ",\"unknown\":" << decoder.unknown;
+                dataJson << ",\"dropped_bytes\":" << decoder.droppedBytes;
+            }
+            dataJson << "}";
+        }
+        dataJson << "]";
+        
+        return env->NewStringUTF(createJsonResponse(true, dataJson.str()).c_str());
+    } catch (const std::exception& e) {
+        LOGE("Exception getting links: %s", e.what());
+        return env->NewStringUTF(createJsonResponse(false, "", std::string("Exception: ") + e.what()).c_str());
+    }
+}
+
 // Additional legacy methods
 JNIEXPORT jstring JNICALL
 Java_com_pixhawk_gcslab_SystemBridge_getAttitude(JNIEnv *env, jobject /* this */) {
-    if (!g_systemsInitialized || !g_ekfAttitude) {
-        return env->NewStringUTF(createJsonResponse(false, "", "Systems not initialized").c_str());
+    if (!isReady(g_initTasks.fusion)) {
+        return env->NewStringUTF(notReadyResponse(g_initTasks.fusion).c_str());
     }
     
     try {
-        double roll, pitch, yaw;
-        g_ekfAttitude->getEulerAngles(roll, pitch, yaw);
+        // Lock-free read of the estimate published by the fusion thread
+        AttitudeSnapshot attitude = g_fusionPipeline->latest();
+        int64_t ageUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count() - attitude.timestamp_us;
         
         std::ostringstream dataJson;
-        dataJson << "\"roll\":" << roll << ",";
-        dataJson << "\"pitch\":" << pitch << ",";
-        dataJson << "\"yaw\":" << yaw;
+        dataJson << "\"roll\":" << attitude.roll << ",";
+        dataJson << "\"pitch\":" << attitude.pitch << ",";
+        dataJson << "\"yaw\":" << attitude.yaw << ",";
+        dataJson << "\"age_us\":" << ageUs << ",";
+        dataJson << "\"samples\":" << attitude.sampleCount;
         
         return env->NewStringUTF(createJsonResponse(true, dataJson.str()).c_str());
     } catch (const std::exception& e) {
@@ -254,8 +858,8 @@ Java_com_pixhawk_gcslab_SystemBridge_getAttitude(JNIEnv *env, jobject /* this */
 
 JNIEXPORT jstring JNICALL
 Java_com_pixhawk_gcslab_SystemBridge_getPath(JNIEnv *env, jobject /* this */) {
-    if (!g_systemsInitialized || !g_navigationEngine) {
-        return env->NewStringUTF(createJsonResponse(false, "", "Systems not initialized").c_str());
+    if (!isReady(g_initTasks.navigation)) {
+        return env->NewStringUTF(notReadyResponse(g_initTasks.navigation).c_str());
     }
     
     try {
@@ -263,9 +867,11 @@ Java_com_pixhawk_gcslab_SystemBridge_getPath(JNIEnv *env, jobject /* this */) {
         g_navigationEngine->getCurrentPosition(lat, lon, alt);
         
         std::ostringstream dataJson;
+        dataJson.precision(10);
         dataJson << "\"lat\":" << lat << ",";
         dataJson << "\"lon\":" << lon << ",";
-        dataJson << "\"alt\":" << alt;
+        dataJson << "\"alt\":" << alt << ",";
+        dataJson << "\"waypoints\":" << waypointsJson(g_navigationEngine->getPath());
         
         return env->NewStringUTF(createJsonResponse(true, dataJson.str()).c_str());
     } catch (const std::exception& e) {
@@ -274,16 +880,128 @@ Java_com_pixhawk_gcslab_SystemBridge_getPath(JNIEnv *env, jobject /* this */) {
 }
 
 JNIEXPORT jstring JNICALL
-Java_com_pixhawk_gcslab_SystemBridge_getDeclination(JNIEnv *env, jobject /* this */, jdouble lat, jdouble lon) {
-    if (!g_systemsInitialized || !g_magneticModel) {
+Java_com_pixhawk_gcslab_SystemBridge_planPath(JNIEnv *env, jobject /* this */,
+                                              jdouble lat, jdouble lon, jdouble alt,
+                                              jdouble targetLat, jdouble targetLon, jdouble targetAlt) {
+    if (!isReady(g_initTasks.navigation)) {
+        return env->NewStringUTF(notReadyResponse(g_initTasks.navigation).c_str());
+    }
+    
+    try {
+        g_navigationEngine->setCurrentPosition(lat, lon, alt);
+        g_navigationEngine->setDestination(targetLat, targetLon, targetAlt);
+        if (!g_navigationEngine->calculatePath()) {
+            return env->NewStringUTF(createJsonResponse(false, "", "No path to destination").c_str());
+        }
+        
+        std::ostringstream dataJson;
+        dataJson.precision(10);
+        dataJson << "\"cost\":" << g_navigationEngine->getPathCost() << ",";
+        dataJson << "\"waypoints\":" << waypointsJson(g_navigationEngine->getPath());
+        
+        return env->NewStringUTF(createJsonResponse(true, dataJson.str()).c_str());
+    } catch (const std::exception& e) {
+        return env->NewStringUTF(createJsonResponse(false, "", std::string("Exception: ") + e.what()).c_str());
+    }
+}
+
+// Blocks the polygon for path planning; returns its id, or 0 if the
+// vertex arrays are invalid
+JNIEXPORT jint JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_addNoFlyZone(JNIEnv *env, jobject /* this */, jdoubleArray lat, jdoubleArray lon) {
+    if (!isReady(g_initTasks.navigation) || !lat || !lon) {
+        return 0;
+    }
+    
+    try {
+        const jsize count = env->GetArrayLength(lat);
+        if (env->GetArrayLength(lon) != count) return 0;
+        std::vector<double> latValues(static_cast<size_t>(count));
+        std::vector<double> lonValues(static_cast<size_t>(count));
+        env->GetDoubleArrayRegion(lat, 0, count, latValues.data());
+        env->GetDoubleArrayRegion(lon, 0, count, lonValues.data());
+        return g_navigationEngine->addNoFlyZone(latValues, lonValues);
+    } catch (const std::exception& e) {
+        LOGE("Adding no-fly zone failed: %s", e.what());
+        return 0;
+    }
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_removeNoFlyZone(JNIEnv *env, jobject /* this */, jint id) {
+    if (!isReady(g_initTasks.navigation)) {
+        return JNI_FALSE;
+    }
+    return g_navigationEngine->removeNoFlyZone(id) ? JNI_TRUE : JNI_FALSE;
+}
+
+// Visiting order for mission waypoints given as parallel arrays, shortest
+// first, with climbWeight meters of cost added per meter of altitude change.
+// An open route starts at the first waypoint; a closed one returns to it.
+JNIEXPORT jstring JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_optimizeRoute(JNIEnv *env, jobject /* this */,
+                                                   jdoubleArray lat, jdoubleArray lon, jdoubleArray alt,
+                                                   jboolean closed, jdouble climbWeight) {
+    if (!g_systemsInitialized || !g_threadPool) {
         return env->NewStringUTF(createJsonResponse(false, "", "Systems not initialized").c_str());
     }
+    if (!lat || !lon || !alt) {
+        return env->NewStringUTF(createJsonResponse(false, "", "Missing waypoint arrays").c_str());
+    }
+    
+    try {
+        const jsize count = env->GetArrayLength(lat);
+        if (env->GetArrayLength(lon) != count || env->GetArrayLength(alt) != count) {
+            return env->NewStringUTF(createJsonResponse(false, "", "Array lengths differ").c_str());
+        }
+        std::vector<double> values(3 * static_cast<size_t>(count));
+        env->GetDoubleArrayRegion(lat, 0, count, values.data());
+        env->GetDoubleArrayRegion(lon, 0, count, values.data() + count);
+        env->GetDoubleArrayRegion(alt, 0, count, values.data() + 2 * count);
+        std::vector<Waypoint> waypoints(static_cast<size_t>(count));
+        for (size_t i = 0; i < waypoints.size(); i++) {
+            waypoints[i] = {values[i], values[waypoints.size() + i], values[2 * waypoints.size() + i]};
+        }
+        
+        RouteOptions options;
+        options.closed = closed == JNI_TRUE;
+        options.climbWeight = climbWeight;
+        RouteResult result;
+        RouteOptimizer optimizer(*g_threadPool);
+        if (!optimizer.optimize(waypoints, options, result)) {
+            return env->NewStringUTF(createJsonResponse(false, "", "Invalid number of waypoints").c_str());
+        }
+        
+        std::ostringstream dataJson;
+        dataJson << "\"cost\":" << result.cost << ",";
+        dataJson << "\"initial_cost\":" << result.initialCost << ",";
+        dataJson << "\"order\":[";
+        for (size_t i = 0; i < result.order.size(); i++) {
+            if (i > 0) dataJson << ",";
+            dataJson << result.order[i];
+        }
+        dataJson << "]";
+        
+        return env->NewStringUTF(createJsonResponse(true, dataJson.str()).c_str());
+    } catch (const std::exception& e) {
+        LOGE("Route optimization failed: %s", e.what());
+        return env->NewStringUTF(createJsonResponse(false, "", std::string("Exception: ") + e.what()).c_str());
+    }
+}
+
+JNIEXPORT jstring JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_getDeclination(JNIEnv *env, jobject /* this */, jdouble lat, jdouble lon) {
+    if (!isReady(g_initTasks.magnetic)) {
+        return env->NewStringUTF(notReadyResponse(g_initTasks.magnetic).c_str());
+    }
     
     try {
         double declination = g_magneticModel->getDeclination(lat, lon);
         
         std::ostringstream dataJson;
-        dataJson << "\"declination\":" << declination;
+        dataJson << "\"declination\":" << declination << ",";
+        dataJson << "\"model_year\":" << g_magneticModel->getDecimalYear() << ",";
+        dataJson << "\"model_date_valid\":" << (g_magneticModel->isDateValid() ? "true" : "false");
         
         return env->NewStringUTF(createJsonResponse(true, dataJson.str()).c_str());
     } catch (const std::exception& e) {
@@ -293,15 +1011,190 @@ Java_com_pixhawk_gcslab_SystemBridge_getDeclination(JNIEnv *env, jobject /* this
 
 JNIEXPORT jstring JNICALL
 Java_com_pixhawk_gcslab_SystemBridge_getGeoidSeparation(JNIEnv *env, jobject /* this */, jdouble lat, jdouble lon) {
-    if (!g_systemsInitialized || !g_geoidModel) {
-        return env->NewStringUTF(createJsonResponse(false, "", "Systems not initialized").c_str());
+    if (!isReady(g_initTasks.geoid)) {
+        return env->NewStringUTF(notReadyResponse(g_initTasks.geoid).c_str());
     }
     
     try {
         double separation = g_geoidModel->getGeoidSeparation(lat, lon);
         
         std::ostringstream dataJson;
-        dataJson << "\"separation\":" << separation;
+        dataJson << "\"separation\":" << separation << ",";
+        dataJson << "\"grid\":" << (g_geoidModel->hasGrid() ? "true" : "false");
+        
+        return env->NewStringUTF(createJsonResponse(true, dataJson.str()).c_str());
+    } catch (const std::exception& e) {
+        return env->NewStringUTF(createJsonResponse(false, "", std::string("Exception: ") + e.what()).c_str());
+    }
+}
+
+// Fill 'out' with the declination (degrees) at each lat/lon pair. Returns
+// false if not initialized or the array lengths do not match.
+JNIEXPORT jboolean JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_getDeclinationBatch(JNIEnv *env, jobject /* this */,
+                                                         jdoubleArray lat, jdoubleArray lon, jdoubleArray out) {
+    if (!isReady(g_initTasks.magnetic)) {
+        return JNI_FALSE;
+    }
+    
+    try {
+        return runArrayBatch(env, lat, lon, out, declinationBatch);
+    } catch (const std::exception& e) {
+        LOGE("Declination batch failed: %s", e.what());
+        return JNI_FALSE;
+    }
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_getDeclinationBatchDirect(JNIEnv *env, jobject /* this */,
+                                                               jobject lat, jobject lon, jobject out, jint count) {
+    if (!isReady(g_initTasks.magnetic)) {
+        return JNI_FALSE;
+    }
+    
+    try {
+        return runDirectBatch(env, lat, lon, out, count, declinationBatch);
+    } catch (const std::exception& e) {
+        LOGE("Declination batch failed: %s", e.what());
+        return JNI_FALSE;
+    }
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_getGeoidSeparationBatch(JNIEnv *env, jobject /* this */,
+                                                             jdoubleArray lat, jdoubleArray lon, jdoubleArray out) {
+    if (!isReady(g_initTasks.geoid)) {
+        return JNI_FALSE;
+    }
+    
+    try {
+        return runArrayBatch(env, lat, lon, out, geoidSeparationBatch);
+    } catch (const std::exception& e) {
+        LOGE("Geoid batch failed: %s", e.what());
+        return JNI_FALSE;
+    }
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_getGeoidSeparationBatchDirect(JNIEnv *env, jobject /* this */,
+                                                                   jobject lat, jobject lon, jobject out, jint count) {
+    if (!isReady(g_initTasks.geoid)) {
+        return JNI_FALSE;
+    }
+    
+    try {
+        return runDirectBatch(env, lat, lon, out, count, geoidSeparationBatch);
+    } catch (const std::exception& e) {
+        LOGE("Geoid batch failed: %s", e.what());
+        return JNI_FALSE;
+    }
+}
+
+JNIEXPORT jstring JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_setTerrainDirectory(JNIEnv *env, jobject /* this */, jstring path) {
+    if (!isReady(g_initTasks.elevation)) {
+        return env->NewStringUTF(notReadyResponse(g_initTasks.elevation).c_str());
+    }
+    
+    try {
+        const char* pathStr = env->GetStringUTFChars(path, nullptr);
+        std::string directory(pathStr);
+        env->ReleaseStringUTFChars(path, pathStr);
+        
+        if (!g_elevationLookup->setTileDirectory(directory)) {
+            return env->NewStringUTF(createJsonResponse(false, "", "Terrain directory not found").c_str());
+        }
+        if (isReady(g_initTasks.navigation)) {
+            g_navigationEngine->invalidateCosts();
+        }
+        return env->NewStringUTF(createJsonResponse(true).c_str());
+    } catch (const std::exception& e) {
+        return env->NewStringUTF(createJsonResponse(false, "", std::string("Exception: ") + e.what()).c_str());
+    }
+}
+
+// Terrain heights along a great-circle path; null if not initialized
+JNIEXPORT jdoubleArray JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_getTerrainProfile(JNIEnv *env, jobject /* this */,
+                                                       jdouble lat0, jdouble lon0,
+                                                       jdouble lat1, jdouble lon1, jint count) {
+    if (!isReady(g_initTasks.elevation) || count <= 0) {
+        return nullptr;
+    }
+    
+    try {
+        std::vector<double> heights = g_elevationLookup->profile(lat0, lon0, lat1, lon1, count);
+        jdoubleArray result = env->NewDoubleArray(count);
+        if (result) {
+            env->SetDoubleArrayRegion(result, 0, count, heights.data());
+        }
+        return result;
+    } catch (const std::exception& e) {
+        LOGE("Terrain profile failed: %s", e.what());
+        return nullptr;
+    }
+}
+
+// Payload of offline map tile (x, y) at the store's zoom; null if the tile
+// is missing or corrupt
+JNIEXPORT jbyteArray JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_getMapTile(JNIEnv *env, jobject /* this */, jint x, jint y) {
+    if (!isReady(g_initTasks.mapTiles)) {
+        return nullptr;
+    }
+    
+    try {
+        std::shared_ptr<const MapTile> tile = g_tileStore->getTile(x, y);
+        if (!tile) {
+            return nullptr;
+        }
+        const jsize size = static_cast<jsize>(tile->data.size());
+        jbyteArray result = env->NewByteArray(size);
+        if (result) {
+            env->SetByteArrayRegion(result, 0, size, reinterpret_cast<const jbyte*>(tile->data.data()));
+        }
+        return result;
+    } catch (const std::exception& e) {
+        LOGE("Map tile lookup failed: %s", e.what());
+        return nullptr;
+    }
+}
+
+// Pages in the tiles overlapping the box ahead of getMapTile calls; returns
+// how many tiles it covers
+JNIEXPORT jint JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_prefetchMapTiles(JNIEnv *env, jobject /* this */,
+                                                      jdouble south, jdouble west,
+                                                      jdouble north, jdouble east) {
+    if (!isReady(g_initTasks.mapTiles)) {
+        return 0;
+    }
+    
+    try {
+        return static_cast<jint>(g_tileStore->prefetch(south, west, north, east));
+    } catch (const std::exception& e) {
+        LOGE("Map tile prefetch failed: %s", e.what());
+        return 0;
+    }
+}
+
+JNIEXPORT jstring JNICALL
+Java_com_pixhawk_gcslab_SystemBridge_getMapTileStats(JNIEnv *env, jobject /* this */) {
+    if (!isReady(g_initTasks.mapTiles)) {
+        return env->NewStringUTF(notReadyResponse(g_initTasks.mapTiles).c_str());
+    }
+    
+    try {
+        TileStore::Stats stats = g_tileStore->getStats();
+        
+        std::ostringstream dataJson;
+        dataJson << "\"zoom\":" << g_tileStore->getZoom() << ",";
+        dataJson << "\"chunks\":" << stats.chunks << ",";
+        dataJson << "\"tiles\":" << stats.tiles << ",";
+        dataJson << "\"cached\":" << stats.cached << ",";
+        dataJson << "\"hits\":" << stats.hits << ",";
+        dataJson << "\"misses\":" << stats.misses << ",";
+        dataJson << "\"corrupt\":" << stats.corrupt;
         
         return env->NewStringUTF(createJsonResponse(true, dataJson.str()).c_str());
     } catch (const std::exception& e) {
@@ -325,7 +1218,7 @@ Java_com_pixhawk_gcslab_SystemBridge_getLogSummary(JNIEnv *env, jobject /* this
             std::string summary = g_logParser->getSummary();
             
             std::ostringstream dataJson;
-            dataJson << "\"summary\":\"" << summary << "\",";
+            dataJson << "\"summary\":\"" << jsonEscape(summary) << "\",";
             dataJson << "\"entry_count\":" << g_logParser->getEntryCount();
             
             return env->NewStringUTF(createJsonResponse(true, dataJson.str()).c_str());
@@ -0,0 +1,99 @@
+#include "Crc32.hpp"
+#include <cstring>
+
+// The build enables the CRC extension for this file only on arm64, so the
+// instructions are emitted here but only run after the runtime check
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#define PIXHAWK_CRC32_ARM 1
+#endif
+
+namespace pixhawk {
+
+namespace {
+
+constexpr uint32_t POLYNOMIAL = 0xEDB88320u;
+
+// table[0] advances the CRC by one byte; table[k] by a byte followed by k
+// zero bytes, so eight lookups consume eight bytes at once
+struct SliceTables {
+    uint32_t table[8][256];
+};
+
+constexpr SliceTables makeTables() {
+    SliceTables t{};
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ ((crc & 1u) ? POLYNOMIAL : 0u);
+        }
+        t.table[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        for (int k = 1; k < 8; k++) {
+            const uint32_t previous = t.table[k - 1][i];
+            t.table[k][i] = (previous >> 8) ^ t.table[0][previous & 0xFFu];
+        }
+    }
+    return t;
+}
+
+constexpr SliceTables TABLES = makeTables();
+
+// Little-endian hosts only, like every Android ABI
+uint32_t crc32Software(uint32_t crc, const uint8_t* p, size_t size) {
+    const auto& t = TABLES.table;
+    crc = ~crc;
+    for (; size >= 8; p += 8, size -= 8) {
+        uint32_t lo, hi;
+        std::memcpy(&lo, p, 4);
+        std::memcpy(&hi, p + 4, 4);
+        lo ^= crc;
+        crc = t[7][lo & 0xFFu] ^ t[6][(lo >> 8) & 0xFFu] ^ t[5][(lo >> 16) & 0xFFu] ^ t[4][lo >> 24] ^
+              t[3][hi & 0xFFu] ^ t[2][(hi >> 8) & 0xFFu] ^ t[1][(hi >> 16) & 0xFFu] ^ t[0][hi >> 24];
+    }
+    for (; size > 0; p++, size--) {
+        crc = t[0][(crc ^ *p) & 0xFFu] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+#ifdef PIXHAWK_CRC32_ARM
+uint32_t crc32Hardware(uint32_t crc, const uint8_t* p, size_t size) {
+    crc = ~crc;
+    for (; size >= 8; p += 8, size -= 8) {
+        uint64_t word;
+        std::memcpy(&word, p, 8);
+        crc = __crc32d(crc, word);
+    }
+    for (; size > 0; p++, size--) {
+        crc = __crc32b(crc, *p);
+    }
+    return ~crc;
+}
+#endif
+
+using Crc32Function = uint32_t (*)(uint32_t, const uint8_t*, size_t);
+
+Crc32Function selectImplementation() {
+#ifdef PIXHAWK_CRC32_ARM
+    if (getauxval(AT_HWCAP) & HWCAP_CRC32) return crc32Hardware;
+#endif
+    return crc32Software;
+}
+
+const Crc32Function implementation = selectImplementation();
+
+} // namespace
+
+uint32_t crc32(uint32_t crc, const void* data, size_t size) {
+    return implementation(crc, static_cast<const uint8_t*>(data), size);
+}
+
+bool crc32Accelerated() {
+    return implementation != crc32Software;
+}
+
+} // namespace pixhawk
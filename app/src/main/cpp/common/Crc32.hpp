@@ -0,0 +1,16 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace pixhawk {
+
+// CRC-32 as computed by zlib (reflected polynomial 0xEDB88320). Start from
+// 0 and pass the previous result as 'crc' to continue over several
+// buffers. Runs on the ARMv8 CRC32 instructions when the CPU has them and
+// on slicing-by-8 tables otherwise.
+uint32_t crc32(uint32_t crc, const void* data, size_t size);
+
+// True if crc32 uses the CRC32 instructions on this CPU
+bool crc32Accelerated();
+
+} // namespace pixhawk
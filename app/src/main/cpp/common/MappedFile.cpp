@@ -0,0 +1,135 @@
+#include "MappedFile.hpp"
+#include <algorithm>
+#include <android/asset_manager.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace pixhawk {
+
+MappedFile::MappedFile() = default;
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        mapping = std::exchange(other.mapping, nullptr);
+        mappingLength = std::exchange(other.mappingLength, 0);
+        bufferedAsset = std::exchange(other.bufferedAsset, nullptr);
+        base = std::exchange(other.base, nullptr);
+        length = std::exchange(other.length, 0);
+    }
+    return *this;
+}
+
+bool MappedFile::openFile(const std::string& path) {
+    close();
+
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+
+    struct stat info;
+    bool ok = fstat(fd, &info) == 0 && info.st_size > 0 &&
+              mapDescriptor(fd, 0, static_cast<size_t>(info.st_size));
+    ::close(fd);
+    return ok;
+}
+
+bool MappedFile::openAsset(AAssetManager* assets, const std::string& name) {
+    close();
+    if (!assets) return false;
+
+    AAsset* asset = AAssetManager_open(assets, name.c_str(), AASSET_MODE_RANDOM);
+    if (!asset) return false;
+
+    // Uncompressed assets expose the APK's descriptor and their offset in it
+    off64_t start = 0;
+    off64_t size = 0;
+    const int fd = AAsset_openFileDescriptor64(asset, &start, &size);
+    if (fd >= 0) {
+        const bool ok = size > 0 && mapDescriptor(fd, start, static_cast<size_t>(size));
+        ::close(fd);
+        AAsset_close(asset);
+        return ok;
+    }
+    AAsset_close(asset);
+
+    // Compressed: the asset manager inflates the whole asset into memory
+    asset = AAssetManager_open(assets, name.c_str(), AASSET_MODE_BUFFER);
+    if (!asset) return false;
+
+    const void* buffer = AAsset_getBuffer(asset);
+    const off64_t bufferSize = AAsset_getLength64(asset);
+    if (!buffer || bufferSize <= 0) {
+        AAsset_close(asset);
+        return false;
+    }
+    bufferedAsset = asset;
+    base = static_cast<const uint8_t*>(buffer);
+    length = static_cast<size_t>(bufferSize);
+    return true;
+}
+
+void MappedFile::close() {
+    if (mapping) {
+        munmap(mapping, mappingLength);
+    }
+    if (bufferedAsset) {
+        AAsset_close(bufferedAsset);
+    }
+    mapping = nullptr;
+    mappingLength = 0;
+    bufferedAsset = nullptr;
+    base = nullptr;
+    length = 0;
+}
+
+void MappedFile::adviseRandomAccess() const {
+    if (mapping) {
+        madvise(mapping, mappingLength, MADV_RANDOM);
+    }
+}
+
+void MappedFile::adviseWillNeed() const {
+    if (mapping) {
+        madvise(mapping, mappingLength, MADV_WILLNEED);
+    }
+}
+
+void MappedFile::adviseWillNeed(size_t offset, size_t size) const {
+    if (!mapping || offset >= length) return;
+    size = std::min(size, length - offset);
+
+    // Widen to whole pages of the mapping
+    const uintptr_t pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const uintptr_t first = reinterpret_cast<uintptr_t>(base + offset) & ~(pageSize - 1);
+    const uintptr_t end = reinterpret_cast<uintptr_t>(base + offset + size);
+    madvise(reinterpret_cast<void*>(first), end - first, MADV_WILLNEED);
+}
+
+bool MappedFile::mapDescriptor(int fd, int64_t offset, size_t size) {
+    // mmap offsets must be page aligned; assets start anywhere in the APK
+    const int64_t pageSize = sysconf(_SC_PAGESIZE);
+    const int64_t alignedOffset = offset - offset % pageSize;
+    const size_t lead = static_cast<size_t>(offset - alignedOffset);
+
+    void* m = mmap(nullptr, size + lead, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(alignedOffset));
+    if (m == MAP_FAILED) return false;
+
+    mapping = m;
+    mappingLength = size + lead;
+    base = static_cast<const uint8_t*>(m) + lead;
+    length = size;
+    return true;
+}
+
+} // namespace pixhawk
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+struct AAssetManager;
+struct AAsset;
+
+namespace pixhawk {
+
+// Read-only memory mapping of a file or an APK asset. Pages are faulted in
+// on first access, so opening costs nothing beyond the mmap call and only
+// the pages actually read count against resident memory.
+//
+// Assets can only be mapped if they are stored uncompressed in the APK
+// (see androidResources.noCompress); compressed assets fall back to the
+// asset manager's in-memory buffer.
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool openFile(const std::string& path);
+    bool openAsset(AAssetManager* assets, const std::string& name);
+    void close();
+
+    // Hint that access will be scattered, so the kernel skips readahead
+    void adviseRandomAccess() const;
+    // Start reading the whole mapping, or bytes [offset, offset + size) of
+    // it, in the background
+    void adviseWillNeed() const;
+    void adviseWillNeed(size_t offset, size_t size) const;
+
+    bool isOpen() const { return base != nullptr; }
+    bool isMapped() const { return mapping != nullptr; }
+    const uint8_t* data() const { return base; }
+    size_t size() const { return length; }
+
+private:
+    void* mapping = nullptr;
+    size_t mappingLength = 0;
+    AAsset* bufferedAsset = nullptr;    // owner of 'base' when not mapped
+    const uint8_t* base = nullptr;
+    size_t length = 0;
+
+    bool mapDescriptor(int fd, int64_t offset, size_t size);
+};
+
+} // namespace pixhawk
@@ -0,0 +1,60 @@
+#pragma once
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace pixhawk {
+
+// Philox4x32-10 counter-based generator (Salmon et al., "Parallel Random
+// Numbers: As Easy as 1, 2, 3"). Each (counter, key) pair maps to four
+// independent 32-bit words, so any element of a random stream can be drawn
+// directly from its index without stepping through the ones before it.
+class Philox4x32 {
+public:
+    using Block = std::array<uint32_t, 4>;
+    using Key = std::array<uint32_t, 2>;
+
+    static constexpr Key makeKey(uint64_t seed) {
+        return Key{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+    }
+
+    static Block generate(Block counter, Key key) {
+        for (int round = 0; round < ROUNDS; round++) {
+            const uint64_t p0 = static_cast<uint64_t>(MUL0) * counter[0];
+            const uint64_t p1 = static_cast<uint64_t>(MUL1) * counter[2];
+            counter = Block{static_cast<uint32_t>(p1 >> 32) ^ counter[1] ^ key[0], static_cast<uint32_t>(p1),
+                            static_cast<uint32_t>(p0 >> 32) ^ counter[3] ^ key[1], static_cast<uint32_t>(p0)};
+            key[0] += WEYL0;
+            key[1] += WEYL1;
+        }
+        return counter;
+    }
+
+    // Uniform in (0, 1), never exactly 0 so it is safe to take the log of
+    static double toUniform(uint32_t bits) {
+        return (static_cast<double>(bits) + 0.5) * (1.0 / 4294967296.0);
+    }
+
+    // Four standard normal deviates from one block (Box-Muller on two pairs)
+    static std::array<double, 4> gaussian(const Block& counter, const Key& key) {
+        const Block bits = generate(counter, key);
+        std::array<double, 4> out;
+        for (int i = 0; i < 2; i++) {
+            const double r = std::sqrt(-2.0 * std::log(toUniform(bits[2 * i])));
+            const double theta = TWO_PI * toUniform(bits[2 * i + 1]);
+            out[2 * i] = r * std::cos(theta);
+            out[2 * i + 1] = r * std::sin(theta);
+        }
+        return out;
+    }
+
+private:
+    static constexpr int ROUNDS = 10;
+    static constexpr uint32_t MUL0 = 0xD2511F53u;
+    static constexpr uint32_t MUL1 = 0xCD9E8D57u;
+    static constexpr uint32_t WEYL0 = 0x9E3779B9u;
+    static constexpr uint32_t WEYL1 = 0xBB67AE85u;
+    static constexpr double TWO_PI = 6.283185307179586;
+};
+
+} // namespace pixhawk
@@ -0,0 +1,395 @@
+#pragma once
+#include <cmath>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define PIXHAWK_SIMD_AVX2 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define PIXHAWK_SIMD_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define PIXHAWK_SIMD_NEON 1
+#endif
+
+namespace pixhawk {
+namespace simd {
+
+// Portable single-precision lane packs. Kernels are written once as templates
+// over a pack type and instantiated with the widest native pack for the bulk
+// of the data and ScalarPack for the remainder, so the same code serves
+// AVX2, SSE2, NEON and plain C++ builds.
+
+// One-lane pack; also the building block for double-precision kernels
+template <typename T>
+struct ScalarPackT {
+    static constexpr int WIDTH = 1;
+    struct Mask { bool m; };
+
+    T v;
+
+    ScalarPackT() = default;
+    ScalarPackT(T value) : v(value) {}
+
+    static ScalarPackT load(const T* p) { return ScalarPackT(*p); }
+    void store(T* p) const { *p = v; }
+
+    friend ScalarPackT operator+(ScalarPackT a, ScalarPackT b) { return a.v + b.v; }
+    friend ScalarPackT operator-(ScalarPackT a, ScalarPackT b) { return a.v - b.v; }
+    friend ScalarPackT operator*(ScalarPackT a, ScalarPackT b) { return a.v * b.v; }
+    friend ScalarPackT operator/(ScalarPackT a, ScalarPackT b) { return a.v / b.v; }
+    friend ScalarPackT operator-(ScalarPackT a) { return -a.v; }
+    friend Mask operator>(ScalarPackT a, ScalarPackT b) { return {a.v > b.v}; }
+    friend Mask operator<(ScalarPackT a, ScalarPackT b) { return {a.v < b.v}; }
+
+    friend ScalarPackT sqrt(ScalarPackT a) { return std::sqrt(a.v); }
+    friend ScalarPackT abs(ScalarPackT a) { return std::fabs(a.v); }
+    friend ScalarPackT min(ScalarPackT a, ScalarPackT b) { return a.v < b.v ? a.v : b.v; }
+    friend ScalarPackT max(ScalarPackT a, ScalarPackT b) { return a.v > b.v ? a.v : b.v; }
+    friend ScalarPackT select(Mask m, ScalarPackT a, ScalarPackT b) { return m.m ? a : b; }
+    friend Mask maskAnd(Mask a, Mask b) { return {a.m && b.m}; }
+};
+
+using ScalarPack = ScalarPackT<float>;
+
+#if defined(PIXHAWK_SIMD_AVX2)
+
+struct NativePack {
+    static constexpr int WIDTH = 8;
+    struct Mask { __m256 m; };
+
+    __m256 v;
+
+    NativePack() = default;
+    NativePack(__m256 value) : v(value) {}
+    NativePack(float value) : v(_mm256_set1_ps(value)) {}
+
+    static NativePack load(const float* p) { return _mm256_loadu_ps(p); }
+    void store(float* p) const { _mm256_storeu_ps(p, v); }
+
+    friend NativePack operator+(NativePack a, NativePack b) { return _mm256_add_ps(a.v, b.v); }
+    friend NativePack operator-(NativePack a, NativePack b) { return _mm256_sub_ps(a.v, b.v); }
+    friend NativePack operator*(NativePack a, NativePack b) { return _mm256_mul_ps(a.v, b.v); }
+    friend NativePack operator/(NativePack a, NativePack b) { return _mm256_div_ps(a.v, b.v); }
+    friend NativePack operator-(NativePack a) { return _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)); }
+    friend Mask operator>(NativePack a, NativePack b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)}; }
+    friend Mask operator<(NativePack a, NativePack b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)}; }
+
+    friend NativePack sqrt(NativePack a) { return _mm256_sqrt_ps(a.v); }
+    friend NativePack abs(NativePack a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v); }
+    friend NativePack min(NativePack a, NativePack b) { return _mm256_min_ps(a.v, b.v); }
+    friend NativePack max(NativePack a, NativePack b) { return _mm256_max_ps(a.v, b.v); }
+    friend NativePack select(Mask m, NativePack a, NativePack b) { return _mm256_blendv_ps(b.v, a.v, m.m); }
+    friend Mask maskAnd(Mask a, Mask b) { return {_mm256_and_ps(a.m, b.m)}; }
+};
+
+#elif defined(PIXHAWK_SIMD_SSE2)
+
+struct NativePack {
+    static constexpr int WIDTH = 4;
+    struct Mask { __m128 m; };
+
+    __m128 v;
+
+    NativePack() = default;
+    NativePack(__m128 value) : v(value) {}
+    NativePack(float value) : v(_mm_set1_ps(value)) {}
+
+    static NativePack load(const float* p) { return _mm_loadu_ps(p); }
+    void store(float* p) const { _mm_storeu_ps(p, v); }
+
+    friend NativePack operator+(NativePack a, NativePack b) { return _mm_add_ps(a.v, b.v); }
+    friend NativePack operator-(NativePack a, NativePack b) { return _mm_sub_ps(a.v, b.v); }
+    friend NativePack operator*(NativePack a, NativePack b) { return _mm_mul_ps(a.v, b.v); }
+    friend NativePack operator/(NativePack a, NativePack b) { return _mm_div_ps(a.v, b.v); }
+    friend NativePack operator-(NativePack a) { return _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)); }
+    friend Mask operator>(NativePack a, NativePack b) { return {_mm_cmpgt_ps(a.v, b.v)}; }
+    friend Mask operator<(NativePack a, NativePack b) { return {_mm_cmplt_ps(a.v, b.v)}; }
+
+    friend NativePack sqrt(NativePack a) { return _mm_sqrt_ps(a.v); }
+    friend NativePack abs(NativePack a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v); }
+    friend NativePack min(NativePack a, NativePack b) { return _mm_min_ps(a.v, b.v); }
+    friend NativePack max(NativePack a, NativePack b) { return _mm_max_ps(a.v, b.v); }
+    friend NativePack select(Mask m, NativePack a, NativePack b) {
+        return _mm_or_ps(_mm_and_ps(m.m, a.v), _mm_andnot_ps(m.m, b.v));
+    }
+    friend Mask maskAnd(Mask a, Mask b) { return {_mm_and_ps(a.m, b.m)}; }
+};
+
+#elif defined(PIXHAWK_SIMD_NEON)
+
+struct NativePack {
+    static constexpr int WIDTH = 4;
+    struct Mask { uint32x4_t m; };
+
+    float32x4_t v;
+
+    NativePack() = default;
+    NativePack(float32x4_t value) : v(value) {}
+    NativePack(float value) : v(vdupq_n_f32(value)) {}
+
+    static NativePack load(const float* p) { return vld1q_f32(p); }
+    void store(float* p) const { vst1q_f32(p, v); }
+
+    friend NativePack operator+(NativePack a, NativePack b) { return vaddq_f32(a.v, b.v); }
+    friend NativePack operator-(NativePack a, NativePack b) { return vsubq_f32(a.v, b.v); }
+    friend NativePack operator*(NativePack a, NativePack b) { return vmulq_f32(a.v, b.v); }
+    friend NativePack operator-(NativePack a) { return vnegq_f32(a.v); }
+    friend Mask operator>(NativePack a, NativePack b) { return {vcgtq_f32(a.v, b.v)}; }
+    friend Mask operator<(NativePack a, NativePack b) { return {vcltq_f32(a.v, b.v)}; }
+
+#if defined(__aarch64__)
+    friend NativePack operator/(NativePack a, NativePack b) { return vdivq_f32(a.v, b.v); }
+    friend NativePack sqrt(NativePack a) { return vsqrtq_f32(a.v); }
+#else
+    // ARMv7 NEON has no divide or square root; refine the hardware estimates
+    // with two Newton-Raphson steps each (~1 ulp in the normal range)
+    friend NativePack operator/(NativePack a, NativePack b) {
+        float32x4_t r = vrecpeq_f32(b.v);
+        r = vmulq_f32(r, vrecpsq_f32(b.v, r));
+        r = vmulq_f32(r, vrecpsq_f32(b.v, r));
+        return vmulq_f32(a.v, r);
+    }
+    friend NativePack sqrt(NativePack a) {
+        float32x4_t r = vrsqrteq_f32(a.v);
+        r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(a.v, r), r));
+        r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(a.v, r), r));
+        uint32x4_t positive = vcgtq_f32(a.v, vdupq_n_f32(0.0f));
+        return vbslq_f32(positive, vmulq_f32(a.v, r), vdupq_n_f32(0.0f));
+    }
+#endif
+
+    friend NativePack abs(NativePack a) { return vabsq_f32(a.v); }
+    friend NativePack min(NativePack a, NativePack b) { return vminq_f32(a.v, b.v); }
+    friend NativePack max(NativePack a, NativePack b) { return vmaxq_f32(a.v, b.v); }
+    friend NativePack select(Mask m, NativePack a, NativePack b) { return vbslq_f32(m.m, a.v, b.v); }
+    friend Mask maskAnd(Mask a, Mask b) { return {vandq_u32(a.m, b.m)}; }
+};
+
+#else
+
+using NativePack = ScalarPack;
+
+#endif
+
+// Double-precision lane packs, for kernels where float is too coarse (ECEF
+// coordinates need ~1e-9 relative precision). ARMv7 NEON has no double
+// lanes, so it falls back to ScalarPackT<double> like plain C++ builds.
+#if defined(PIXHAWK_SIMD_AVX2)
+
+struct NativePackD {
+    static constexpr int WIDTH = 4;
+    struct Mask { __m256d m; };
+
+    __m256d v;
+
+    NativePackD() = default;
+    NativePackD(__m256d value) : v(value) {}
+    NativePackD(double value) : v(_mm256_set1_pd(value)) {}
+
+    static NativePackD load(const double* p) { return _mm256_loadu_pd(p); }
+    void store(double* p) const { _mm256_storeu_pd(p, v); }
+
+    friend NativePackD operator+(NativePackD a, NativePackD b) { return _mm256_add_pd(a.v, b.v); }
+    friend NativePackD operator-(NativePackD a, NativePackD b) { return _mm256_sub_pd(a.v, b.v); }
+    friend NativePackD operator*(NativePackD a, NativePackD b) { return _mm256_mul_pd(a.v, b.v); }
+    friend NativePackD operator/(NativePackD a, NativePackD b) { return _mm256_div_pd(a.v, b.v); }
+    friend NativePackD operator-(NativePackD a) { return _mm256_xor_pd(a.v, _mm256_set1_pd(-0.0)); }
+    friend Mask operator>(NativePackD a, NativePackD b) { return {_mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ)}; }
+    friend Mask operator<(NativePackD a, NativePackD b) { return {_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)}; }
+
+    friend NativePackD sqrt(NativePackD a) { return _mm256_sqrt_pd(a.v); }
+    friend NativePackD abs(NativePackD a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v); }
+    friend NativePackD min(NativePackD a, NativePackD b) { return _mm256_min_pd(a.v, b.v); }
+    friend NativePackD max(NativePackD a, NativePackD b) { return _mm256_max_pd(a.v, b.v); }
+    friend NativePackD select(Mask m, NativePackD a, NativePackD b) { return _mm256_blendv_pd(b.v, a.v, m.m); }
+    friend Mask maskAnd(Mask a, Mask b) { return {_mm256_and_pd(a.m, b.m)}; }
+};
+
+#elif defined(PIXHAWK_SIMD_SSE2)
+
+struct NativePackD {
+    static constexpr int WIDTH = 2;
+    struct Mask { __m128d m; };
+
+    __m128d v;
+
+    NativePackD() = default;
+    NativePackD(__m128d value) : v(value) {}
+    NativePackD(double value) : v(_mm_set1_pd(value)) {}
+
+    static NativePackD load(const double* p) { return _mm_loadu_pd(p); }
+    void store(double* p) const { _mm_storeu_pd(p, v); }
+
+    friend NativePackD operator+(NativePackD a, NativePackD b) { return _mm_add_pd(a.v, b.v); }
+    friend NativePackD operator-(NativePackD a, NativePackD b) { return _mm_sub_pd(a.v, b.v); }
+    friend NativePackD operator*(NativePackD a, NativePackD b) { return _mm_mul_pd(a.v, b.v); }
+    friend NativePackD operator/(NativePackD a, NativePackD b) { return _mm_div_pd(a.v, b.v); }
+    friend NativePackD operator-(NativePackD a) { return _mm_xor_pd(a.v, _mm_set1_pd(-0.0)); }
+    friend Mask operator>(NativePackD a, NativePackD b) { return {_mm_cmpgt_pd(a.v, b.v)}; }
+    friend Mask operator<(NativePackD a, NativePackD b) { return {_mm_cmplt_pd(a.v, b.v)}; }
+
+    friend NativePackD sqrt(NativePackD a) { return _mm_sqrt_pd(a.v); }
+    friend NativePackD abs(NativePackD a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a.v); }
+    friend NativePackD min(NativePackD a, NativePackD b) { return _mm_min_pd(a.v, b.v); }
+    friend NativePackD max(NativePackD a, NativePackD b) { return _mm_max_pd(a.v, b.v); }
+    friend NativePackD select(Mask m, NativePackD a, NativePackD b) {
+        return _mm_or_pd(_mm_and_pd(m.m, a.v), _mm_andnot_pd(m.m, b.v));
+    }
+    friend Mask maskAnd(Mask a, Mask b) { return {_mm_and_pd(a.m, b.m)}; }
+};
+
+#elif defined(PIXHAWK_SIMD_NEON) && defined(__aarch64__)
+
+struct NativePackD {
+    static constexpr int WIDTH = 2;
+    struct Mask { uint64x2_t m; };
+
+    float64x2_t v;
+
+    NativePackD() = default;
+    NativePackD(float64x2_t value) : v(value) {}
+    NativePackD(double value) : v(vdupq_n_f64(value)) {}
+
+    static NativePackD load(const double* p) { return vld1q_f64(p); }
+    void store(double* p) const { vst1q_f64(p, v); }
+
+    friend NativePackD operator+(NativePackD a, NativePackD b) { return vaddq_f64(a.v, b.v); }
+    friend NativePackD operator-(NativePackD a, NativePackD b) { return vsubq_f64(a.v, b.v); }
+    friend NativePackD operator*(NativePackD a, NativePackD b) { return vmulq_f64(a.v, b.v); }
+    friend NativePackD operator/(NativePackD a, NativePackD b) { return vdivq_f64(a.v, b.v); }
+    friend NativePackD operator-(NativePackD a) { return vnegq_f64(a.v); }
+    friend Mask operator>(NativePackD a, NativePackD b) { return {vcgtq_f64(a.v, b.v)}; }
+    friend Mask operator<(NativePackD a, NativePackD b) { return {vcltq_f64(a.v, b.v)}; }
+
+    friend NativePackD sqrt(NativePackD a) { return vsqrtq_f64(a.v); }
+    friend NativePackD abs(NativePackD a) { return vabsq_f64(a.v); }
+    friend NativePackD min(NativePackD a, NativePackD b) { return vminq_f64(a.v, b.v); }
+    friend NativePackD max(NativePackD a, NativePackD b) { return vmaxq_f64(a.v, b.v); }
+    friend NativePackD select(Mask m, NativePackD a, NativePackD b) { return vbslq_f64(m.m, a.v, b.v); }
+    friend Mask maskAnd(Mask a, Mask b) { return {vandq_u64(a.m, b.m)}; }
+};
+
+#else
+
+using NativePackD = ScalarPackT<double>;
+
+#endif
+
+// Four-quadrant arctangent built from pack primitives. Max error ~1e-5 rad,
+// so double-precision lanes go through the libm versions below instead.
+template <typename P>
+inline P atan2(P y, P x) {
+    const P ax = abs(x);
+    const P ay = abs(y);
+    const P hi = max(ax, ay);
+    const P lo = min(ax, ay);
+    const P t = lo / max(hi, P(1e-30f));
+    const P t2 = t * t;
+
+    P r = P(-0.01172120f);
+    r = r * t2 + P(0.05265332f);
+    r = r * t2 + P(-0.11643287f);
+    r = r * t2 + P(0.19354346f);
+    r = r * t2 + P(-0.33262347f);
+    r = r * t2 + P(0.99997726f);
+    r = r * t;
+
+    r = select(ay > ax, P(1.57079633f) - r, r);
+    r = select(x < P(0.0f), P(3.14159265f) - r, r);
+    return select(y < P(0.0f), -r, r);
+}
+
+// Arcsine with the input clamped to [-1, 1]
+template <typename P>
+inline P asin(P s) {
+    s = min(max(s, P(-1.0f)), P(1.0f));
+    return atan2(s, sqrt(P(1.0f) - s * s));
+}
+
+inline ScalarPackT<double> atan2(ScalarPackT<double> y, ScalarPackT<double> x) {
+    return std::atan2(y.v, x.v);
+}
+
+inline ScalarPackT<double> asin(ScalarPackT<double> s) {
+    return std::asin(s.v < -1.0 ? -1.0 : (s.v > 1.0 ? 1.0 : s.v));
+}
+
+// Double-precision sine/cosine and arctangent built from pack primitives, for
+// NativePackD and ScalarPackT<double>. Cephes minimax polynomials, within a
+// few ulp of libm for |x| < 1e6 rad, so batch and per-point callers can share
+// one kernel and get identical results.
+
+// Nearest integer for |x| < 2^51, by pushing the fraction out of the mantissa
+template <typename P>
+inline P roundNearest(P x) {
+    const P shift(6755399441055744.0);     // 1.5 * 2^52
+    return (x + shift) - shift;
+}
+
+template <typename P>
+inline void preciseSinCos(P x, P& sinOut, P& cosOut) {
+    // x = q * pi/2 + r with |r| <= pi/4; pi/2 split in three parts so q * part is exact
+    const P q = roundNearest(x * P(0.63661977236758134308));
+    const P r = ((x - q * P(1.57079625129699707031)) - q * P(7.54978941586159635335e-8)) -
+                q * P(5.39030285815811905290e-15);
+    const P z = r * r;
+
+    P ps = P(1.58962301576546568060e-10);
+    ps = ps * z + P(-2.50507477628578072866e-8);
+    ps = ps * z + P(2.75573136213857245213e-6);
+    ps = ps * z + P(-1.98412698295895385996e-4);
+    ps = ps * z + P(8.33333333332211858878e-3);
+    ps = ps * z + P(-1.66666666666666307295e-1);
+    const P sinR = r + r * z * ps;
+
+    P pc = P(-1.13585365213876817300e-11);
+    pc = pc * z + P(2.08757008419747316778e-9);
+    pc = pc * z + P(-2.75573141792967388112e-7);
+    pc = pc * z + P(2.48015872888517045348e-5);
+    pc = pc * z + P(-1.38888888888730564116e-3);
+    pc = pc * z + P(4.16666666666665929218e-2);
+    const P cosR = P(1.0) - P(0.5) * z + z * z * pc;
+
+    // Quadrant q mod 4: odd quadrants swap sine and cosine, and the signs
+    // follow the quadrant
+    const P quadrant = q - P(4.0) * roundNearest(q * P(0.25) - P(0.375));
+    const P odd = quadrant - P(2.0) * roundNearest(quadrant * P(0.5) - P(0.25));
+    const auto swap = odd > P(0.5);
+    const P s = select(swap, cosR, sinR);
+    const P c = select(swap, sinR, cosR);
+    sinOut = select(quadrant > P(1.5), -s, s);
+    cosOut = select(maskAnd(quadrant > P(0.5), quadrant < P(2.5)), -c, c);
+}
+
+template <typename P>
+inline P preciseAtan2(P y, P x) {
+    const P ax = abs(x);
+    const P ay = abs(y);
+    P t = min(ax, ay) / max(max(ax, ay), P(1e-300));
+
+    // atan(t) = pi/4 + atan((t - 1) / (t + 1)) keeps the rational fit in range
+    const auto reduce = t > P(0.66);
+    const P base = select(reduce, P(0.78539816339744830962) + P(3.061616997868382943065e-17), P(0.0));
+    t = select(reduce, (t - P(1.0)) / (t + P(1.0)), t);
+    const P z = t * t;
+
+    P num = P(-8.750608600031904122785e-1);
+    num = num * z + P(-1.615753718733365076637e1);
+    num = num * z + P(-7.500855792314704667340e1);
+    num = num * z + P(-1.228866684490136173410e2);
+    num = num * z + P(-6.485021904942025371773e1);
+    P den = z + P(2.485846490142306297962e1);
+    den = den * z + P(1.650270098316988542046e2);
+    den = den * z + P(4.328810604912902668951e2);
+    den = den * z + P(4.853903996359136964868e2);
+    den = den * z + P(1.945506571482613964425e2);
+    P r = base + (t + t * z * num / den);
+
+    r = select(ay > ax, P(1.57079632679489661923) - r, r);
+    r = select(x < P(0.0), P(3.14159265358979323846) - r, r);
+    return select(y < P(0.0), -r, r);
+}
+
+} // namespace simd
+} // namespace pixhawk
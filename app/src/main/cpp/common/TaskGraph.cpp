@@ -0,0 +1,190 @@
+#include "TaskGraph.hpp"
+
+namespace pixhawk {
+
+namespace {
+
+double millisecondsBetween(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+bool isFinished(TaskGraph::State state) {
+    return state == TaskGraph::State::READY || state == TaskGraph::State::FAILED ||
+           state == TaskGraph::State::SKIPPED;
+}
+
+} // namespace
+
+TaskGraph::TaskGraph(ThreadPool& pool) : pool(pool) {}
+
+TaskGraph::~TaskGraph() {
+    waitAll();
+}
+
+int TaskGraph::add(const std::string& name, std::function<bool()> task, const std::vector<int>& dependencies) {
+    if (running) return -1;
+
+    const int id = static_cast<int>(nodes.size());
+    auto node = std::make_unique<Node>();
+    node->name = name;
+    node->task = std::move(task);
+    size_t remaining = 0;
+    for (int dependency : dependencies) {
+        if (dependency < 0 || dependency >= id) continue;
+        nodes[static_cast<size_t>(dependency)]->dependents.push_back(id);
+        remaining++;
+    }
+    node->remaining.store(remaining, std::memory_order_relaxed);
+    nodes.push_back(std::move(node));
+    return id;
+}
+
+void TaskGraph::start() {
+    std::vector<int> roots;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (running) return;
+        running = true;
+        started = Clock::now();
+        lastEnded = started;
+        // Collected before any task runs, since finishing tasks release
+        // their dependents concurrently
+        for (size_t i = 0; i < nodes.size(); i++) {
+            if (nodes[i]->remaining.load(std::memory_order_relaxed) == 0) {
+                roots.push_back(static_cast<int>(i));
+            }
+        }
+        active += roots.size();
+    }
+    for (int id : roots) {
+        pool.submit([this, id]() { run(id); });
+    }
+}
+
+TaskGraph::State TaskGraph::getState(int id) const {
+    if (id < 0 || static_cast<size_t>(id) >= nodes.size()) return State::FAILED;
+    return nodes[static_cast<size_t>(id)]->state.load(std::memory_order_acquire);
+}
+
+bool TaskGraph::isComplete() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return running && finishedCount == nodes.size();
+}
+
+bool TaskGraph::wait(int id) const {
+    if (id < 0 || static_cast<size_t>(id) >= nodes.size()) return false;
+    const Node& node = *nodes[static_cast<size_t>(id)];
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!running) return false;
+    finished.wait(lock, [&node]() { return isFinished(node.state.load(std::memory_order_relaxed)); });
+    return node.state.load(std::memory_order_relaxed) == State::READY;
+}
+
+void TaskGraph::waitAll() const {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!running) return;
+    finished.wait(lock, [this]() { return finishedCount == nodes.size() && active == 0; });
+}
+
+std::vector<TaskGraph::TaskStatus> TaskGraph::getStatus() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    const Clock::time_point now = Clock::now();
+    std::vector<TaskStatus> status;
+    status.reserve(nodes.size());
+    for (const auto& node : nodes) {
+        const State state = node->state.load(std::memory_order_relaxed);
+        TaskStatus entry{node->name, state, 0.0, 0.0, node->error};
+        if (state == State::RUNNING || state == State::READY || state == State::FAILED) {
+            entry.start_ms = millisecondsBetween(started, node->began);
+            entry.duration_ms = millisecondsBetween(node->began, state == State::RUNNING ? now : node->ended);
+        }
+        status.push_back(std::move(entry));
+    }
+    return status;
+}
+
+double TaskGraph::getElapsedMs() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!running) return 0.0;
+    return millisecondsBetween(started, finishedCount == nodes.size() ? lastEnded : Clock::now());
+}
+
+const char* TaskGraph::stateName(State state) {
+    switch (state) {
+        case State::PENDING: return "pending";
+        case State::RUNNING: return "running";
+        case State::READY: return "ready";
+        case State::FAILED: return "failed";
+        case State::SKIPPED: return "skipped";
+    }
+    return "unknown";
+}
+
+void TaskGraph::run(int id) {
+    Node& node = *nodes[static_cast<size_t>(id)];
+    State expected = State::PENDING;
+    // Already skipped when another dependency failed
+    if (node.state.compare_exchange_strong(expected, State::RUNNING, std::memory_order_acq_rel)) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            node.began = Clock::now();
+        }
+
+        bool ok = false;
+        std::string error;
+        try {
+            ok = node.task();
+            if (!ok) error = "failed";
+        } catch (const std::exception& e) {
+            error = e.what();
+        } catch (...) {
+            error = "unknown exception";
+        }
+        finish(id, ok ? State::READY : State::FAILED, error);
+    }
+
+    // Last, so waitAll() cannot return while this task still touches the
+    // graph; notified under the lock since the graph may be destroyed as
+    // soon as it is released
+    std::lock_guard<std::mutex> lock(mutex);
+    active--;
+    finished.notify_all();
+}
+
+void TaskGraph::finish(int id, State state, const std::string& error) {
+    Node& node = *nodes[static_cast<size_t>(id)];
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        node.ended = Clock::now();
+        node.error = error;
+        node.state.store(state, std::memory_order_release);
+        finishedCount++;
+        lastEnded = node.ended;
+    }
+    finished.notify_all();
+    release(id, state == State::READY);
+}
+
+void TaskGraph::release(int id, bool succeeded) {
+    const Node& node = *nodes[static_cast<size_t>(id)];
+    for (int dependent : node.dependents) {
+        Node& next = *nodes[static_cast<size_t>(dependent)];
+        if (succeeded) {
+            if (next.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    active++;
+                }
+                pool.submit([this, dependent]() { run(dependent); });
+            }
+        } else {
+            State expected = State::PENDING;
+            if (next.state.compare_exchange_strong(expected, State::SKIPPED, std::memory_order_acq_rel)) {
+                // finish() publishes SKIPPED again under the lock for waiters
+                finish(dependent, State::SKIPPED, "dependency " + node.name + " did not succeed");
+            }
+        }
+    }
+}
+
+} // namespace pixhawk
@@ -0,0 +1,95 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "ThreadPool.hpp"
+
+namespace pixhawk {
+
+// One-shot graph of named tasks run on a ThreadPool, each as soon as all
+// of its dependencies have succeeded. A task that returns false or throws
+// fails, and every task depending on it is skipped. Task states are
+// readable without locking, so callers can poll for readiness on hot paths
+// while the graph is still running.
+class TaskGraph {
+public:
+    enum class State {
+        PENDING,
+        RUNNING,
+        READY,
+        FAILED,
+        SKIPPED
+    };
+
+    struct TaskStatus {
+        std::string name;
+        State state;
+        double start_ms;        // since start(); 0 if it has not run
+        double duration_ms;
+        std::string error;
+    };
+
+    explicit TaskGraph(ThreadPool& pool);
+    // Waits for the tasks still running
+    ~TaskGraph();
+
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    // Only before start(). Dependencies are ids returned by earlier calls,
+    // so the graph cannot have cycles.
+    int add(const std::string& name, std::function<bool()> task, const std::vector<int>& dependencies = {});
+    void start();
+
+    State getState(int id) const;
+    bool isReady(int id) const { return getState(id) == State::READY; }
+    bool isComplete() const;
+    // Blocks until the task has finished; true if it succeeded
+    bool wait(int id) const;
+    void waitAll() const;
+
+    std::vector<TaskStatus> getStatus() const;
+    // Since start() until the last task finished, or until now while running
+    double getElapsedMs() const;
+
+    static const char* stateName(State state);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Node {
+        std::string name;
+        std::function<bool()> task;
+        std::vector<int> dependents;
+        std::atomic<size_t> remaining{0};   // dependencies not yet succeeded
+        std::atomic<State> state{State::PENDING};
+        // Guarded by mutex
+        Clock::time_point began;
+        Clock::time_point ended;
+        std::string error;
+    };
+
+    ThreadPool& pool;
+    std::vector<std::unique_ptr<Node>> nodes;
+    Clock::time_point started;
+    bool running = false;
+
+    mutable std::mutex mutex;
+    mutable std::condition_variable finished;
+    size_t finishedCount = 0;
+    size_t active = 0;                  // run() calls submitted and not yet returned
+    Clock::time_point lastEnded;
+
+    void run(int id);
+    void finish(int id, State state, const std::string& error);
+    void release(int id, bool succeeded);
+};
+
+} // namespace pixhawk
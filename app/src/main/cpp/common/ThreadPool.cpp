@@ -0,0 +1,149 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace pixhawk {
+
+namespace {
+
+// Identifies the pool and deque owned by the current thread, if any
+thread_local const ThreadPool* t_pool = nullptr;
+thread_local size_t t_queue = 0;
+
+} // namespace
+
+ThreadPool::ThreadPool(size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    queues.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    available.notify_all();
+
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+size_t ThreadPool::size() const {
+    return workers.size();
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& body) {
+    if (count == 0) return;
+
+    std::atomic<size_t> next{0};
+    std::mutex errorMutex;
+    std::exception_ptr firstError;
+
+    auto drain = [&]() {
+        for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            try {
+                body(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!firstError) firstError = std::current_exception();
+            }
+        }
+    };
+
+    // One helper per worker at most; the caller drains alongside them
+    const size_t helpers = std::min(count - 1, workers.size());
+    std::vector<std::future<void>> pending;
+    pending.reserve(helpers);
+    for (size_t h = 0; h < helpers; h++) {
+        pending.push_back(submit(drain));
+    }
+    drain();
+
+    // Helpers may still be queued behind us (or on our own deque when called
+    // from a worker), so run pending tasks instead of blocking on them
+    for (auto& f : pending) {
+        while (f.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            if (!runPendingTask()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    const size_t target = t_pool == this
+        ? t_queue
+        : nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    queued.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(queues[target]->mutex);
+        queues[target]->tasks.push_back(std::move(task));
+    }
+
+    // Taking the lock orders this wakeup after a sleeper's predicate check
+    { std::lock_guard<std::mutex> lock(sleepMutex); }
+    available.notify_one();
+}
+
+// Pops from the back of this thread's own deque, otherwise steals from the
+// front of the others. Returns false if every deque was empty.
+bool ThreadPool::runPendingTask() {
+    const size_t count = queues.size();
+    const bool isWorker = t_pool == this;
+    const size_t home = isWorker ? t_queue : 0;
+
+    std::function<void()> task;
+    for (size_t offset = 0; offset < count && !task; offset++) {
+        WorkerQueue& queue = *queues[(home + offset) % count];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) continue;
+
+        if (isWorker && offset == 0) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        } else {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+    }
+
+    if (!task) return false;
+    queued.fetch_sub(1);
+    task();
+    return true;
+}
+
+void ThreadPool::workerLoop(size_t index) {
+    t_pool = this;
+    t_queue = index;
+
+    while (true) {
+        if (runPendingTask()) continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        available.wait(lock, [this]() { return stopping || queued.load() > 0; });
+        if (stopping && queued.load() == 0) {
+            return;
+        }
+    }
+}
+
+} // namespace pixhawk
@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace pixhawk {
+
+// Fixed-size work-stealing pool for CPU-bound batch jobs (log
+// re-processing, bulk geodesy, simulations). Each worker owns a deque: it
+// pushes and pops its own tasks at the back and steals from the front of
+// the others when it runs dry, so nested submissions stay cache-local and
+// idle workers rebalance without a shared queue lock.
+class ThreadPool {
+public:
+    // threadCount == 0 uses one worker per hardware thread
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const;
+
+    template <typename F>
+    auto submit(F&& task) -> std::future<std::invoke_result_t<F>> {
+        using Result = std::invoke_result_t<F>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        std::future<Result> result = packaged->get_future();
+        enqueue([packaged]() { (*packaged)(); });
+        return result;
+    }
+
+    // Runs body(i) for i in [0, count) across the pool and waits for all of
+    // them. Indices are handed out dynamically and the calling thread takes
+    // part, so this is safe to call from inside a pool task. The first
+    // exception thrown by any iteration is rethrown here.
+    void parallelFor(size_t count, const std::function<void(size_t)>& body);
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex sleepMutex;
+    std::condition_variable available;
+    std::atomic<size_t> queued{0};
+    std::atomic<size_t> nextQueue{0};
+    bool stopping = false;  // guarded by sleepMutex
+
+    void enqueue(std::function<void()> task);
+    bool runPendingTask();
+    void workerLoop(size_t index);
+};
+
+} // namespace pixhawk
@@ -1,8 +1,54 @@
 #include "ElevationLookup.hpp"
+#include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <sys/stat.h>
+
+#ifdef PIXHAWKCORE_VERBOSE
+#include <android/log.h>
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, "ElevationLookup", __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, "ElevationLookup", __VA_ARGS__)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#endif
 
 namespace pixhawk {
 
+namespace {
+
+constexpr double DEG_TO_RAD = M_PI / 180.0;
+constexpr double RAD_TO_DEG = 180.0 / M_PI;
+
+constexpr int SAMPLES_1_ARCSEC = 3601;
+constexpr int SAMPLES_3_ARCSEC = 1201;
+constexpr int16_t VOID_SAMPLE = -32768;
+constexpr size_t MIN_CACHE_TILES = 4;
+
+// Floors of a position's tile, with lat 90 and lon 180 folded into the last cell
+void tileFloors(double lat, double& lon, int& latFloor, int& lonFloor) {
+    lon = std::fmod(lon + 180.0, 360.0);
+    if (lon < 0.0) lon += 360.0;
+    lon -= 180.0;
+    latFloor = std::clamp(static_cast<int>(std::floor(lat)), -90, 89);
+    lonFloor = std::min(static_cast<int>(std::floor(lon)), 179);
+}
+
+int wrapLonFloor(int lonFloor) {
+    return lonFloor < -180 ? lonFloor + 360 : lonFloor > 179 ? lonFloor - 360 : lonFloor;
+}
+
+std::string tileName(int latFloor, int lonFloor) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%c%02d%c%03d.hgt",
+                  latFloor >= 0 ? 'N' : 'S', std::abs(latFloor),
+                  lonFloor >= 0 ? 'E' : 'W', std::abs(lonFloor));
+    return name;
+}
+
+} // namespace
+
 ElevationLookup::ElevationLookup() = default;
 ElevationLookup::~ElevationLookup() = default;
 
@@ -11,18 +57,214 @@ bool ElevationLookup::initialize() {
     return true;
 }
 
+bool ElevationLookup::setTileDirectory(const std::string& directory) {
+    if (!directory.empty()) {
+        struct stat info;
+        if (stat(directory.c_str(), &info) != 0 || !S_ISDIR(info.st_mode)) {
+            LOGE("Terrain directory %s not found", directory.c_str());
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    tileDirectory = directory;
+    tiles.clear();
+    tileIndex.clear();
+    LOGI("Terrain directory set to '%s'", directory.c_str());
+    return true;
+}
+
+void ElevationLookup::setCacheCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    cacheCapacity = std::max(capacity, MIN_CACHE_TILES);
+    while (tiles.size() > cacheCapacity) {
+        tileIndex.erase(tiles.back().key);
+        tiles.pop_back();
+    }
+}
+
 double ElevationLookup::getElevation(double lat, double lon) const {
     if (!initialized) return 0.0;
-    
-    // Simple terrain elevation simulation
-    double dlat = lat * M_PI / 180.0;
-    double dlon = lon * M_PI / 180.0;
-    
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    if (tileDirectory.empty()) {
+        return syntheticElevation(lat, lon);
+    }
+
+    const Tile* last = nullptr;
+    const double elevation = lookupLocked(lat, lon, last);
+
+    int latFloor, lonFloor;
+    tileFloors(lat, lon, latFloor, lonFloor);
+    prefetchNeighbors(latFloor, lonFloor, lat, lon);
+    return elevation;
+}
+
+std::vector<double> ElevationLookup::profile(double lat0, double lon0, double lat1, double lon1, int count) const {
+    std::vector<double> out(static_cast<size_t>(std::max(count, 0)));
+    profile(lat0, lon0, lat1, lon1, count, out.data());
+    return out;
+}
+
+void ElevationLookup::profile(double lat0, double lon0, double lat1, double lon1, int count, double* out) const {
+    if (count <= 0) return;
+    if (!initialized) {
+        std::fill(out, out + count, 0.0);
+        return;
+    }
+
+    // Endpoints as unit vectors a and b. Samples are a rotated towards b by
+    // equal steps; u completes the orthonormal basis of the great circle plane.
+    const double a[3] = {std::cos(lat0 * DEG_TO_RAD) * std::cos(lon0 * DEG_TO_RAD),
+                         std::cos(lat0 * DEG_TO_RAD) * std::sin(lon0 * DEG_TO_RAD),
+                         std::sin(lat0 * DEG_TO_RAD)};
+    const double b[3] = {std::cos(lat1 * DEG_TO_RAD) * std::cos(lon1 * DEG_TO_RAD),
+                         std::cos(lat1 * DEG_TO_RAD) * std::sin(lon1 * DEG_TO_RAD),
+                         std::sin(lat1 * DEG_TO_RAD)};
+    const double dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    double u[3] = {b[0] - dot * a[0], b[1] - dot * a[1], b[2] - dot * a[2]};
+    const double norm = std::sqrt(u[0] * u[0] + u[1] * u[1] + u[2] * u[2]);
+    const double angle = std::atan2(norm, dot);
+    for (double& component : u) {
+        component = norm > 1e-12 ? component / norm : 0.0;
+    }
+
+    // cos/sin of the running angle advance by a fixed rotation, so each sample
+    // only pays for the two atan2 calls back to lat/lon
+    const double stepAngle = count > 1 ? angle / (count - 1) : 0.0;
+    const double stepCos = std::cos(stepAngle);
+    const double stepSin = std::sin(stepAngle);
+    double c = 1.0;
+    double s = 0.0;
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    const Tile* last = nullptr;
+    for (int i = 0; i < count; i++) {
+        const double x = c * a[0] + s * u[0];
+        const double y = c * a[1] + s * u[1];
+        const double z = c * a[2] + s * u[2];
+        const double lat = std::atan2(z, std::sqrt(x * x + y * y)) * RAD_TO_DEG;
+        const double lon = std::atan2(y, x) * RAD_TO_DEG;
+        out[i] = tileDirectory.empty() ? syntheticElevation(lat, lon) : lookupLocked(lat, lon, last);
+
+        const double nextCos = c * stepCos - s * stepSin;
+        s = s * stepCos + c * stepSin;
+        c = nextCos;
+    }
+}
+
+int ElevationLookup::tileKey(int latFloor, int lonFloor) {
+    return (latFloor + 90) * 360 + (lonFloor + 180);
+}
+
+// Caller holds cacheMutex. The returned tile stays valid until the next
+// acquireTile call.
+const ElevationLookup::Tile& ElevationLookup::acquireTile(int latFloor, int lonFloor) const {
+    const int key = tileKey(latFloor, lonFloor);
+    auto found = tileIndex.find(key);
+    if (found != tileIndex.end()) {
+        tiles.splice(tiles.begin(), tiles, found->second);
+        return tiles.front();
+    }
+
+    // Missing tiles are cached too, so open ocean is not re-probed per sample
+    tiles.emplace_front();
+    Tile& tile = tiles.front();
+    tile.key = key;
+    const std::string path = tileDirectory + "/" + tileName(latFloor, lonFloor);
+    if (tile.file.openFile(path)) {
+        const size_t size = tile.file.size();
+        if (size == size_t(2) * SAMPLES_1_ARCSEC * SAMPLES_1_ARCSEC) {
+            tile.samples = SAMPLES_1_ARCSEC;
+        } else if (size == size_t(2) * SAMPLES_3_ARCSEC * SAMPLES_3_ARCSEC) {
+            tile.samples = SAMPLES_3_ARCSEC;
+        } else {
+            LOGE("Unexpected tile size %zu for %s", size, path.c_str());
+            tile.file.close();
+        }
+    }
+    tileIndex[key] = tiles.begin();
+
+    while (tiles.size() > cacheCapacity) {
+        tileIndex.erase(tiles.back().key);
+        tiles.pop_back();
+    }
+    return tiles.front();
+}
+
+void ElevationLookup::prefetchTile(int latFloor, int lonFloor) const {
+    if (latFloor < -90 || latFloor > 89) return;
+    lonFloor = wrapLonFloor(lonFloor);
+    if (tileIndex.count(tileKey(latFloor, lonFloor))) return;
+
+    const Tile& tile = acquireTile(latFloor, lonFloor);
+    tile.file.adviseWillNeed();
+}
+
+// Close to a tile edge, map the tile across it and let the kernel start
+// reading it before the vehicle gets there
+void ElevationLookup::prefetchNeighbors(int latFloor, int lonFloor, double lat, double lon) const {
+    const double fy = lat - latFloor;
+    const double fx = lon - lonFloor;
+    const int dLat = fy > 1.0 - PREFETCH_MARGIN ? 1 : fy < PREFETCH_MARGIN ? -1 : 0;
+    const int dLon = fx > 1.0 - PREFETCH_MARGIN ? 1 : fx < PREFETCH_MARGIN ? -1 : 0;
+
+    if (dLat != 0) prefetchTile(latFloor + dLat, lonFloor);
+    if (dLon != 0) prefetchTile(latFloor, lonFloor + dLon);
+    if (dLat != 0 && dLon != 0) prefetchTile(latFloor + dLat, lonFloor + dLon);
+}
+
+// Caller holds cacheMutex. 'last' carries the previous sample's tile so runs
+// of samples in one tile skip the cache lookup.
+double ElevationLookup::lookupLocked(double lat, double lon, const Tile*& last) const {
+    int latFloor, lonFloor;
+    tileFloors(lat, lon, latFloor, lonFloor);
+    if (!last || last->key != tileKey(latFloor, lonFloor)) {
+        last = &acquireTile(latFloor, lonFloor);
+    }
+    return sampleTile(*last, latFloor, lonFloor, lat, lon);
+}
+
+double ElevationLookup::sampleTile(const Tile& tile, int latFloor, int lonFloor, double lat, double lon) {
+    if (tile.samples == 0) return 0.0;
+
+    const int last = tile.samples - 1;
+    const double y = std::clamp((latFloor + 1 - lat) * last, 0.0, static_cast<double>(last));
+    const double x = std::clamp((lon - lonFloor) * last, 0.0, static_cast<double>(last));
+    const int r = std::min(static_cast<int>(y), last - 1);
+    const int c = std::min(static_cast<int>(x), last - 1);
+    const double fy = y - r;
+    const double fx = x - c;
+
+    const uint8_t* data = tile.file.data();
+    auto at = [&](int row, int col) {
+        const uint8_t* p = data + 2 * (static_cast<size_t>(row) * static_cast<size_t>(tile.samples) + static_cast<size_t>(col));
+        return static_cast<int16_t>((p[0] << 8) | p[1]);
+    };
+
+    // Bilinear, leaving out void samples and renormalizing the weights
+    const int16_t s[4] = {at(r, c), at(r, c + 1), at(r + 1, c), at(r + 1, c + 1)};
+    const double w[4] = {(1.0 - fy) * (1.0 - fx), (1.0 - fy) * fx, fy * (1.0 - fx), fy * fx};
+    double sum = 0.0;
+    double weight = 0.0;
+    for (int i = 0; i < 4; i++) {
+        if (s[i] != VOID_SAMPLE) {
+            sum += w[i] * s[i];
+            weight += w[i];
+        }
+    }
+    return weight > 0.0 ? sum / weight : 0.0;
+}
+
+double ElevationLookup::syntheticElevation(double lat, double lon) {
+    double dlat = lat * DEG_TO_RAD;
+    double dlon = lon * DEG_TO_RAD;
+
     // Create some hills and valleys
     double elevation = 500.0 + 200.0 * std::sin(dlat * 2.0) * std::cos(dlon * 1.5);
     elevation += 100.0 * std::sin(dlat * 5.0) * std::sin(dlon * 3.0);
-    
+
     return std::max(0.0, elevation); // No negative elevations (below sea level)
 }
 
-} // namespace pixhawk
\ No newline at end of file
+} // namespace pixhawk
@@ -1,17 +1,65 @@
 #pragma once
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "MappedFile.hpp"
 
 namespace pixhawk {
 
+// Terrain elevation (meters above the geoid) from SRTM-style .hgt tiles:
+// one file per 1x1 degree cell named like N37W123.hgt, holding big-endian
+// int16 samples at 1" (3601x3601) or 3" (1201x1201), rows north to south.
+// Tiles are memory-mapped on demand and kept in a bounded LRU cache.
+// Without a tile directory the lookup returns a synthetic test surface.
 class ElevationLookup {
 public:
     ElevationLookup();
     ~ElevationLookup();
-    
+
     bool initialize();
+
+    // Returns false if 'directory' does not exist. An empty string switches
+    // back to the synthetic surface.
+    bool setTileDirectory(const std::string& directory);
+    void setCacheCapacity(size_t tiles);
+
+    // Points without a tile (open ocean in SRTM) read as 0 m
     double getElevation(double lat, double lon) const;
-    
+
+    // 'count' evenly spaced samples along the great circle from
+    // (lat0, lon0) to (lat1, lon1), both endpoints included
+    std::vector<double> profile(double lat0, double lon0, double lat1, double lon1, int count) const;
+    void profile(double lat0, double lon0, double lat1, double lon1, int count, double* out) const;
+
 private:
+    struct Tile {
+        int key;
+        MappedFile file;
+        int samples = 0;            // per side; 0 when the tile does not exist
+    };
+
+    static constexpr size_t DEFAULT_CACHE_TILES = 16;
+    static constexpr double PREFETCH_MARGIN = 0.1;  // fraction of a tile from its edge
+
     bool initialized = false;
+    std::string tileDirectory;
+    size_t cacheCapacity = DEFAULT_CACHE_TILES;
+
+    // Most recently used first
+    mutable std::mutex cacheMutex;
+    mutable std::list<Tile> tiles;
+    mutable std::unordered_map<int, std::list<Tile>::iterator> tileIndex;
+
+    static int tileKey(int latFloor, int lonFloor);
+    const Tile& acquireTile(int latFloor, int lonFloor) const;
+    void prefetchTile(int latFloor, int lonFloor) const;
+    void prefetchNeighbors(int latFloor, int lonFloor, double lat, double lon) const;
+    double lookupLocked(double lat, double lon, const Tile*& last) const;
+    static double sampleTile(const Tile& tile, int latFloor, int lonFloor, double lat, double lon);
+    static double syntheticElevation(double lat, double lon);
 };
 
-} // namespace pixhawk
\ No newline at end of file
+} // namespace pixhawk
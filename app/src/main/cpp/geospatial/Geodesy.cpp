@@ -0,0 +1,390 @@
+#include "Geodesy.hpp"
+#include <algorithm>
+#include <cmath>
+#include "SimdPack.hpp"
+#include "ThreadPool.hpp"
+
+namespace pixhawk {
+
+namespace {
+
+using simd::NativePackD;
+using ScalarPackD = simd::ScalarPackT<double>;
+
+constexpr double DEG_TO_RAD = M_PI / 180.0;
+constexpr double RAD_TO_DEG = 180.0 / M_PI;
+
+constexpr double WGS84_A = 6378137.0;
+constexpr double WGS84_F = 1.0 / 298.257223563;
+constexpr double WGS84_B = WGS84_A * (1.0 - WGS84_F);
+constexpr double WGS84_E2 = WGS84_F * (2.0 - WGS84_F);         // first eccentricity squared
+constexpr double WGS84_EP2 = WGS84_E2 / (1.0 - WGS84_E2);      // second eccentricity squared
+
+constexpr double UTM_K0 = 0.9996;
+constexpr double UTM_FALSE_EASTING = 500000.0;
+constexpr double UTM_FALSE_NORTHING_SOUTH = 10000000.0;
+constexpr int KRUEGER_ORDER = 6;
+
+constexpr size_t PARALLEL_CHUNK = 16384;    // points per pool task
+
+// Bowring's formula, then once more from its own output. The second pass
+// leaves nothing above double rounding from the core to beyond GEO.
+constexpr int BOWRING_PASSES = 2;
+
+template <typename P>
+struct PackTag {
+    using type = P;
+};
+
+// Runs 'body' over whole double packs, then over the remaining elements
+// with single lanes
+template <typename Body>
+void forEachPack(size_t count, Body body) {
+    const size_t width = static_cast<size_t>(NativePackD::WIDTH);
+    size_t i = 0;
+    for (; i + width <= count; i += width) {
+        body(PackTag<NativePackD>(), i);
+    }
+    for (; i < count; i++) {
+        body(PackTag<ScalarPackD>(), i);
+    }
+}
+
+template <typename Body>
+void forEachChunk(ThreadPool& pool, size_t count, Body body) {
+    const size_t chunks = (count + PARALLEL_CHUNK - 1) / PARALLEL_CHUNK;
+    pool.parallelFor(chunks, [&](size_t c) {
+        const size_t offset = c * PARALLEL_CHUNK;
+        body(offset, std::min(PARALLEL_CHUNK, count - offset));
+    });
+}
+
+template <typename T>
+GeodeticArrays<T> offsetArrays(GeodeticArrays<T> a, size_t offset) {
+    return {a.lat + offset, a.lon + offset, a.alt + offset};
+}
+
+template <typename T>
+CartesianArrays<T> offsetArrays(CartesianArrays<T> a, size_t offset) {
+    return {a.x + offset, a.y + offset, a.z + offset};
+}
+
+template <typename P>
+void geodeticToEcefLanes(P lat, P lon, P alt, P& x, P& y, P& z) {
+    P sinLat, cosLat, sinLon, cosLon;
+    simd::preciseSinCos(lat * P(DEG_TO_RAD), sinLat, cosLat);
+    simd::preciseSinCos(lon * P(DEG_TO_RAD), sinLon, cosLon);
+
+    // Prime vertical radius of curvature
+    const P n = P(WGS84_A) / sqrt(P(1.0) - P(WGS84_E2) * sinLat * sinLat);
+    const P horizontal = (n + alt) * cosLat;
+    x = horizontal * cosLon;
+    y = horizontal * sinLon;
+    z = (n * P(1.0 - WGS84_E2) + alt) * sinLat;
+}
+
+template <typename P>
+void ecefToGeodeticLanes(P x, P y, P z, P& lat, P& lon, P& alt) {
+    const P p = sqrt(x * x + y * y);
+
+    // Reduced latitude as an unnormalized (sin, cos) pair, starting from
+    // tan(beta) = a z / (b p). Pairs instead of tangents keep the poles finite.
+    P sinBeta = z * P(WGS84_A);
+    P cosBeta = p * P(WGS84_B);
+    P num, den;
+    for (int pass = 0; pass < BOWRING_PASSES; pass++) {
+        const P inv = P(1.0) / max(sqrt(sinBeta * sinBeta + cosBeta * cosBeta), P(1e-300));
+        const P s = sinBeta * inv;
+        const P c = cosBeta * inv;
+        num = z + P(WGS84_EP2 * WGS84_B) * s * s * s;
+        den = p - P(WGS84_E2 * WGS84_A) * c * c * c;
+        // tan(beta) = (b / a) tan(phi)
+        sinBeta = num * P(WGS84_B);
+        cosBeta = den * P(WGS84_A);
+    }
+
+    const P inv = P(1.0) / max(sqrt(num * num + den * den), P(1e-300));
+    const P sinLat = num * inv;
+    const P cosLat = den * inv;
+    lat = simd::preciseAtan2(num, den) * P(RAD_TO_DEG);
+    lon = simd::preciseAtan2(y, x) * P(RAD_TO_DEG);
+    alt = p * cosLat + z * sinLat - P(WGS84_A) * sqrt(P(1.0) - P(WGS84_E2) * sinLat * sinLat);
+}
+
+// Krueger series coefficients for the WGS84 third flattening n
+struct KruegerSeries {
+    double rectifyingRadius;    // A, meridian length / (pi/2)
+    double alpha[KRUEGER_ORDER + 1];
+    double beta[KRUEGER_ORDER + 1];
+    double eccentricity;
+
+    KruegerSeries() {
+        const double n = WGS84_F / (2.0 - WGS84_F);
+        const double n2 = n * n, n3 = n2 * n, n4 = n3 * n, n5 = n4 * n, n6 = n5 * n;
+
+        rectifyingRadius = WGS84_A / (1.0 + n) * (1.0 + n2 / 4.0 + n4 / 64.0 + n6 / 256.0);
+        eccentricity = std::sqrt(WGS84_E2);
+
+        alpha[0] = 0.0;
+        alpha[1] = n / 2.0 - 2.0 * n2 / 3.0 + 5.0 * n3 / 16.0 + 41.0 * n4 / 180.0 - 127.0 * n5 / 288.0 +
+                   7891.0 * n6 / 37800.0;
+        alpha[2] = 13.0 * n2 / 48.0 - 3.0 * n3 / 5.0 + 557.0 * n4 / 1440.0 + 281.0 * n5 / 630.0 -
+                   1983433.0 * n6 / 1935360.0;
+        alpha[3] = 61.0 * n3 / 240.0 - 103.0 * n4 / 140.0 + 15061.0 * n5 / 26880.0 + 167603.0 * n6 / 181440.0;
+        alpha[4] = 49561.0 * n4 / 161280.0 - 179.0 * n5 / 168.0 + 6601661.0 * n6 / 7257600.0;
+        alpha[5] = 34729.0 * n5 / 80640.0 - 3418889.0 * n6 / 1995840.0;
+        alpha[6] = 212378941.0 * n6 / 319334400.0;
+
+        beta[0] = 0.0;
+        beta[1] = n / 2.0 - 2.0 * n2 / 3.0 + 37.0 * n3 / 96.0 - n4 / 360.0 - 81.0 * n5 / 512.0 +
+                  96199.0 * n6 / 604800.0;
+        beta[2] = n2 / 48.0 + n3 / 15.0 - 437.0 * n4 / 1440.0 + 46.0 * n5 / 105.0 - 1118711.0 * n6 / 3870720.0;
+        beta[3] = 17.0 * n3 / 480.0 - 37.0 * n4 / 840.0 - 209.0 * n5 / 4480.0 + 5569.0 * n6 / 90720.0;
+        beta[4] = 4397.0 * n4 / 161280.0 - 11.0 * n5 / 504.0 - 830251.0 * n6 / 7257600.0;
+        beta[5] = 4583.0 * n5 / 161280.0 - 108847.0 * n6 / 3991680.0;
+        beta[6] = 20648693.0 * n6 / 638668800.0;
+    }
+};
+
+const KruegerSeries& krueger() {
+    static const KruegerSeries series;
+    return series;
+}
+
+double centralMeridian(int zone) {
+    return zone * 6.0 - 183.0;
+}
+
+// tan of the conformal latitude for tan of the geodetic latitude
+double conformalTan(double tau, double e) {
+    const double sigma = std::sinh(e * std::atanh(e * tau / std::sqrt(1.0 + tau * tau)));
+    return tau * std::sqrt(1.0 + sigma * sigma) - sigma * std::sqrt(1.0 + tau * tau);
+}
+
+} // namespace
+
+namespace geodesy {
+
+void geodeticToEcef(double lat, double lon, double alt, double& x, double& y, double& z) {
+    ScalarPackD px, py, pz;
+    geodeticToEcefLanes<ScalarPackD>(lat, lon, alt, px, py, pz);
+    x = px.v;
+    y = py.v;
+    z = pz.v;
+}
+
+void ecefToGeodetic(double x, double y, double z, double& lat, double& lon, double& alt) {
+    ScalarPackD plat, plon, palt;
+    ecefToGeodeticLanes<ScalarPackD>(x, y, z, plat, plon, palt);
+    lat = plat.v;
+    lon = plon.v;
+    alt = palt.v;
+}
+
+void geodeticToEcef(GeodeticArrays<const double> in, CartesianArrays<double> out, size_t count) {
+    forEachPack(count, [&](auto tag, size_t i) {
+        using P = typename decltype(tag)::type;
+        P x, y, z;
+        geodeticToEcefLanes<P>(P::load(in.lat + i), P::load(in.lon + i), P::load(in.alt + i), x, y, z);
+        x.store(out.x + i);
+        y.store(out.y + i);
+        z.store(out.z + i);
+    });
+}
+
+void ecefToGeodetic(CartesianArrays<const double> in, GeodeticArrays<double> out, size_t count) {
+    forEachPack(count, [&](auto tag, size_t i) {
+        using P = typename decltype(tag)::type;
+        P lat, lon, alt;
+        ecefToGeodeticLanes<P>(P::load(in.x + i), P::load(in.y + i), P::load(in.z + i), lat, lon, alt);
+        lat.store(out.lat + i);
+        lon.store(out.lon + i);
+        alt.store(out.alt + i);
+    });
+}
+
+void geodeticToEcef(ThreadPool& pool, GeodeticArrays<const double> in, CartesianArrays<double> out, size_t count) {
+    forEachChunk(pool, count, [&](size_t offset, size_t n) {
+        geodeticToEcef(offsetArrays(in, offset), offsetArrays(out, offset), n);
+    });
+}
+
+void ecefToGeodetic(ThreadPool& pool, CartesianArrays<const double> in, GeodeticArrays<double> out, size_t count) {
+    forEachChunk(pool, count, [&](size_t offset, size_t n) {
+        ecefToGeodetic(offsetArrays(in, offset), offsetArrays(out, offset), n);
+    });
+}
+
+int utmZone(double lat, double lon) {
+    lon = std::fmod(lon + 180.0, 360.0);
+    if (lon < 0.0) lon += 360.0;
+    lon -= 180.0;
+    int zone = std::min(static_cast<int>(std::floor((lon + 180.0) / 6.0)) + 1, 60);
+
+    // Southwest Norway is widened into zone 32
+    if (lat >= 56.0 && lat < 64.0 && lon >= 3.0 && lon < 12.0) {
+        zone = 32;
+    }
+    // Svalbard uses only the odd zones 31-37
+    if (lat >= 72.0 && lat < 84.0 && lon >= 0.0 && lon < 42.0) {
+        zone = lon < 9.0 ? 31 : lon < 21.0 ? 33 : lon < 33.0 ? 35 : 37;
+    }
+    return zone;
+}
+
+bool toUtm(double lat, double lon, UtmPosition& out) {
+    if (lat < -80.0 || lat > 84.0) return false;
+    return toUtmInZone(lat, lon, utmZone(lat, lon), out);
+}
+
+bool toUtmInZone(double lat, double lon, int zone, UtmPosition& out) {
+    if (zone < 1 || zone > 60 || std::fabs(lat) >= 90.0) return false;
+    const KruegerSeries& k = krueger();
+
+    double dLon = std::remainder(lon - centralMeridian(zone), 360.0) * DEG_TO_RAD;
+    const double tau = std::tan(lat * DEG_TO_RAD);
+    const double tauPrime = conformalTan(tau, k.eccentricity);
+
+    // Gauss-Schreiber coordinates on the conformal sphere, then Krueger's series
+    const double xiPrime = std::atan2(tauPrime, std::cos(dLon));
+    const double etaPrime = std::asinh(std::sin(dLon) / std::hypot(tauPrime, std::cos(dLon)));
+    double xi = xiPrime;
+    double eta = etaPrime;
+    for (int j = 1; j <= KRUEGER_ORDER; j++) {
+        xi += k.alpha[j] * std::sin(2.0 * j * xiPrime) * std::cosh(2.0 * j * etaPrime);
+        eta += k.alpha[j] * std::cos(2.0 * j * xiPrime) * std::sinh(2.0 * j * etaPrime);
+    }
+
+    out.zone = zone;
+    out.north = lat >= 0.0;
+    out.easting = UTM_FALSE_EASTING + UTM_K0 * k.rectifyingRadius * eta;
+    out.northing = UTM_K0 * k.rectifyingRadius * xi + (out.north ? 0.0 : UTM_FALSE_NORTHING_SOUTH);
+    return true;
+}
+
+bool fromUtm(const UtmPosition& utm, double& lat, double& lon) {
+    if (utm.zone < 1 || utm.zone > 60) return false;
+    const KruegerSeries& k = krueger();
+
+    const double scale = UTM_K0 * k.rectifyingRadius;
+    const double xi = (utm.northing - (utm.north ? 0.0 : UTM_FALSE_NORTHING_SOUTH)) / scale;
+    const double eta = (utm.easting - UTM_FALSE_EASTING) / scale;
+    double xiPrime = xi;
+    double etaPrime = eta;
+    for (int j = 1; j <= KRUEGER_ORDER; j++) {
+        xiPrime -= k.beta[j] * std::sin(2.0 * j * xi) * std::cosh(2.0 * j * eta);
+        etaPrime -= k.beta[j] * std::cos(2.0 * j * xi) * std::sinh(2.0 * j * eta);
+    }
+
+    const double sinhEta = std::sinh(etaPrime);
+    const double sinXi = std::sin(xiPrime);
+    const double cosXi = std::cos(xiPrime);
+    const double tauPrime = sinXi / std::hypot(sinhEta, cosXi);
+
+    // Invert the conformal latitude by Newton's method (Karney 2011, eq. 19-21)
+    const double e2m = 1.0 - WGS84_E2;
+    double tau = tauPrime;
+    for (int i = 0; i < 5; i++) {
+        const double tauI = conformalTan(tau, k.eccentricity);
+        const double step = (tauPrime - tauI) / std::sqrt(1.0 + tauI * tauI) *
+                            (1.0 + e2m * tau * tau) / (e2m * std::sqrt(1.0 + tau * tau));
+        tau += step;
+        if (std::fabs(step) < 1e-14 * std::max(1.0, std::fabs(tau))) break;
+    }
+
+    lat = std::atan(tau) * RAD_TO_DEG;
+    lon = std::remainder(centralMeridian(utm.zone) + std::atan2(sinhEta, cosXi) * RAD_TO_DEG, 360.0);
+    return true;
+}
+
+} // namespace geodesy
+
+LocalFrame::LocalFrame() {
+    setOrigin(0.0, 0.0, 0.0);
+}
+
+LocalFrame::LocalFrame(double lat, double lon, double alt, Axes axes) : axes(axes) {
+    setOrigin(lat, lon, alt);
+}
+
+void LocalFrame::setOrigin(double lat, double lon, double alt) {
+    originLat = lat;
+    originLon = lon;
+    originAlt = alt;
+    geodesy::geodeticToEcef(lat, lon, alt, originEcef[0], originEcef[1], originEcef[2]);
+
+    const double sinLat = std::sin(lat * DEG_TO_RAD);
+    const double cosLat = std::cos(lat * DEG_TO_RAD);
+    const double sinLon = std::sin(lon * DEG_TO_RAD);
+    const double cosLon = std::cos(lon * DEG_TO_RAD);
+    const double east[3] = {-sinLon, cosLon, 0.0};
+    const double north[3] = {-sinLat * cosLon, -sinLat * sinLon, cosLat};
+    const double up[3] = {cosLat * cosLon, cosLat * sinLon, sinLat};
+    for (int k = 0; k < 3; k++) {
+        if (axes == Axes::ENU) {
+            rotation[0][k] = east[k];
+            rotation[1][k] = north[k];
+            rotation[2][k] = up[k];
+        } else {
+            rotation[0][k] = north[k];
+            rotation[1][k] = east[k];
+            rotation[2][k] = -up[k];
+        }
+    }
+}
+
+void LocalFrame::toLocal(double lat, double lon, double alt, double& x, double& y, double& z) const {
+    const GeodeticArrays<const double> in{&lat, &lon, &alt};
+    toLocal(in, CartesianArrays<double>{&x, &y, &z}, 1);
+}
+
+void LocalFrame::fromLocal(double x, double y, double z, double& lat, double& lon, double& alt) const {
+    const CartesianArrays<const double> in{&x, &y, &z};
+    fromLocal(in, GeodeticArrays<double>{&lat, &lon, &alt}, 1);
+}
+
+void LocalFrame::toLocal(GeodeticArrays<const double> in, CartesianArrays<double> out, size_t count) const {
+    forEachPack(count, [&](auto tag, size_t i) {
+        using P = typename decltype(tag)::type;
+        P ex, ey, ez;
+        geodeticToEcefLanes<P>(P::load(in.lat + i), P::load(in.lon + i), P::load(in.alt + i), ex, ey, ez);
+        const P dx = ex - P(originEcef[0]);
+        const P dy = ey - P(originEcef[1]);
+        const P dz = ez - P(originEcef[2]);
+        (P(rotation[0][0]) * dx + P(rotation[0][1]) * dy + P(rotation[0][2]) * dz).store(out.x + i);
+        (P(rotation[1][0]) * dx + P(rotation[1][1]) * dy + P(rotation[1][2]) * dz).store(out.y + i);
+        (P(rotation[2][0]) * dx + P(rotation[2][1]) * dy + P(rotation[2][2]) * dz).store(out.z + i);
+    });
+}
+
+void LocalFrame::fromLocal(CartesianArrays<const double> in, GeodeticArrays<double> out, size_t count) const {
+    forEachPack(count, [&](auto tag, size_t i) {
+        using P = typename decltype(tag)::type;
+        const P lx = P::load(in.x + i);
+        const P ly = P::load(in.y + i);
+        const P lz = P::load(in.z + i);
+        // The rotation is orthonormal, so its transpose maps back to ECEF
+        const P ex = P(originEcef[0]) + P(rotation[0][0]) * lx + P(rotation[1][0]) * ly + P(rotation[2][0]) * lz;
+        const P ey = P(originEcef[1]) + P(rotation[0][1]) * lx + P(rotation[1][1]) * ly + P(rotation[2][1]) * lz;
+        const P ez = P(originEcef[2]) + P(rotation[0][2]) * lx + P(rotation[1][2]) * ly + P(rotation[2][2]) * lz;
+        P lat, lon, alt;
+        ecefToGeodeticLanes<P>(ex, ey, ez, lat, lon, alt);
+        lat.store(out.lat + i);
+        lon.store(out.lon + i);
+        alt.store(out.alt + i);
+    });
+}
+
+void LocalFrame::toLocal(ThreadPool& pool, GeodeticArrays<const double> in, CartesianArrays<double> out, size_t count) const {
+    forEachChunk(pool, count, [&](size_t offset, size_t n) {
+        toLocal(offsetArrays(in, offset), offsetArrays(out, offset), n);
+    });
+}
+
+void LocalFrame::fromLocal(ThreadPool& pool, CartesianArrays<const double> in, GeodeticArrays<double> out, size_t count) const {
+    forEachChunk(pool, count, [&](size_t offset, size_t n) {
+        fromLocal(offsetArrays(in, offset), offsetArrays(out, offset), n);
+    });
+}
+
+} // namespace pixhawk
@@ -1,8 +1,54 @@
 #include "GeoidModel.hpp"
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include "ThreadPool.hpp"
+#include "data/GeoidHeights.inl"
+
+#ifdef PIXHAWKCORE_VERBOSE
+#include <android/log.h>
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, "GeoidModel", __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, "GeoidModel", __VA_ARGS__)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#endif
 
 namespace pixhawk {
 
+namespace {
+
+// Grid file layout, little endian:
+//   0  u32 magic 'PXGD'        4  u16 version     6  u16 header size
+//   8  u32 rows               12  u32 columns
+//  16  f64 latitude of row 0  24  f64 longitude of column 0
+//  32  f64 spacing (degrees)  40  f64 scale (m/count)  48  f64 offset (m)
+//  56  u32 flags (bit 0: columns wrap around 360 degrees)
+// followed by rows * columns int16 samples, row-major from north to south.
+constexpr uint32_t GRID_MAGIC = 0x44475850;     // "PXGD"
+constexpr uint16_t GRID_VERSION = 1;
+constexpr size_t GRID_HEADER_SIZE = 64;
+constexpr uint32_t FLAG_WRAPS_LONGITUDE = 1u;
+
+template <typename T>
+T readField(const uint8_t* p, size_t offset) {
+    T value;
+    std::memcpy(&value, p + offset, sizeof(T));
+    return value;
+}
+
+// Catmull-Rom weights for the four samples around fraction t
+void cubicWeights(double t, double (&w)[4]) {
+    const double t2 = t * t;
+    const double t3 = t2 * t;
+    w[0] = 0.5 * (-t3 + 2.0 * t2 - t);
+    w[1] = 0.5 * (3.0 * t3 - 5.0 * t2 + 2.0);
+    w[2] = 0.5 * (-3.0 * t3 + 4.0 * t2 + t);
+    w[3] = 0.5 * (t3 - t2);
+}
+
+} // namespace
+
 GeoidModel::GeoidModel() = default;
 GeoidModel::~GeoidModel() = default;
 
@@ -11,15 +57,218 @@ bool GeoidModel::initialize() {
     return true;
 }
 
+bool GeoidModel::initialize(AAssetManager* assets) {
+    if (assets && file.openAsset(assets, GRID_ASSET) && attachGrid()) {
+        LOGI("Geoid grid %ux%u mapped (%.4f deg)", rows, cols, spacing);
+    } else {
+        file.close();
+        LOGE("No geoid grid asset; separations come from a placeholder table, off by over 100 m");
+    }
+    regionalGrid.clear();
+    initialized = true;
+    return true;
+}
+
+bool GeoidModel::loadGrid(const std::string& path) {
+    if (!file.openFile(path) || !attachGrid()) {
+        LOGE("Failed to load geoid grid %s", path.c_str());
+        file.close();
+        grid = nullptr;
+        regionalGrid.clear();
+        return false;
+    }
+    regionalGrid.clear();
+    initialized = true;
+    return true;
+}
+
+void GeoidModel::setInterpolation(Interpolation mode) {
+    interpolation = mode;
+    regionalGrid.clear();
+}
+
+void GeoidModel::setRegionalGrid(double radiusKm, double spacing) {
+    regionalGrid.configure(radiusKm, spacing);
+}
+
+bool GeoidModel::attachGrid() {
+    grid = nullptr;
+    const uint8_t* p = file.data();
+    if (!p || file.size() < GRID_HEADER_SIZE) return false;
+
+    if (readField<uint32_t>(p, 0) != GRID_MAGIC || readField<uint16_t>(p, 4) != GRID_VERSION) {
+        return false;
+    }
+    const size_t headerSize = readField<uint16_t>(p, 6);
+    const uint32_t gridRows = readField<uint32_t>(p, 8);
+    const uint32_t gridCols = readField<uint32_t>(p, 12);
+    const double gridSpacing = readField<double>(p, 32);
+    if (headerSize < GRID_HEADER_SIZE || headerSize % 2 != 0 || gridRows < 2 || gridCols < 2 ||
+        !(gridSpacing > 0.0) ||
+        file.size() < headerSize + static_cast<size_t>(gridRows) * gridCols * sizeof(int16_t)) {
+        return false;
+    }
+
+    rows = gridRows;
+    cols = gridCols;
+    northLat = readField<double>(p, 16);
+    westLon = readField<double>(p, 24);
+    spacing = gridSpacing;
+    invSpacing = 1.0 / gridSpacing;
+    scale = readField<double>(p, 40);
+    offset = readField<double>(p, 48);
+    wrapsLongitude = (readField<uint32_t>(p, 56) & FLAG_WRAPS_LONGITUDE) != 0;
+    spansPoles = wrapsLongitude && cols % 2 == 0 &&
+                 std::abs(northLat - 90.0) < 1e-9 &&
+                 std::abs(northLat - (rows - 1) * spacing + 90.0) < 1e-9;
+
+    // Lookups touch a handful of neighbouring samples anywhere in the grid
+    file.adviseRandomAccess();
+    grid = reinterpret_cast<const int16_t*>(p + headerSize);
+    return true;
+}
+
 double GeoidModel::getGeoidHeight(double lat, double lon) const {
     if (!initialized) return 0.0;
-    
-    // Simple approximation for demonstration
-    return -30.0 + 60.0 * std::sin(lat * M_PI / 180.0) * std::cos(lon * M_PI / 360.0);
+    if (regionalCache) {
+        auto region = regionalGrid.acquire(lat, lon, [this](double la, double lo, float* v) {
+            v[0] = static_cast<float>(modelHeight(la, lo));
+        });
+        if (region) {
+            double height;
+            region->interpolate(lat, lon, &height);
+            return height;
+        }
+    }
+    return modelHeight(lat, lon);
 }
 
 double GeoidModel::getGeoidSeparation(double lat, double lon) const {
     return getGeoidHeight(lat, lon);
 }
 
-} // namespace pixhawk
\ No newline at end of file
+void GeoidModel::getGeoidSeparationBatch(const double* lat, const double* lon, size_t count, double* out) const {
+    if (!initialized) {
+        std::fill(out, out + count, 0.0);
+        return;
+    }
+    if (regionalCache && count > 0) {
+        // One grid for the whole batch; points outside it use the model
+        auto region = regionalGrid.acquire(lat[0], lon[0], [this](double la, double lo, float* v) {
+            v[0] = static_cast<float>(modelHeight(la, lo));
+        });
+        for (size_t i = 0; i < count; i++) {
+            if (region && region->contains(lat[i], lon[i])) {
+                region->interpolate(lat[i], lon[i], out + i);
+            } else {
+                out[i] = modelHeight(lat[i], lon[i]);
+            }
+        }
+        return;
+    }
+    if (grid) {
+        for (size_t i = 0; i < count; i++) out[i] = interpolateGrid(lat[i], lon[i]);
+    } else {
+        for (size_t i = 0; i < count; i++) out[i] = interpolateTable(lat[i], lon[i]);
+    }
+}
+
+double GeoidModel::modelHeight(double lat, double lon) const {
+    return grid ? interpolateGrid(lat, lon) : interpolateTable(lat, lon);
+}
+
+void GeoidModel::getGeoidSeparationBatch(ThreadPool& pool, const double* lat, const double* lon,
+                                         size_t count, double* out) const {
+    const size_t chunks = (count + PARALLEL_CHUNK - 1) / PARALLEL_CHUNK;
+    pool.parallelFor(chunks, [&](size_t c) {
+        const size_t offset = c * PARALLEL_CHUNK;
+        const size_t n = std::min(PARALLEL_CHUNK, count - offset);
+        getGeoidSeparationBatch(lat + offset, lon + offset, n, out + offset);
+    });
+}
+
+double GeoidModel::sample(int64_t row, int64_t col) const {
+    // Rows past a pole continue down the opposite meridian
+    const int64_t lastRow = static_cast<int64_t>(rows) - 1;
+    if (spansPoles && (row < 0 || row > lastRow)) {
+        row = row < 0 ? -row : 2 * lastRow - row;
+        col += cols / 2;
+    }
+    row = std::clamp<int64_t>(row, 0, lastRow);
+    if (wrapsLongitude) {
+        col %= static_cast<int64_t>(cols);
+        if (col < 0) col += cols;
+    } else {
+        col = std::clamp<int64_t>(col, 0, static_cast<int64_t>(cols) - 1);
+    }
+    return grid[row * static_cast<int64_t>(cols) + col] * scale + offset;
+}
+
+double GeoidModel::interpolateGrid(double lat, double lon) const {
+    lat = std::clamp(lat, -90.0, 90.0);
+    double east = std::fmod(lon - westLon, 360.0);
+    if (east < 0.0) east += 360.0;
+
+    // O(1) cell addressing: fractional row/column straight from the position
+    const double y = (northLat - lat) * invSpacing;
+    const double x = east * invSpacing;
+    const double rowFloor = std::floor(y);
+    const double colFloor = std::floor(x);
+    const double fy = y - rowFloor;
+    const double fx = x - colFloor;
+    const int64_t r = static_cast<int64_t>(rowFloor);
+    const int64_t c = static_cast<int64_t>(colFloor);
+
+    if (interpolation == Interpolation::BICUBIC) {
+        double wy[4], wx[4];
+        cubicWeights(fy, wy);
+        cubicWeights(fx, wx);
+        double sum = 0.0;
+        for (int i = 0; i < 4; i++) {
+            double rowSum = 0.0;
+            for (int j = 0; j < 4; j++) {
+                rowSum += wx[j] * sample(r - 1 + i, c - 1 + j);
+            }
+            sum += wy[i] * rowSum;
+        }
+        return sum;
+    }
+
+    const double top = sample(r, c) + fx * (sample(r, c + 1) - sample(r, c));
+    const double bottom = sample(r + 1, c) + fx * (sample(r + 1, c + 1) - sample(r + 1, c));
+    return top + fy * (bottom - top);
+}
+
+// GEOID_HEIGHTS is a regular lat/lon grid listed south to north, west to east
+double GeoidModel::interpolateTable(double lat, double lon) const {
+    const int count = data::GEOID_HEIGHTS_COUNT;
+    int lonCount = 1;
+    while (lonCount < count && data::GEOID_HEIGHTS[lonCount][0] == data::GEOID_HEIGHTS[0][0]) {
+        lonCount++;
+    }
+    const int latCount = count / lonCount;
+    if (latCount < 2 || lonCount < 2) {
+        return data::GEOID_HEIGHTS[0][2];
+    }
+
+    const double lat0 = data::GEOID_HEIGHTS[0][0];
+    const double lon0 = data::GEOID_HEIGHTS[0][1];
+    const double latStep = data::GEOID_HEIGHTS[lonCount][0] - lat0;
+    const double lonStep = data::GEOID_HEIGHTS[1][1] - lon0;
+
+    double east = std::fmod(lon - lon0, 360.0);
+    if (east < 0.0) east += 360.0;
+    const double y = std::clamp((lat - lat0) / latStep, 0.0, latCount - 1.0);
+    const double x = std::clamp(east / lonStep, 0.0, lonCount - 1.0);
+    const int r = std::min(static_cast<int>(y), latCount - 2);
+    const int c = std::min(static_cast<int>(x), lonCount - 2);
+    const double fy = y - r;
+    const double fx = x - c;
+
+    auto at = [&](int row, int col) { return data::GEOID_HEIGHTS[row * lonCount + col][2]; };
+    const double south = at(r, c) + fx * (at(r, c + 1) - at(r, c));
+    const double north = at(r + 1, c) + fx * (at(r + 1, c + 1) - at(r + 1, c));
+    return south + fy * (north - south);
+}
+
+} // namespace pixhawk
@@ -1,18 +1,85 @@
 #pragma once
+#include <cstdint>
+#include <string>
+#include "MappedFile.hpp"
+#include "RegionalGrid.hpp"
+
+struct AAssetManager;
 
 namespace pixhawk {
 
+class ThreadPool;
+
+// Geoid undulation (height of the geoid above the WGS84 ellipsoid, meters).
+// Backed by a memory-mapped int16 grid asset (EGM96 15' or EGM2008 5',
+// written by scripts/generate_geoid_grid.py). The repository does not ship
+// that asset; without it the model falls back to the built-in GEOID_HEIGHTS
+// placeholder, nine points that miss the real geoid by over 100 m, so
+// hasGrid() must be true for any use beyond demonstration.
 class GeoidModel {
 public:
+    enum class Interpolation {
+        BILINEAR,
+        BICUBIC
+    };
+
     GeoidModel();
     ~GeoidModel();
-    
+
     bool initialize();
+    // Maps GRID_ASSET if the APK has it; otherwise uses the built-in table
+    bool initialize(AAssetManager* assets);
+    // Maps a grid from the filesystem (e.g. a downloaded higher-resolution model)
+    bool loadGrid(const std::string& path);
+
+    void setInterpolation(Interpolation mode);
+    bool hasGrid() const { return grid != nullptr; }
+
+    // Answer queries from a bilinear grid built around the operating area on
+    // first use. With the default 300 km at 0.05 deg it stays within 1 cm of
+    // the bicubic EGM96 surface at a fraction of the cost.
+    void setRegionalCache(bool enabled) { regionalCache = enabled; }
+    // Size of the regional grid; drops the current one
+    void setRegionalGrid(double radiusKm, double spacing);
+
     double getGeoidHeight(double lat, double lon) const;
     double getGeoidSeparation(double lat, double lon) const;
-    
+    // One separation per point; the pool overload splits large inputs into
+    // chunks run across the workers
+    void getGeoidSeparationBatch(const double* lat, const double* lon, size_t count, double* out) const;
+    void getGeoidSeparationBatch(ThreadPool& pool, const double* lat, const double* lon,
+                                 size_t count, double* out) const;
+
+    static constexpr const char* GRID_ASSET = "geoid/geoid.pxgd";
+
 private:
+    static constexpr size_t PARALLEL_CHUNK = 8192;  // points per pool task
+    static constexpr double DEFAULT_REGION_RADIUS = 300.0;  // km
+    static constexpr double DEFAULT_REGION_SPACING = 0.05;  // degrees
+
     bool initialized = false;
+    Interpolation interpolation = Interpolation::BILINEAR;
+    bool regionalCache = false;
+    RegionalGridCache regionalGrid{DEFAULT_REGION_RADIUS, DEFAULT_REGION_SPACING, 1};
+
+    MappedFile file;
+    const int16_t* grid = nullptr;  // points into the mapping
+    uint32_t rows = 0;
+    uint32_t cols = 0;
+    double northLat = 0.0;
+    double westLon = 0.0;
+    double spacing = 0.0;           // degrees
+    double invSpacing = 0.0;
+    double scale = 0.0;             // meters per count
+    double offset = 0.0;            // meters
+    bool wrapsLongitude = false;
+    bool spansPoles = false;        // global grid with rows at both poles
+
+    bool attachGrid();
+    double modelHeight(double lat, double lon) const;
+    double sample(int64_t row, int64_t col) const;
+    double interpolateGrid(double lat, double lon) const;
+    double interpolateTable(double lat, double lon) const;
 };
 
-} // namespace pixhawk
\ No newline at end of file
+} // namespace pixhawk
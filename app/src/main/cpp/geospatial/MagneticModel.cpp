@@ -1,40 +1,288 @@
 #include "MagneticModel.hpp"
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <ctime>
+#include "ThreadPool.hpp"
+#include "data/WmmCoeffs.inl"
+// Regenerated into the build tree when Python is available, so this is not
+// qualified with data/ (see CMakeLists.txt)
+#include "MagneticFieldTable.inl"
+
+#ifdef PIXHAWKCORE_VERBOSE
+#include <android/log.h>
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, "MagneticModel", __VA_ARGS__)
+#else
+#define LOGE(...)
+#endif
 
 namespace pixhawk {
 
+namespace {
+
+constexpr double DEG_TO_RAD = M_PI / 180.0;
+constexpr double RAD_TO_DEG = 180.0 / M_PI;
+
+constexpr double WGS84_A = 6378.137;                    // km
+constexpr double WGS84_F = 1.0 / 298.257223563;
+constexpr double WGS84_E2 = WGS84_F * (2.0 - WGS84_F);
+constexpr double WMM_REFERENCE_RADIUS = 6371.2;         // km
+
+// Keeps the east component finite at the geographic poles
+constexpr double MIN_COS_LAT = 1e-10;
+
+double currentDecimalYear() {
+    const std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm utc{};
+    gmtime_r(&now, &utc);
+
+    const int year = utc.tm_year + 1900;
+    const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    const double daySeconds = utc.tm_hour * 3600.0 + utc.tm_min * 60.0 + utc.tm_sec;
+    return year + (utc.tm_yday + daySeconds / 86400.0) / (leap ? 366.0 : 365.0);
+}
+
+} // namespace
+
 MagneticModel::MagneticModel() = default;
 MagneticModel::~MagneticModel() = default;
 
 bool MagneticModel::initialize() {
+    if (data::WMM_MAX_DEGREE > MAX_DEGREE) {
+        return false;
+    }
+
+    for (int i = 0; i < data::WMM_COEFFS_COUNT; i++) {
+        const double* row = data::WMM_COEFFS[i];
+        const int n = static_cast<int>(row[0]);
+        const int m = static_cast<int>(row[1]);
+        if (n < 1 || n > MAX_DEGREE || m < 0 || m > n) {
+            return false;
+        }
+        const int k = index(n, m);
+        mainG[k] = row[2];
+        mainH[k] = row[3];
+        rateG[k] = row[4];
+        rateH[k] = row[5];
+    }
+
+    // Recursion factors for the Schmidt semi-normalized functions:
+    //   P(n,n) = sectoral[n] * cos * P(n-1,n-1)
+    //   P(n,m) = recurA * sin * P(n-1,m) - recurB * P(n-2,m)
+    sectoral[0] = 1.0;
+    for (int n = 1; n <= MAX_DEGREE; n++) {
+        sectoral[n] = n == 1 ? 1.0 : std::sqrt(1.0 - 1.0 / (2.0 * n));
+        for (int m = 0; m < n; m++) {
+            const double denom = static_cast<double>(n * n - m * m);
+            recurA[index(n, m)] = (2.0 * n - 1.0) / std::sqrt(denom);
+            recurB[index(n, m)] = std::sqrt(((n - 1) * (n - 1) - m * m) / denom);
+        }
+    }
+
+    setDecimalYear(currentDecimalYear());
     initialized = true;
     return true;
 }
 
+void MagneticModel::setDecimalYear(double year) {
+    dateValid = year >= data::WMM_EPOCH && year <= data::WMM_VALID_UNTIL;
+    if (!dateValid) {
+        LOGE("Date %.2f outside the model's %.1f - %.1f, using the nearest end",
+             year, data::WMM_EPOCH, data::WMM_VALID_UNTIL);
+    }
+    decimalYear = std::clamp(year, data::WMM_EPOCH, data::WMM_VALID_UNTIL);
+    const double dt = decimalYear - data::WMM_EPOCH;
+    for (int k = 0; k < TERM_COUNT; k++) {
+        g[k] = mainG[k] + dt * rateG[k];
+        h[k] = mainH[k] + dt * rateH[k];
+    }
+    regionalGrid.clear();
+}
+
+void MagneticModel::setRegionalGrid(double radiusKm, double spacing) {
+    regionalGrid.configure(radiusKm, spacing);
+}
+
+MagneticField MagneticModel::getField(double lat, double lon, double alt) const {
+    MagneticField field{};
+    if (!initialized) return field;
+
+    // Geodetic to geocentric spherical coordinates
+    const double sinPhi = std::sin(lat * DEG_TO_RAD);
+    const double cosPhi = std::cos(lat * DEG_TO_RAD);
+    const double heightKm = alt * 0.001;
+    const double rc = WGS84_A / std::sqrt(1.0 - WGS84_E2 * sinPhi * sinPhi);
+    const double p = (rc + heightKm) * cosPhi;
+    const double z = (rc * (1.0 - WGS84_E2) + heightKm) * sinPhi;
+    const double r = std::sqrt(p * p + z * z);
+    const double s = z / r;
+    const double c = std::max(p / r, MIN_COS_LAT);
+
+    // Associated Legendre functions and their latitude derivatives, computed
+    // once and shared by all three field components
+    double pnm[TERM_COUNT];
+    double dpnm[TERM_COUNT];
+    pnm[0] = 1.0;
+    dpnm[0] = 0.0;
+    for (int n = 1; n <= MAX_DEGREE; n++) {
+        for (int m = 0; m < n; m++) {
+            const int k = index(n, m);
+            const int k1 = index(n - 1, m);
+            pnm[k] = recurA[k] * s * pnm[k1];
+            dpnm[k] = recurA[k] * (s * dpnm[k1] + c * pnm[k1]);
+            if (n - 2 >= m) {
+                const int k2 = index(n - 2, m);
+                pnm[k] -= recurB[k] * pnm[k2];
+                dpnm[k] -= recurB[k] * dpnm[k2];
+            }
+        }
+        const int kn = index(n, n);
+        const int kp = index(n - 1, n - 1);
+        pnm[kn] = sectoral[n] * c * pnm[kp];
+        dpnm[kn] = sectoral[n] * (c * dpnm[kp] - s * pnm[kp]);
+    }
+
+    // cos(m lon), sin(m lon) by angle addition
+    double cosM[MAX_DEGREE + 1];
+    double sinM[MAX_DEGREE + 1];
+    const double cosLon = std::cos(lon * DEG_TO_RAD);
+    const double sinLon = std::sin(lon * DEG_TO_RAD);
+    cosM[0] = 1.0;
+    sinM[0] = 0.0;
+    for (int m = 1; m <= MAX_DEGREE; m++) {
+        cosM[m] = cosM[m - 1] * cosLon - sinM[m - 1] * sinLon;
+        sinM[m] = sinM[m - 1] * cosLon + cosM[m - 1] * sinLon;
+    }
+
+    // Field in the geocentric north-east-down frame
+    double bx = 0.0, by = 0.0, bz = 0.0;
+    const double ratio = WMM_REFERENCE_RADIUS / r;
+    double radial = ratio * ratio;
+    for (int n = 1; n <= MAX_DEGREE; n++) {
+        radial *= ratio;    // (a/r)^(n+2)
+        for (int m = 0; m <= n; m++) {
+            const int k = index(n, m);
+            const double inPhase = g[k] * cosM[m] + h[k] * sinM[m];
+            const double quadrature = g[k] * sinM[m] - h[k] * cosM[m];
+            bx -= radial * inPhase * dpnm[k];
+            by += radial * m * quadrature * pnm[k];
+            bz -= radial * (n + 1) * inPhase * pnm[k];
+        }
+    }
+    by /= c;
+
+    // Rotate from geocentric to geodetic latitude
+    const double cosPsi = c * cosPhi + s * sinPhi;
+    const double sinPsi = s * cosPhi - c * sinPhi;
+    field.north = bx * cosPsi - bz * sinPsi;
+    field.east = by;
+    field.down = bx * sinPsi + bz * cosPsi;
+
+    field.horizontal = std::sqrt(field.north * field.north + field.east * field.east);
+    field.intensity = std::sqrt(field.horizontal * field.horizontal + field.down * field.down);
+    field.declination = std::atan2(field.east, field.north) * RAD_TO_DEG;
+    field.inclination = std::atan2(field.down, field.horizontal) * RAD_TO_DEG;
+    return field;
+}
+
+void MagneticModel::getFieldBatch(const double* lat, const double* lon, const double* alt,
+                                  size_t count, MagneticField* out) const {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = getField(lat[i], lon[i], alt ? alt[i] : 0.0);
+    }
+}
+
 double MagneticModel::getDeclination(double lat, double lon, double alt) const {
-    if (!initialized) return 0.0;
-    
-    // Simplified magnetic declination approximation
-    // Real implementation would use WMM coefficients
-    double dlat = lat * M_PI / 180.0;
-    double dlon = lon * M_PI / 180.0;
-    
-    return 15.0 * std::sin(dlat) * std::cos(dlon * 2.0) + 2.0 * std::cos(dlat);
+    if (initialized && alt == 0.0) {
+        if (lookupMode == LookupMode::REGIONAL) {
+            auto grid = regionalGrid.acquire(lat, lon, [this](double la, double lo, float* v) {
+                sampleNorthEast(la, lo, v);
+            });
+            if (grid) return regionalDeclination(*grid, lat, lon);
+        } else if (lookupMode == LookupMode::GLOBAL_TABLE) {
+            return tableDeclination(lat, lon);
+        }
+    }
+    return getField(lat, lon, alt).declination;
+}
+
+void MagneticModel::getDeclinationBatch(const double* lat, const double* lon, const double* alt,
+                                        size_t count, double* out) const {
+    if (lookupMode == LookupMode::REGIONAL && !alt && initialized && count > 0) {
+        // One grid for the whole batch: a track leaving the area falls back
+        // to the model rather than rebuilding the grid point by point
+        auto grid = regionalGrid.acquire(lat[0], lon[0], [this](double la, double lo, float* v) {
+            sampleNorthEast(la, lo, v);
+        });
+        for (size_t i = 0; i < count; i++) {
+            out[i] = grid && grid->contains(lat[i], lon[i]) ? regionalDeclination(*grid, lat[i], lon[i])
+                                                           : getField(lat[i], lon[i]).declination;
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        out[i] = getDeclination(lat[i], lon[i], alt ? alt[i] : 0.0);
+    }
+}
+
+void MagneticModel::getDeclinationBatch(ThreadPool& pool, const double* lat, const double* lon, const double* alt,
+                                        size_t count, double* out) const {
+    const size_t chunks = (count + PARALLEL_CHUNK - 1) / PARALLEL_CHUNK;
+    pool.parallelFor(chunks, [&](size_t c) {
+        const size_t offset = c * PARALLEL_CHUNK;
+        const size_t n = std::min(PARALLEL_CHUNK, count - offset);
+        getDeclinationBatch(lat + offset, lon + offset, alt ? alt + offset : nullptr, n, out + offset);
+    });
 }
 
 double MagneticModel::getInclination(double lat, double lon, double alt) const {
-    if (!initialized) return 0.0;
-    
-    // Simplified magnetic inclination
-    return 60.0 * std::sin(lat * M_PI / 180.0);
+    return getField(lat, lon, alt).inclination;
 }
 
 double MagneticModel::getIntensity(double lat, double lon, double alt) const {
-    if (!initialized) return 50000.0; // nT
-    
-    // Simplified total field intensity
-    double dlat = lat * M_PI / 180.0;
-    return 50000.0 + 5000.0 * std::cos(dlat);
+    return getField(lat, lon, alt).intensity;
+}
+
+// The grids hold the north and east components rather than the angle, so
+// interpolation stays continuous where declination wraps through +-180
+void MagneticModel::sampleNorthEast(double lat, double lon, float* values) const {
+    const MagneticField field = getField(lat, lon);
+    values[0] = static_cast<float>(field.north);
+    values[1] = static_cast<float>(field.east);
+}
+
+double MagneticModel::regionalDeclination(const RegionalGrid& grid, double lat, double lon) {
+    double northEast[2];
+    grid.interpolate(lat, lon, northEast);
+    return std::atan2(northEast[1], northEast[0]) * RAD_TO_DEG;
+}
+
+double MagneticModel::tableDeclination(double lat, double lon) const {
+    const double years = decimalYear - data::MAG_TABLE_EPOCH;
+    const double y = std::clamp((90.0 - lat) / data::MAG_TABLE_SPACING, 0.0, data::MAG_TABLE_ROWS - 1.0);
+    double x = (lon + 180.0) / data::MAG_TABLE_SPACING;
+    if (x < 0.0 || x >= data::MAG_TABLE_COLS) {
+        x -= data::MAG_TABLE_COLS * std::floor(x / data::MAG_TABLE_COLS);
+    }
+
+    const int r = std::min(static_cast<int>(y), data::MAG_TABLE_ROWS - 2);
+    const int c = std::min(static_cast<int>(x), data::MAG_TABLE_COLS - 1);
+    const int c1 = (c + 1) % data::MAG_TABLE_COLS;
+    const double fy = y - r;
+    const double fx = x - c;
+
+    const int nodes[4] = {r * data::MAG_TABLE_COLS + c, r * data::MAG_TABLE_COLS + c1,
+                          (r + 1) * data::MAG_TABLE_COLS + c, (r + 1) * data::MAG_TABLE_COLS + c1};
+    const double weights[4] = {(1.0 - fy) * (1.0 - fx), (1.0 - fy) * fx, fy * (1.0 - fx), fy * fx};
+    double north = 0.0;
+    double east = 0.0;
+    for (int i = 0; i < 4; i++) {
+        const float* node = data::MAG_TABLE[nodes[i]];
+        north += weights[i] * (node[0] + years * node[2]);
+        east += weights[i] * (node[1] + years * node[3]);
+    }
+    return std::atan2(east, north) * RAD_TO_DEG;
 }
 
-} // namespace pixhawk
\ No newline at end of file
+} // namespace pixhawk
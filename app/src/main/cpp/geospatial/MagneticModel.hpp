@@ -1,19 +1,108 @@
 #pragma once
+#include <cstddef>
+#include "RegionalGrid.hpp"
 
 namespace pixhawk {
 
+class ThreadPool;
+
+// Geomagnetic field at one point, in the local north-east-down frame
+struct MagneticField {
+    double north, east, down;   // nT
+    double horizontal;          // nT
+    double intensity;           // nT, total field
+    double declination;         // degrees, east positive
+    double inclination;         // degrees, down positive
+};
+
+// World Magnetic Model (degree 12) evaluator. Positions are WGS84 geodetic
+// latitude/longitude in degrees and height above the ellipsoid in meters.
 class MagneticModel {
 public:
+    // How declination queries on the ellipsoid (alt == 0) are answered;
+    // queries at other heights always evaluate the model.
+    //   MODEL         full spherical harmonic evaluation (~0.6 us)
+    //   REGIONAL      bilinear lookup in a grid built around the operating
+    //                 area on first use (default 300 km at 0.1 deg): within
+    //                 0.001 deg of the model more than 8 deg from the magnetic
+    //                 poles (near 86N 144E and 64S 136E in 2023), 0.002 deg at
+    //                 3 deg and 0.008 deg at 1 deg from the north one; at the
+    //                 poles themselves declination is undefined
+    //   GLOBAL_TABLE  bilinear lookup in the built-in 5 deg table: within
+    //                 0.35 deg between 60S and 60N, several degrees closer
+    //                 to the magnetic poles
+    enum class LookupMode {
+        MODEL,
+        REGIONAL,
+        GLOBAL_TABLE
+    };
+
     MagneticModel();
     ~MagneticModel();
-    
+
     bool initialize();
+
+    // Model date as a decimal year; initialize() sets the current date.
+    // Secular variation is extrapolated linearly from the model epoch, but
+    // not past the model's validity window: a date outside it is clamped to
+    // the nearest end and isDateValid() returns false until a date inside
+    // is set. Then the coefficients need replacing with a newer model.
+    void setDecimalYear(double year);
+    double getDecimalYear() const { return decimalYear; }   // after clamping
+    bool isDateValid() const { return dateValid; }
+
+    void setLookupMode(LookupMode mode) { lookupMode = mode; }
+    LookupMode getLookupMode() const { return lookupMode; }
+    // Size of the REGIONAL grid; drops the current one
+    void setRegionalGrid(double radiusKm, double spacing);
+
+    // All field components from one Legendre evaluation
+    MagneticField getField(double lat, double lon, double alt = 0.0) const;
+    // 'alt' may be null for points on the ellipsoid
+    void getFieldBatch(const double* lat, const double* lon, const double* alt,
+                       size_t count, MagneticField* out) const;
+
     double getDeclination(double lat, double lon, double alt = 0.0) const;
+    // Declination in degrees for each point; 'alt' may be null. The pool
+    // overload splits large inputs into chunks run across the workers.
+    void getDeclinationBatch(const double* lat, const double* lon, const double* alt,
+                             size_t count, double* out) const;
+    void getDeclinationBatch(ThreadPool& pool, const double* lat, const double* lon, const double* alt,
+                             size_t count, double* out) const;
     double getInclination(double lat, double lon, double alt = 0.0) const;
     double getIntensity(double lat, double lon, double alt = 0.0) const;
-    
+
 private:
+    static constexpr int MAX_DEGREE = 12;
+    static constexpr int TERM_COUNT = (MAX_DEGREE + 1) * (MAX_DEGREE + 2) / 2;
+    static constexpr size_t PARALLEL_CHUNK = 1024;  // points per pool task
+    static constexpr double DEFAULT_REGION_RADIUS = 300.0;  // km
+    static constexpr double DEFAULT_REGION_SPACING = 0.1;   // degrees
+
     bool initialized = false;
+    double decimalYear = 0.0;
+    bool dateValid = false;
+    LookupMode lookupMode = LookupMode::MODEL;
+    RegionalGridCache regionalGrid{DEFAULT_REGION_RADIUS, DEFAULT_REGION_SPACING, 2};
+
+    // Indexed by n * (n + 1) / 2 + m
+    double mainG[TERM_COUNT] = {};
+    double mainH[TERM_COUNT] = {};
+    double rateG[TERM_COUNT] = {};
+    double rateH[TERM_COUNT] = {};
+    double g[TERM_COUNT] = {};      // at decimalYear
+    double h[TERM_COUNT] = {};
+
+    // Schmidt semi-normalized Legendre recursion factors
+    double recurA[TERM_COUNT] = {};
+    double recurB[TERM_COUNT] = {};
+    double sectoral[MAX_DEGREE + 1] = {};
+
+    static constexpr int index(int n, int m) { return n * (n + 1) / 2 + m; }
+
+    static double regionalDeclination(const RegionalGrid& grid, double lat, double lon);
+    double tableDeclination(double lat, double lon) const;
+    void sampleNorthEast(double lat, double lon, float* values) const;
 };
 
-} // namespace pixhawk
\ No newline at end of file
+} // namespace pixhawk
@@ -0,0 +1,129 @@
+#include "RegionalGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+#ifdef PIXHAWKCORE_VERBOSE
+#include <android/log.h>
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, "RegionalGrid", __VA_ARGS__)
+#else
+#define LOGI(...)
+#endif
+
+namespace pixhawk {
+
+namespace {
+
+constexpr double DEG_TO_RAD = M_PI / 180.0;
+
+// Lower bounds of a degree's length, so the grid never falls short of the radius
+constexpr double KM_PER_DEG_LAT = 110.5;
+constexpr double KM_PER_DEG_LON_EQUATOR = 111.3;
+
+double wrapLongitude(double lon) {
+    lon = std::fmod(lon + 180.0, 360.0);
+    return (lon < 0.0 ? lon + 360.0 : lon) - 180.0;
+}
+
+} // namespace
+
+RegionalGrid::RegionalGrid(double centerLat, double centerLon, double radiusKm, double spacing,
+                           int channels, const Sampler& sampler)
+    : spacing(spacing), invSpacing(1.0 / spacing), channels(channels) {
+    const double latHalf = radiusKm / KM_PER_DEG_LAT;
+    northLat = std::min(centerLat + latHalf, 90.0);
+    const double southLat = std::max(centerLat - latHalf, -90.0);
+    rows = std::max(2, static_cast<int>(std::ceil((northLat - southLat) * invSpacing)) + 1);
+
+    // Longitude extent at the grid's widest-spread latitude; near the poles
+    // the grid wraps all the way around
+    const double cosLat = std::cos(std::max(std::fabs(northLat), std::fabs(southLat)) * DEG_TO_RAD);
+    const double lonHalf = cosLat > 0.0 ? radiusKm / (KM_PER_DEG_LON_EQUATOR * cosLat) : 360.0;
+    if (2.0 * lonHalf >= 360.0 - spacing) {
+        westLon = -180.0;
+        cols = static_cast<int>(std::ceil(360.0 * invSpacing)) + 1;
+    } else {
+        westLon = wrapLongitude(centerLon - lonHalf);
+        cols = std::max(2, static_cast<int>(std::ceil(2.0 * lonHalf * invSpacing)) + 1);
+    }
+
+    values.resize(static_cast<size_t>(rows) * static_cast<size_t>(cols) * static_cast<size_t>(channels));
+    float* node = values.data();
+    for (int r = 0; r < rows; r++) {
+        const double lat = std::max(northLat - r * spacing, -90.0);
+        for (int c = 0; c < cols; c++) {
+            sampler(lat, wrapLongitude(westLon + c * spacing), node);
+            node += channels;
+        }
+    }
+    LOGI("Built %d x %d grid around %.3f, %.3f", rows, cols, centerLat, centerLon);
+}
+
+double RegionalGrid::eastOffset(double lon) const {
+    double offset = lon - westLon;
+    if (offset < 0.0 || offset >= 360.0) {
+        offset -= 360.0 * std::floor(offset / 360.0);
+    }
+    return offset;
+}
+
+bool RegionalGrid::contains(double lat, double lon) const {
+    return lat <= northLat && lat >= northLat - (rows - 1) * spacing &&
+           eastOffset(lon) <= (cols - 1) * spacing;
+}
+
+void RegionalGrid::interpolate(double lat, double lon, double* out) const {
+    const double y = (northLat - lat) * invSpacing;
+    const double x = eastOffset(lon) * invSpacing;
+    const int r = std::clamp(static_cast<int>(y), 0, rows - 2);
+    const int c = std::clamp(static_cast<int>(x), 0, cols - 2);
+    const double fy = y - r;
+    const double fx = x - c;
+
+    const size_t rowStride = static_cast<size_t>(cols) * static_cast<size_t>(channels);
+    const float* n0 = values.data() + static_cast<size_t>(r) * rowStride + static_cast<size_t>(c) * static_cast<size_t>(channels);
+    const float* n1 = n0 + rowStride;
+    for (int k = 0; k < channels; k++) {
+        const double top = n0[k] + fx * (n0[k + channels] - n0[k]);
+        const double bottom = n1[k] + fx * (n1[k + channels] - n1[k]);
+        out[k] = top + fy * (bottom - top);
+    }
+}
+
+RegionalGridCache::RegionalGridCache(double radiusKm, double spacing, int channels)
+    : radiusKm(radiusKm), spacing(spacing), channels(channels) {}
+
+void RegionalGridCache::configure(double newRadiusKm, double newSpacing) {
+    std::lock_guard<std::mutex> lock(buildMutex);
+    radiusKm = newRadiusKm;
+    spacing = newSpacing;
+    std::atomic_store(&grid, std::shared_ptr<const RegionalGrid>());
+}
+
+void RegionalGridCache::clear() {
+    // Waits out a build in progress so a stale grid cannot be stored after this
+    std::lock_guard<std::mutex> lock(buildMutex);
+    std::atomic_store(&grid, std::shared_ptr<const RegionalGrid>());
+}
+
+std::shared_ptr<const RegionalGrid> RegionalGridCache::acquire(double lat, double lon,
+                                                               const RegionalGrid::Sampler& sampler) const {
+    std::shared_ptr<const RegionalGrid> existing = std::atomic_load(&grid);
+    if (existing && existing->contains(lat, lon)) return existing;
+
+    std::unique_lock<std::mutex> lock(buildMutex, std::try_to_lock);
+    if (!lock.owns_lock()) return nullptr;
+
+    // Another thread may have built a covering grid while we checked
+    existing = std::atomic_load(&grid);
+    if (existing && existing->contains(lat, lon)) return existing;
+
+    auto built = std::make_shared<const RegionalGrid>(lat, lon, radiusKm, spacing, channels, sampler);
+    std::atomic_store(&grid, std::shared_ptr<const RegionalGrid>(built));
+    return built;
+}
+
+std::shared_ptr<const RegionalGrid> RegionalGridCache::current() const {
+    return std::atomic_load(&grid);
+}
+
+} // namespace pixhawk
@@ -0,0 +1,60 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace pixhawk {
+
+// Dense lat/lon grid of model values around an operating area, sampled once
+// from the full model and then read by bilinear interpolation. Each node
+// holds 'channels' values so vector quantities interpolate component-wise.
+class RegionalGrid {
+public:
+    using Sampler = std::function<void(double lat, double lon, float* values)>;
+
+    // Covers at least 'radiusKm' around the center at 'spacing' degrees
+    RegionalGrid(double centerLat, double centerLon, double radiusKm, double spacing,
+                 int channels, const Sampler& sampler);
+
+    bool contains(double lat, double lon) const;
+    // Requires contains(lat, lon); writes 'channels' values
+    void interpolate(double lat, double lon, double* values) const;
+
+private:
+    double northLat = 0.0;
+    double westLon = 0.0;
+    double spacing = 0.0;
+    double invSpacing = 0.0;
+    int rows = 0;
+    int cols = 0;
+    int channels = 0;
+    std::vector<float> values;      // row-major from north, channels interleaved
+
+    double eastOffset(double lon) const;
+};
+
+// The grid for the current operating area, shared between threads. When a
+// query falls outside it a new grid is built around the query point; while
+// one thread builds, the others get null and use the full model.
+class RegionalGridCache {
+public:
+    RegionalGridCache(double radiusKm, double spacing, int channels);
+
+    // Drops the current grid; the next acquire builds one with the new size
+    void configure(double radiusKm, double spacing);
+    void clear();
+
+    std::shared_ptr<const RegionalGrid> acquire(double lat, double lon, const RegionalGrid::Sampler& sampler) const;
+    // The current grid without building; may be null or not cover a point
+    std::shared_ptr<const RegionalGrid> current() const;
+
+private:
+    mutable std::mutex buildMutex;
+    double radiusKm;                // guarded by buildMutex
+    double spacing;
+    const int channels;
+    mutable std::shared_ptr<const RegionalGrid> grid;   // atomic_load/atomic_store only
+};
+
+} // namespace pixhawk
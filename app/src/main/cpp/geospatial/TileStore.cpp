@@ -0,0 +1,268 @@
+#include "TileStore.hpp"
+#include <algorithm>
+#include <android/asset_manager.h>
+#include <cmath>
+#include <cstring>
+#include "Crc32.hpp"
+
+#ifdef PIXHAWKCORE_VERBOSE
+#include <android/log.h>
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, "TileStore", __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, "TileStore", __VA_ARGS__)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#endif
+
+namespace pixhawk {
+
+namespace {
+
+// Block header layout, little endian:
+//   0  u32 magic 'PIXH'     4  u32 block index     8  u32 block size
+//  16  u64 timestamp (ms)  32  f64 latitude       40  f64 longitude
+// 128  u32 CRC32 of the whole block with these four bytes left out
+// The remaining fields carry sensor samples the store does not use.
+constexpr uint32_t BLOCK_MAGIC = 0x50495848;    // "PIXH"
+constexpr size_t CRC_OFFSET = 128;
+constexpr char CHUNK_PREFIX[] = "map_tiles_chunk_";
+constexpr char CHUNK_SUFFIX[] = ".bin";
+
+constexpr double PI = 3.14159265358979323846;
+constexpr double MAX_MERCATOR_LAT = 85.05112878;
+
+template <typename T>
+T readField(const uint8_t* p, size_t offset) {
+    T value;
+    std::memcpy(&value, p + offset, sizeof(T));
+    return value;
+}
+
+bool isChunkName(const std::string& name) {
+    const size_t prefix = sizeof(CHUNK_PREFIX) - 1;
+    const size_t suffix = sizeof(CHUNK_SUFFIX) - 1;
+    return name.size() > prefix + suffix &&
+           name.compare(0, prefix, CHUNK_PREFIX) == 0 &&
+           name.compare(name.size() - suffix, suffix, CHUNK_SUFFIX) == 0;
+}
+
+uint32_t blockCrc(const uint8_t* block) {
+    const uint32_t head = crc32(0, block, CRC_OFFSET);
+    return crc32(head, block + CRC_OFFSET + 4, TileStore::BLOCK_SIZE - CRC_OFFSET - 4);
+}
+
+} // namespace
+
+TileStore::TileStore(int zoom) : zoom(std::clamp(zoom, 0, MAX_ZOOM)) {}
+
+TileStore::~TileStore() = default;
+
+bool TileStore::addChunk(AAssetManager* assets, const std::string& name) {
+    MappedFile file;
+    if (!file.openAsset(assets, name)) {
+        LOGE("Cannot open tile chunk %s", name.c_str());
+        return false;
+    }
+    if (!indexChunk(std::move(file))) {
+        LOGE("No tiles in chunk %s", name.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool TileStore::addChunkFile(const std::string& path) {
+    MappedFile file;
+    if (!file.openFile(path)) {
+        LOGE("Cannot open tile chunk %s", path.c_str());
+        return false;
+    }
+    if (!indexChunk(std::move(file))) {
+        LOGE("No tiles in chunk %s", path.c_str());
+        return false;
+    }
+    return true;
+}
+
+size_t TileStore::addChunks(AAssetManager* assets, const std::string& directory) {
+    if (!assets) return 0;
+    AAssetDir* dir = AAssetManager_openDir(assets, directory.c_str());
+    if (!dir) return 0;
+
+    std::vector<std::string> names;
+    while (const char* name = AAssetDir_getNextFileName(dir)) {
+        if (isChunkName(name)) names.emplace_back(name);
+    }
+    AAssetDir_close(dir);
+
+    // Listing order is unspecified; sort so equal timestamps always resolve
+    // to the same block
+    std::sort(names.begin(), names.end());
+    size_t added = 0;
+    for (const auto& name : names) {
+        if (addChunk(assets, directory.empty() ? name : directory + "/" + name)) added++;
+    }
+    return added;
+}
+
+void TileStore::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    tiles.clear();
+    tileIndex.clear();
+    blocks.clear();
+    chunks.clear();
+}
+
+void TileStore::setCacheCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex);
+    cacheCapacity = std::max<size_t>(capacity, 1);
+    while (tiles.size() > cacheCapacity) {
+        tileIndex.erase(tiles.back().key);
+        tiles.pop_back();
+    }
+}
+
+TileStore::Stats TileStore::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return {chunks.size(), blocks.size(), tiles.size(), hits, misses, corrupt};
+}
+
+void TileStore::tileAt(int zoom, double lat, double lon, int& x, int& y) {
+    const double n = std::ldexp(1.0, zoom);
+    const double latRad = std::clamp(lat, -MAX_MERCATOR_LAT, MAX_MERCATOR_LAT) * PI / 180.0;
+    const double fx = (lon + 180.0) / 360.0 * n;
+    const double fy = (1.0 - std::asinh(std::tan(latRad)) / PI) * 0.5 * n;
+    x = static_cast<int>(std::clamp(std::floor(fx), 0.0, n - 1.0));
+    y = static_cast<int>(std::clamp(std::floor(fy), 0.0, n - 1.0));
+}
+
+uint64_t TileStore::tileKey(int x, int y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+bool TileStore::indexChunk(MappedFile&& file) {
+    const uint8_t* data = file.data();
+    const size_t blockCount = std::min<size_t>(file.size(), UINT32_MAX) / BLOCK_SIZE;
+
+    // Every header sits on its own page, so the scan touches the whole file
+    file.adviseWillNeed();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto chunk = static_cast<uint32_t>(chunks.size());
+    size_t indexed = 0;
+    for (size_t i = 0; i < blockCount; i++) {
+        const uint8_t* block = data + i * BLOCK_SIZE;
+        if (readField<uint32_t>(block, 0) != BLOCK_MAGIC || readField<uint32_t>(block, 8) != BLOCK_SIZE) {
+            continue;
+        }
+        const double lat = readField<double>(block, 32);
+        const double lon = readField<double>(block, 40);
+        if (!(lat >= -90.0 && lat <= 90.0 && lon >= -180.0 && lon <= 180.0)) continue;
+
+        int x, y;
+        tileAt(zoom, lat, lon, x, y);
+        const uint64_t key = tileKey(x, y);
+        const BlockRef ref{chunk, static_cast<uint32_t>(i * BLOCK_SIZE), readField<int64_t>(block, 16), false};
+
+        auto [it, inserted] = blocks.emplace(key, ref);
+        if (!inserted) {
+            if (ref.timestamp_ms <= it->second.timestamp_ms) continue;
+            it->second = ref;
+            // A newer block replaces the decoded copy of the old one
+            auto cached = tileIndex.find(key);
+            if (cached != tileIndex.end()) {
+                tiles.erase(cached->second);
+                tileIndex.erase(cached);
+            }
+        }
+        indexed++;
+    }
+    if (indexed == 0) return false;
+
+    // From here on, reads follow the map view rather than the file
+    file.adviseRandomAccess();
+    chunks.push_back(std::move(file));
+    LOGI("Indexed %zu tiles of %zu blocks at zoom %d", indexed, blockCount, zoom);
+    return true;
+}
+
+// Caller holds mutex
+std::shared_ptr<const MapTile> TileStore::decode(uint64_t key, BlockRef& block) const {
+    const uint8_t* p = chunks[block.chunk].data() + block.offset;
+    if (blockCrc(p) != readField<uint32_t>(p, CRC_OFFSET)) {
+        block.corrupt = true;
+        corrupt++;
+        LOGE("CRC mismatch in tile block at %u of chunk %u", block.offset, block.chunk);
+        return nullptr;
+    }
+
+    auto tile = std::make_shared<MapTile>();
+    tile->zoom = zoom;
+    tile->x = static_cast<int>(key >> 32);
+    tile->y = static_cast<int>(key & 0xFFFFFFFFu);
+    tile->blockIndex = readField<uint32_t>(p, 4);
+    tile->timestamp_ms = block.timestamp_ms;
+    tile->lat = readField<double>(p, 32);
+    tile->lon = readField<double>(p, 40);
+    tile->data.assign(p + HEADER_SIZE, p + BLOCK_SIZE);
+    return tile;
+}
+
+std::shared_ptr<const MapTile> TileStore::getTile(int x, int y) const {
+    const uint64_t key = tileKey(x, y);
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto cached = tileIndex.find(key);
+    if (cached != tileIndex.end()) {
+        hits++;
+        tiles.splice(tiles.begin(), tiles, cached->second);
+        return cached->second->tile;
+    }
+    misses++;
+
+    auto found = blocks.find(key);
+    if (found == blocks.end() || found->second.corrupt) return nullptr;
+    std::shared_ptr<const MapTile> tile = decode(key, found->second);
+    if (!tile) return nullptr;
+
+    // Decoded tiles own their payload, so evicting one or clearing the
+    // store never invalidates a tile a caller still holds
+    if (tiles.size() >= cacheCapacity) {
+        tileIndex.erase(tiles.back().key);
+        tiles.pop_back();
+    }
+    tiles.push_front({key, tile});
+    tileIndex[key] = tiles.begin();
+    return tile;
+}
+
+std::shared_ptr<const MapTile> TileStore::getTileAt(double lat, double lon) const {
+    int x, y;
+    tileAt(zoom, lat, lon, x, y);
+    return getTile(x, y);
+}
+
+size_t TileStore::prefetch(double south, double west, double north, double east) const {
+    int x0, y0, x1, y1;
+    tileAt(zoom, north, west, x0, y0);
+    tileAt(zoom, south, east, x1, y1);
+    if (x1 < x0 || y1 < y0) return 0;
+    const size_t area = static_cast<size_t>(x1 - x0 + 1) * static_cast<size_t>(y1 - y0 + 1);
+    if (area > MAX_PREFETCH_TILES) return 0;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t covered = 0;
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++) {
+            const uint64_t key = tileKey(x, y);
+            auto found = blocks.find(key);
+            if (found == blocks.end() || found->second.corrupt) continue;
+            covered++;
+            if (!tileIndex.count(key)) {
+                chunks[found->second.chunk].adviseWillNeed(found->second.offset, BLOCK_SIZE);
+            }
+        }
+    }
+    return covered;
+}
+
+} // namespace pixhawk
@@ -0,0 +1,114 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "MappedFile.hpp"
+
+struct AAssetManager;
+
+namespace pixhawk {
+
+struct MapTile {
+    int zoom;
+    int x;
+    int y;
+    uint32_t blockIndex;        // within its chunk, from the block header
+    int64_t timestamp_ms;
+    double lat;
+    double lon;
+    std::vector<uint8_t> data;  // TileStore::PAYLOAD_SIZE bytes
+};
+
+// Offline map tiles from PIXH chunk files (map_tiles_chunk_*.bin). A chunk
+// is a run of 4096-byte blocks, each a 256-byte header followed by one
+// tile's payload; the header carries the tile position and a CRC32 of the
+// block. Chunks are memory-mapped and only their headers are read on open
+// to index each block under the Web Mercator tile (zoom, x, y) containing
+// its position, at the store's zoom level. Payloads are checked against
+// their CRC when first decoded and decoded tiles are kept in a bounded LRU
+// cache, so a tile already on screen costs a hash lookup.
+class TileStore {
+public:
+    static constexpr size_t BLOCK_SIZE = 4096;
+    static constexpr size_t HEADER_SIZE = 256;
+    static constexpr size_t PAYLOAD_SIZE = BLOCK_SIZE - HEADER_SIZE;
+    static constexpr int DEFAULT_ZOOM = 16;
+    static constexpr int MAX_ZOOM = 24;
+
+    struct Stats {
+        size_t chunks;
+        size_t tiles;           // indexed
+        size_t cached;
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t corrupt;       // blocks that failed their CRC check
+    };
+
+    explicit TileStore(int zoom = DEFAULT_ZOOM);
+    ~TileStore();
+
+    // Map a chunk and index its blocks; false if it cannot be opened or
+    // holds no block newer than those already indexed. A tile found in
+    // several blocks resolves to the one with the newest timestamp.
+    bool addChunk(AAssetManager* assets, const std::string& name);
+    bool addChunkFile(const std::string& path);
+    // Every map_tiles_chunk_*.bin asset in 'directory'; returns how many
+    // were added
+    size_t addChunks(AAssetManager* assets, const std::string& directory);
+    void clear();
+    void setCacheCapacity(size_t tiles);
+
+    int getZoom() const { return zoom; }
+    Stats getStats() const;
+
+    static void tileAt(int zoom, double lat, double lon, int& x, int& y);
+
+    // Null when no block holds the tile or its block is corrupt
+    std::shared_ptr<const MapTile> getTile(int x, int y) const;
+    std::shared_ptr<const MapTile> getTileAt(double lat, double lon) const;
+
+    // Start paging in the blocks of every tile overlapping the box, e.g. the
+    // view plus a margin while panning, so later getTile calls do not wait
+    // on storage. Returns how many tiles it covers.
+    size_t prefetch(double south, double west, double north, double east) const;
+
+private:
+    struct BlockRef {
+        uint32_t chunk;
+        uint32_t offset;        // of the block in the chunk, in bytes
+        int64_t timestamp_ms;
+        bool corrupt;           // set once its CRC check failed
+    };
+
+    struct CachedTile {
+        uint64_t key;
+        std::shared_ptr<const MapTile> tile;
+    };
+
+    static constexpr size_t DEFAULT_CACHE_TILES = 256;     // 1 MB of payloads
+    static constexpr size_t MAX_PREFETCH_TILES = 4096;
+
+    const int zoom;
+    size_t cacheCapacity = DEFAULT_CACHE_TILES;
+
+    mutable std::mutex mutex;
+    std::vector<MappedFile> chunks;
+    mutable std::unordered_map<uint64_t, BlockRef> blocks;
+    // Most recently used first
+    mutable std::list<CachedTile> tiles;
+    mutable std::unordered_map<uint64_t, std::list<CachedTile>::iterator> tileIndex;
+    mutable uint64_t hits = 0;
+    mutable uint64_t misses = 0;
+    mutable uint64_t corrupt = 0;
+
+    static uint64_t tileKey(int x, int y);
+    bool indexChunk(MappedFile&& file);
+    std::shared_ptr<const MapTile> decode(uint64_t key, BlockRef& block) const;
+};
+
+} // namespace pixhawk
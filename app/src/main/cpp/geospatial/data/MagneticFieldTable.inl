@@ -0,0 +1,2681 @@
+// Coarse global magnetic field table, generated by
+// scripts/generate_magnetic_table.py from WmmCoeffs.inl. Do not edit.
+// Rows run north to south from 90 degrees, columns east from -180 degrees.
+namespace pixhawk {
+namespace data {
+
+const double MAG_TABLE_EPOCH = 2020.0;
+const double MAG_TABLE_SPACING = 5.0;
+const int MAG_TABLE_ROWS = 37;
+const int MAG_TABLE_COLS = 72;
+
+const float MAG_TABLE[][4] = {
+    // north, east (nT), d_north, d_east (nT/year)
+    {-1824.1f, -116.6f, 27.87f, -63.64f},
+    {-1807.0f, -275.1f, 33.31f, -60.97f},
+    {-1776.2f, -431.6f, 38.50f, -57.83f},
+    {-1731.8f, -584.7f, 43.39f, -54.26f},
+    {-1674.3f, -733.4f, 47.96f, -50.27f},
+    {-1604.0f, -876.6f, 52.15f, -45.90f},
+    {-1521.5f, -1013.0f, 55.96f, -41.18f},
+    {-1427.4f, -1141.8f, 59.33f, -36.14f},
+    {-1322.4f, -1261.8f, 62.26f, -30.83f},
+    {-1207.4f, -1372.3f, 64.71f, -25.29f},
+    {-1083.2f, -1472.3f, 66.66f, -19.56f},
+    {-950.8f, -1561.1f, 68.12f, -13.67f},
+    {-811.1f, -1638.0f, 69.05f, -7.68f},
+    {-665.3f, -1702.5f, 69.45f, -1.64f},
+    {-514.3f, -1754.0f, 69.33f, 4.42f},
+    {-359.5f, -1792.2f, 68.68f, 10.45f},
+    {-201.9f, -1816.7f, 67.51f, 16.40f},
+    {-42.8f, -1827.4f, 65.83f, 22.22f},
+    {116.6f, -1824.1f, 63.64f, 27.87f},
+    {275.1f, -1807.0f, 60.97f, 33.31f},
+    {431.6f, -1776.2f, 57.83f, 38.50f},
+    {584.7f, -1731.8f, 54.26f, 43.39f},
+    {733.4f, -1674.3f, 50.27f, 47.96f},
+    {876.6f, -1604.0f, 45.90f, 52.15f},
+    {1013.0f, -1521.5f, 41.18f, 55.96f},
+    {1141.8f, -1427.4f, 36.14f, 59.33f},
+    {1261.8f, -1322.4f, 30.83f, 62.26f},
+    {1372.3f, -1207.4f, 25.29f, 64.71f},
+    {1472.3f, -1083.2f, 19.56f, 66.66f},
+    {1561.1f, -950.8f, 13.67f, 68.12f},
+    {1638.0f, -811.1f, 7.68f, 69.05f},
+    {1702.5f, -665.3f, 1.64f, 69.45f},
+    {1754.0f, -514.3f, -4.42f, 69.33f},
+    {1792.2f, -359.5f, -10.45f, 68.68f},
+    {1816.7f, -201.9f, -16.40f, 67.51f},
+    {1827.4f, -42.8f, -22.22f, 65.83f},
+    {1824.1f, 116.6f, -27.87f, 63.64f},
+    {1807.0f, 275.1f, -33.31f, 60.97f},
+    {1776.2f, 431.6f, -38.50f, 57.83f},
+    {1731.8f, 584.7f, -43.39f, 54.26f},
+    {1674.3f, 733.4f, -47.96f, 50.27f},
+    {1604.0f, 876.6f, -52.15f, 45.90f},
+    {1521.5f, 1013.0f, -55.96f, 41.18f},
+    {1427.4f, 1141.8f, -59.33f, 36.14f},
+    {1322.4f, 1261.8f, -62.26f, 30.83f},
+    {1207.4f, 1372.3f, -64.71f, 25.29f},
+    {1083.2f, 1472.3f, -66.66f, 19.56f},
+    {950.8f, 1561.1f, -68.12f, 13.67f},
+    {811.1f, 1638.0f, -69.05f, 7.68f},
+    {665.3f, 1702.5f, -69.45f, 1.64f},
+    {514.3f, 1754.0f, -69.33f, -4.42f},
+    {359.5f, 1792.2f, -68.68f, -10.45f},
+    {201.9f, 1816.7f, -67.51f, -16.40f},
+    {42.8f, 1827.4f, -65.83f, -22.22f},
+    {-116.6f, 1824.1f, -63.64f, -27.87f},
+    {-275.1f, 1807.0f, -60.97f, -33.31f},
+    {-431.6f, 1776.2f, -57.83f, -38.50f},
+    {-584.7f, 1731.8f, -54.26f, -43.39f},
+    {-733.4f, 1674.3f, -50.27f, -47.96f},
+    {-876.6f, 1604.0f, -45.90f, -52.15f},
+    {-1013.0f, 1521.5f, -41.18f, -55.96f},
+    {-1141.8f, 1427.4f, -36.14f, -59.33f},
+    {-1261.8f, 1322.4f, -30.83f, -62.26f},
+    {-1372.3f, 1207.4f, -25.29f, -64.71f},
+    {-1472.3f, 1083.2f, -19.56f, -66.66f},
+    {-1561.1f, 950.8f, -13.67f, -68.12f},
+    {-1638.0f, 811.1f, -7.68f, -69.05f},
+    {-1702.5f, 665.3f, -1.64f, -69.45f},
+    {-1754.0f, 514.3f, 4.42f, -69.33f},
+    {-1792.2f, 359.5f, 10.45f, -68.68f},
+    {-1816.7f, 201.9f, 16.40f, -67.51f},
+    {-1827.4f, 42.8f, 22.22f, -65.83f},
+    {944.0f, -151.1f, 26.35f, -68.35f},
+    {947.7f, -137.9f, 32.72f, -66.45f},
+    {935.3f, -126.7f, 38.97f, -63.86f},
+    {907.6f, -121.4f, 45.02f, -60.58f},
+    {866.7f, -125.6f, 50.77f, -56.63f},
+    {814.8f, -142.5f, 56.13f, -52.05f},
+    {755.3f, -174.7f, 61.03f, -46.89f},
+    {691.4f, -224.1f, 65.39f, -41.21f},
+    {627.3f, -292.1f, 69.15f, -35.07f},
+    {567.0f, -379.1f, 72.25f, -28.58f},
+    {514.7f, -484.9f, 74.67f, -21.81f},
+    {474.5f, -608.3f, 76.39f, -14.85f},
+    {450.4f, -747.5f, 77.38f, -7.79f},
+    {445.9f, -899.9f, 77.67f, -0.73f},
+    {464.0f, -1062.2f, 77.25f, 6.26f},
+    {507.4f, -1230.6f, 76.17f, 13.09f},
+    {577.7f, -1400.7f, 74.44f, 19.71f},
+    {676.0f, -1568.1f, 72.13f, 26.04f},
+    {802.5f, -1727.8f, 69.26f, 32.03f},
+    {956.7f, -1875.0f, 65.89f, 37.65f},
+    {1137.0f, -2005.1f, 62.06f, 42.85f},
+    {1341.2f, -2113.4f, 57.84f, 47.61f},
+    {1566.2f, -2195.9f, 53.26f, 51.90f},
+    {1808.3f, -2248.9f, 48.37f, 55.72f},
+    {2063.2f, -2269.6f, 43.23f, 59.04f},
+    {2326.2f, -2255.8f, 37.87f, 61.87f},
+    {2592.0f, -2205.8f, 32.35f, 64.19f},
+    {2855.4f, -2119.3f, 26.69f, 66.01f},
+    {3110.9f, -1996.3f, 20.94f, 67.33f},
+    {3353.1f, -1838.1f, 15.14f, 68.14f},
+    {3577.1f, -1646.6f, 9.33f, 68.47f},
+    {3777.8f, -1424.5f, 3.54f, 68.30f},
+    {3951.0f, -1175.3f, -2.20f, 67.66f},
+    {4092.9f, -903.0f, -7.85f, 66.54f},
+    {4200.3f, -612.4f, -13.37f, 64.96f},
+    {4270.6f, -308.5f, -18.73f, 62.93f},
+    {4302.3f, 3.3f, -23.90f, 60.46f},
+    {4294.3f, 317.2f, -28.83f, 57.58f},
+    {4246.7f, 627.6f, -33.50f, 54.30f},
+    {4160.2f, 928.8f, -37.88f, 50.65f},
+    {4036.4f, 1215.1f, -41.92f, 46.65f},
+    {3877.7f, 1481.4f, -45.61f, 42.34f},
+    {3687.3f, 1722.8f, -48.91f, 37.74f},
+    {3469.1f, 1935.0f, -51.80f, 32.90f},
+    {3227.5f, 2114.2f, -54.27f, 27.85f},
+    {2967.5f, 2257.5f, -56.29f, 22.63f},
+    {2694.6f, 2362.7f, -57.85f, 17.30f},
+    {2414.5f, 2428.7f, -58.95f, 11.89f},
+    {2132.8f, 2455.1f, -59.60f, 6.45f},
+    {1855.6f, 2442.5f, -59.80f, 1.03f},
+    {1588.2f, 2392.6f, -59.55f, -4.34f},
+    {1336.0f, 2307.9f, -58.89f, -9.63f},
+    {1103.6f, 2191.8f, -57.83f, -14.79f},
+    {895.2f, 2048.2f, -56.39f, -19.81f},
+    {714.0f, 1882.1f, -54.59f, -24.67f},
+    {562.4f, 1698.4f, -52.47f, -29.35f},
+    {442.0f, 1502.8f, -50.04f, -33.83f},
+    {353.1f, 1300.8f, -47.31f, -38.13f},
+    {295.2f, 1097.9f, -44.31f, -42.23f},
+    {266.9f, 899.3f, -41.02f, -46.13f},
+    {265.8f, 709.9f, -37.47f, -49.82f},
+    {288.9f, 533.8f, -33.63f, -53.30f},
+    {332.4f, 374.4f, -29.52f, -56.55f},
+    {392.0f, 234.5f, -25.11f, -59.55f},
+    {463.4f, 115.8f, -20.41f, -62.26f},
+    {541.7f, 19.1f, -15.41f, -64.65f},
+    {622.4f, -55.8f, -10.11f, -66.68f},
+    {701.0f, -109.7f, -4.54f, -68.30f},
+    {773.7f, -144.5f, 1.30f, -69.45f},
+    {836.8f, -162.8f, 7.36f, -70.07f},
+    {887.6f, -167.5f, 13.60f, -70.13f},
+    {923.7f, -162.3f, 19.95f, -69.57f},
+    {4050.4f, -91.1f, 20.01f, -73.74f},
+    {4016.5f, 98.8f, 27.37f, -73.10f},
+    {3936.8f, 279.6f, 34.84f, -71.36f},
+    {3814.1f, 442.7f, 42.22f, -68.49f},
+    {3652.9f, 580.1f, 49.35f, -64.52f},
+    {3459.1f, 684.6f, 56.04f, -59.51f},
+    {3239.5f, 750.5f, 62.13f, -53.56f},
+    {3001.8f, 773.1f, 67.49f, -46.82f},
+    {2754.7f, 749.4f, 72.03f, -39.44f},
+    {2507.0f, 677.9f, 75.68f, -31.59f},
+    {2267.8f, 558.6f, 78.39f, -23.46f},
+    {2046.2f, 393.1f, 80.18f, -15.21f},
+    {1850.6f, 184.8f, 81.06f, -7.01f},
+    {1689.1f, -61.4f, 81.08f, 1.02f},
+    {1568.7f, -339.5f, 80.31f, 8.74f},
+    {1495.3f, -642.0f, 78.83f, 16.06f},
+    {1473.3f, -960.3f, 76.71f, 22.92f},
+    {1505.8f, -1285.4f, 74.04f, 29.27f},
+    {1594.1f, -1607.5f, 70.91f, 35.09f},
+    {1737.7f, -1916.8f, 67.38f, 40.36f},
+    {1934.4f, -2203.5f, 63.52f, 45.09f},
+    {2180.5f, -2458.6f, 59.38f, 49.29f},
+    {2470.5f, -2673.7f, 55.01f, 52.98f},
+    {2797.6f, -2841.6f, 50.44f, 56.19f},
+    {3154.1f, -2956.3f, 45.71f, 58.93f},
+    {3531.3f, -3013.5f, 40.84f, 61.22f},
+    {3919.8f, -3010.6f, 35.85f, 63.08f},
+    {4310.2f, -2946.3f, 30.76f, 64.51f},
+    {4693.3f, -2821.3f, 25.58f, 65.54f},
+    {5059.9f, -2637.7f, 20.34f, 66.15f},
+    {5401.6f, -2399.0f, 15.06f, 66.35f},
+    {5710.8f, -2110.1f, 9.75f, 66.15f},
+    {5980.8f, -1776.9f, 4.45f, 65.54f},
+    {6205.8f, -1406.1f, -0.82f, 64.51f},
+    {6381.2f, -1005.4f, -6.04f, 63.08f},
+    {6503.6f, -582.6f, -11.17f, 61.23f},
+    {6570.4f, -146.3f, -16.18f, 58.97f},
+    {6580.5f, 294.9f, -21.03f, 56.30f},
+    {6533.7f, 732.4f, -25.70f, 53.22f},
+    {6430.9f, 1157.3f, -30.13f, 49.73f},
+    {6274.1f, 1561.1f, -34.29f, 45.86f},
+    {6066.6f, 1935.4f, -38.13f, 41.61f},
+    {5812.6f, 2272.3f, -41.60f, 37.01f},
+    {5517.4f, 2564.5f, -44.65f, 32.10f},
+    {5187.5f, 2805.3f, -47.24f, 26.92f},
+    {4830.2f, 2989.1f, -49.33f, 21.52f},
+    {4454.1f, 3111.4f, -50.88f, 15.97f},
+    {4068.3f, 3169.4f, -51.87f, 10.36f},
+    {3682.5f, 3161.5f, -52.29f, 4.77f},
+    {3306.8f, 3088.4f, -52.16f, -0.72f},
+    {2951.1f, 2952.3f, -51.50f, -6.02f},
+    {2625.1f, 2757.6f, -50.36f, -11.05f},
+    {2337.8f, 2510.6f, -48.81f, -15.75f},
+    {2096.7f, 2219.4f, -46.92f, -20.08f},
+    {1908.2f, 1893.6f, -44.80f, -24.02f},
+    {1776.7f, 1544.0f, -42.52f, -27.59f},
+    {1704.4f, 1182.2f, -40.17f, -30.82f},
+    {1691.7f, 820.2f, -37.82f, -33.78f},
+    {1736.4f, 469.7f, -35.52f, -36.56f},
+    {1834.3f, 141.8f, -33.27f, -39.24f},
+    {1979.4f, -153.6f, -31.07f, -41.93f},
+    {2163.7f, -407.9f, -28.86f, -44.70f},
+    {2378.2f, -614.6f, -26.58f, -47.63f},
+    {2612.7f, -769.3f, -24.11f, -50.74f},
+    {2856.7f, -869.7f, -21.36f, -54.02f},
+    {3099.7f, -915.5f, -18.20f, -57.43f},
+    {3331.4f, -909.0f, -14.54f, -60.86f},
+    {3542.6f, -854.0f, -10.29f, -64.21f},
+    {3724.9f, -756.1f, -5.41f, -67.30f},
+    {3871.4f, -622.4f, 0.12f, -69.98f},
+    {3976.7f, -461.1f, 6.25f, -72.05f},
+    {4037.0f, -280.9f, 12.92f, -73.35f},
+    {7472.5f, 49.3f, 11.57f, -78.34f},
+    {7387.1f, 411.2f, 19.36f, -79.17f},
+    {7229.7f, 755.3f, 27.47f, -78.39f},
+    {7005.2f, 1068.7f, 35.62f, -75.94f},
+    {6720.5f, 1339.7f, 43.53f, -71.89f},
+    {6384.2f, 1557.7f, 50.96f, -66.35f},
+    {6006.7f, 1714.2f, 57.70f, -59.52f},
+    {5599.3f, 1802.2f, 63.58f, -51.66f},
+    {5174.8f, 1817.0f, 68.50f, -43.03f},
+    {4746.3f, 1756.1f, 72.40f, -33.92f},
+    {4327.1f, 1619.4f, 75.26f, -24.62f},
+    {3930.8f, 1409.0f, 77.13f, -15.36f},
+    {3570.2f, 1129.5f, 78.08f, -6.38f},
+    {3257.2f, 787.7f, 78.19f, 2.17f},
+    {3002.8f, 392.5f, 77.58f, 10.15f},
+    {2816.2f, -45.0f, 76.35f, 17.48f},
+    {2704.4f, -512.3f, 74.62f, 24.13f},
+    {2672.4f, -995.3f, 72.47f, 30.10f},
+    {2722.7f, -1479.0f, 69.98f, 35.42f},
+    {2854.7f, -1948.1f, 67.21f, 40.12f},
+    {3065.2f, -2387.5f, 64.20f, 44.27f},
+    {3348.4f, -2782.9f, 60.98f, 47.93f},
+    {3695.6f, -3121.4f, 57.57f, 51.15f},
+    {4096.4f, -3392.1f, 53.95f, 53.97f},
+    {4538.5f, -3586.5f, 50.14f, 56.44f},
+    {5008.7f, -3699.0f, 46.13f, 58.58f},
+    {5493.3f, -3726.5f, 41.91f, 60.39f},
+    {5978.7f, -3669.0f, 37.48f, 61.88f},
+    {6452.2f, -3528.7f, 32.87f, 63.03f},
+    {6901.8f, -3310.3f, 28.07f, 63.85f},
+    {7317.3f, -3020.3f, 23.13f, 64.30f},
+    {7689.8f, -2666.8f, 18.06f, 64.38f},
+    {8012.3f, -2258.7f, 12.91f, 64.07f},
+    {8279.4f, -1805.7f, 7.71f, 63.37f},
+    {8487.1f, -1318.0f, 2.50f, 62.26f},
+    {8632.9f, -805.5f, -2.67f, 60.75f},
+    {8715.8f, -278.5f, -7.78f, 58.84f},
+    {8735.3f, 253.2f, -12.79f, 56.51f},
+    {8692.2f, 779.9f, -17.67f, 53.77f},
+    {8587.9f, 1292.1f, -22.39f, 50.60f},
+    {8424.5f, 1780.1f, -26.90f, 46.99f},
+    {8204.8f, 2234.4f, -31.16f, 42.93f},
+    {7932.7f, 2645.6f, -35.11f, 38.42f},
+    {7613.0f, 3004.2f, -38.69f, 33.45f},
+    {7251.8f, 3301.1f, -41.81f, 28.07f},
+    {6856.6f, 3527.5f, -44.41f, 22.31f},
+    {6436.4f, 3676.1f, -46.41f, 16.26f},
+    {6001.7f, 3740.7f, -47.73f, 10.03f},
+    {5564.3f, 3717.3f, -48.33f, 3.74f},
+    {5137.2f, 3604.2f, -48.17f, -2.45f},
+    {4734.0f, 3403.0f, -47.26f, -8.37f},
+    {4368.2f, 3118.2f, -45.66f, -13.85f},
+    {4053.0f, 2757.8f, -43.44f, -18.73f},
+    {3800.2f, 2333.2f, -40.73f, -22.90f},
+    {3619.6f, 1858.5f, -37.72f, -26.28f},
+    {3518.4f, 1350.4f, -34.59f, -28.85f},
+    {3500.8f, 827.2f, -31.53f, -30.70f},
+    {3567.3f, 308.4f, -28.74f, -31.94f},
+    {3714.9f, -187.1f, -26.35f, -32.79f},
+    {3936.9f, -641.0f, -24.44f, -33.50f},
+    {4223.5f, -1037.2f, -23.05f, -34.33f},
+    {4562.0f, -1362.6f, -22.11f, -35.54f},
+    {4937.5f, -1607.2f, -21.49f, -37.35f},
+    {5334.0f, -1764.8f, -20.98f, -39.92f},
+    {5734.9f, -1833.4f, -20.37f, -43.32f},
+    {6123.8f, -1814.4f, -19.39f, -47.49f},
+    {6485.5f, -1712.8f, -17.79f, -52.31f},
+    {6806.4f, -1536.6f, -15.38f, -57.54f},
+    {7074.7f, -1296.1f, -11.99f, -62.88f},
+    {7281.1f, -1003.6f, -7.56f, -67.98f},
+    {7418.8f, -672.4f, -2.08f, -72.48f},
+    {7483.2f, -316.6f, 4.35f, -76.03f},
+    {11083.6f, 238.5f, 4.28f, -80.54f},
+    {10947.3f, 759.4f, 11.40f, -82.71f},
+    {10719.4f, 1254.0f, 18.93f, -82.78f},
+    {10405.8f, 1705.7f, 26.57f, -80.74f},
+    {10015.1f, 2099.6f, 34.04f, -76.66f},
+    {9557.8f, 2422.3f, 41.07f, -70.76f},
+    {9046.6f, 2662.2f, 47.48f, -63.36f},
+    {8495.8f, 2810.4f, 53.12f, -54.80f},
+    {7921.0f, 2860.4f, 57.92f, -45.46f},
+    {7338.9f, 2808.8f, 61.85f, -35.72f},
+    {6766.2f, 2654.9f, 64.93f, -25.90f},
+    {6220.0f, 2401.3f, 67.21f, -16.33f},
+    {5716.6f, 2053.4f, 68.79f, -7.22f},
+    {5271.5f, 1619.5f, 69.74f, 1.25f},
+    {4899.1f, 1111.0f, 70.19f, 8.98f},
+    {4611.6f, 541.7f, 70.20f, 15.92f},
+    {4419.1f, -71.6f, 69.86f, 22.08f},
+    {4328.9f, -710.0f, 69.22f, 27.54f},
+    {4344.5f, -1353.1f, 68.30f, 32.37f},
+    {4465.8f, -1979.1f, 67.12f, 36.66f},
+    {4688.6f, -2566.4f, 65.66f, 40.51f},
+    {5004.3f, -3094.8f, 63.90f, 44.00f},
+    {5400.9f, -3545.9f, 61.80f, 47.19f},
+    {5863.0f, -3905.0f, 59.34f, 50.13f},
+    {6373.2f, -4161.3f, 56.49f, 52.84f},
+    {6913.0f, -4308.6f, 53.24f, 55.32f},
+    {7464.0f, -4345.0f, 49.59f, 57.56f},
+    {8008.5f, -4273.0f, 45.55f, 59.53f},
+    {8530.9f, -4098.5f, 41.13f, 61.20f},
+    {9017.6f, -3830.5f, 36.37f, 62.52f},
+    {9457.6f, -3480.0f, 31.32f, 63.45f},
+    {9842.8f, -3059.2f, 26.04f, 63.95f},
+    {10167.5f, -2581.2f, 20.60f, 64.00f},
+    {10428.5f, -2059.0f, 15.08f, 63.58f},
+    {10624.5f, -1505.1f, 9.56f, 62.70f},
+    {10756.1f, -931.3f, 4.09f, 61.39f},
+    {10825.1f, -348.3f, -1.28f, 59.66f},
+    {10833.9f, 234.4f, -6.50f, 57.54f},
+    {10785.4f, 808.1f, -11.57f, 55.03f},
+    {10682.1f, 1364.5f, -16.46f, 52.13f},
+    {10526.6f, 1895.6f, -21.17f, 48.80f},
+    {10321.2f, 2393.0f, -25.67f, 45.00f},
+    {10068.3f, 2847.6f, -29.92f, 40.70f},
+    {9770.8f, 3249.4f, -33.88f, 35.86f},
+    {9432.5f, 3587.5f, -37.47f, 30.47f},
+    {9058.8f, 3850.7f, -40.63f, 24.54f},
+    {8656.9f, 4028.1f, -43.24f, 18.12f},
+    {8236.3f, 4109.6f, -45.22f, 11.31f},
+    {7808.4f, 4087.2f, -46.46f, 4.25f},
+    {7386.9f, 3955.8f, -46.86f, -2.88f},
+    {6986.8f, 3714.1f, -46.34f, -9.83f},
+    {6624.3f, 3365.2f, -44.89f, -16.33f},
+    {6315.4f, 2917.2f, -42.53f, -22.08f},
+    {6075.4f, 2383.2f, -39.37f, -26.82f},
+    {5917.6f, 1781.1f, -35.61f, -30.35f},
+    {5852.5f, 1132.7f, -31.51f, -32.54f},
+    {5886.5f, 463.2f, -27.37f, -33.42f},
+    {6021.8f, -200.4f, -23.52f, -33.15f},
+    {6255.5f, -830.8f, -20.24f, -32.05f},
+    {6579.6f, -1402.2f, -17.74f, -30.52f},
+    {6981.7f, -1891.2f, -16.13f, -29.06f},
+    {7444.9f, -2279.2f, -15.41f, -28.15f},
+    {7949.6f, -2552.5f, -15.44f, -28.23f},
+    {8474.3f, -2703.7f, -15.99f, -29.63f},
+    {8997.0f, -2731.1f, -16.74f, -32.54f},
+    {9496.5f, -2638.9f, -17.34f, -36.97f},
+    {9953.6f, -2436.1f, -17.41f, -42.74f},
+    {10351.4f, -2135.6f, -16.66f, -49.51f},
+    {10676.4f, -1753.0f, -14.84f, -56.82f},
+    {10917.9f, -1305.8f, -11.81f, -64.13f},
+    {11068.7f, -812.4f, -7.53f, -70.86f},
+    {11124.4f, -291.4f, -2.11f, -76.48f},
+    {14657.0f, 447.3f, 0.20f, -79.25f},
+    {14478.9f, 1105.7f, 5.39f, -82.32f},
+    {14199.0f, 1730.5f, 10.97f, -83.02f},
+    {13823.7f, 2302.8f, 16.70f, -81.35f},
+    {13361.8f, 2805.0f, 22.35f, -77.47f},
+    {12824.5f, 3220.7f, 27.77f, -71.68f},
+    {12225.3f, 3535.8f, 32.86f, -64.36f},
+    {11579.7f, 3739.1f, 37.56f, -55.93f},
+    {10904.9f, 3822.4f, 41.84f, -46.81f},
+    {10219.1f, 3781.1f, 45.71f, -37.37f},
+    {9541.1f, 3614.2f, 49.20f, -27.98f},
+    {8889.9f, 3324.2f, 52.33f, -18.90f},
+    {8283.9f, 2916.9f, 55.15f, -10.37f},
+    {7741.2f, 2401.6f, 57.69f, -2.53f},
+    {7278.5f, 1790.7f, 59.99f, 4.56f},
+    {6911.2f, 1100.3f, 62.05f, 10.90f},
+    {6652.4f, 350.2f, 63.87f, 16.55f},
+    {6512.3f, -436.4f, 65.44f, 21.62f},
+    {6496.7f, -1232.7f, 66.68f, 26.24f},
+    {6606.5f, -2010.2f, 67.54f, 30.52f},
+    {6837.0f, -2739.4f, 67.91f, 34.57f},
+    {7177.3f, -3392.5f, 67.74f, 38.44f},
+    {7611.3f, -3944.9f, 66.94f, 42.18f},
+    {8118.6f, -4377.2f, 65.49f, 45.77f},
+    {8676.2f, -4676.7f, 63.37f, 49.21f},
+    {9259.8f, -4837.5f, 60.59f, 52.45f},
+    {9846.5f, -4860.7f, 57.18f, 55.47f},
+    {10415.2f, -4753.1f, 53.18f, 58.21f},
+    {10948.2f, -4526.3f, 48.64f, 60.61f},
+    {11431.7f, -4194.6f, 43.60f, 62.61f},
+    {11855.2f, -3774.8f, 38.14f, 64.12f},
+    {12212.3f, -3284.0f, 32.36f, 65.08f},
+    {12499.7f, -2739.5f, 26.35f, 65.44f},
+    {12716.9f, -2158.1f, 20.26f, 65.19f},
+    {12866.4f, -1554.8f, 14.20f, 64.34f},
+    {12952.6f, -943.0f, 8.29f, 62.96f},
+    {12981.3f, -333.6f, 2.59f, 61.13f},
+    {12958.8f, 265.1f, -2.83f, 58.92f},
+    {12891.3f, 846.7f, -7.97f, 56.38f},
+    {12783.5f, 1406.4f, -12.84f, 53.52f},
+    {12639.2f, 1939.7f, -17.45f, 50.31f},
+    {12460.4f, 2441.3f, -21.81f, 46.69f},
+    {12248.3f, 2904.5f, -25.90f, 42.60f},
+    {12003.5f, 3320.1f, -29.74f, 38.00f},
+    {11727.1f, 3677.0f, -33.30f, 32.83f},
+    {11421.4f, 3962.2f, -36.56f, 27.09f},
+    {11090.5f, 4161.9f, -39.51f, 20.76f},
+    {10740.7f, 4262.2f, -42.08f, 13.88f},
+    {10380.9f, 4250.9f, -44.16f, 6.51f},
+    {10022.7f, 4118.6f, -45.60f, -1.23f},
+    {9679.9f, 3860.4f, -46.23f, -9.09f},
+    {9368.1f, 3476.3f, -45.87f, -16.76f},
+    {9103.9f, 2972.8f, -44.40f, -23.81f},
+    {8903.9f, 2363.0f, -41.79f, -29.80f},
+    {8783.6f, 1666.3f, -38.15f, -34.30f},
+    {8756.0f, 908.5f, -33.71f, -37.00f},
+    {8830.6f, 119.8f, -28.84f, -37.79f},
+    {9012.1f, -665.6f, -23.95f, -36.77f},
+    {9299.4f, -1412.7f, -19.44f, -34.30f},
+    {9685.3f, -2087.0f, -15.68f, -30.93f},
+    {10156.6f, -2657.6f, -12.90f, -27.36f},
+    {10694.5f, -3099.2f, -11.20f, -24.30f},
+    {11275.9f, -3394.0f, -10.52f, -22.43f},
+    {11875.4f, -3532.8f, -10.67f, -22.28f},
+    {12466.8f, -3515.1f, -11.36f, -24.18f},
+    {13025.5f, -3348.3f, -12.24f, -28.20f},
+    {13529.4f, -3046.4f, -12.93f, -34.16f},
+    {13960.3f, -2627.8f, -13.08f, -41.66f},
+    {14304.1f, -2113.8f, -12.42f, -50.11f},
+    {14550.6f, -1527.0f, -10.77f, -58.81f},
+    {14693.4f, -889.9f, -8.06f, -67.01f},
+    {14729.1f, -224.7f, -4.36f, -74.01f},
+    {17921.6f, 665.5f, -0.63f, -74.25f},
+    {17707.3f, 1429.8f, 1.80f, -77.68f},
+    {17394.4f, 2155.1f, 4.48f, -78.74f},
+    {16989.1f, 2821.2f, 7.31f, -77.47f},
+    {16499.6f, 3408.7f, 10.23f, -74.10f},
+    {15935.8f, 3899.3f, 13.24f, -69.00f},
+    {15309.9f, 4276.8f, 16.37f, -62.57f},
+    {14636.1f, 4527.5f, 19.67f, -55.21f},
+    {13930.4f, 4641.8f, 23.19f, -47.29f},
+    {13210.2f, 4613.8f, 26.93f, -39.14f},
+    {12493.8f, 4441.7f, 30.91f, -31.04f},
+    {11799.7f, 4127.8f, 35.08f, -23.20f},
+    {11146.6f, 3677.5f, 39.39f, -15.81f},
+    {10553.3f, 3099.5f, 43.79f, -8.97f},
+    {10038.3f, 2406.1f, 48.21f, -2.73f},
+    {9619.3f, 1613.8f, 52.57f, 2.95f},
+    {9313.1f, 743.9f, 56.79f, 8.18f},
+    {9133.3f, -176.6f, 60.75f, 13.08f},
+    {9089.3f, -1115.2f, 64.30f, 17.83f},
+    {9184.4f, -2035.4f, 67.27f, 22.54f},
+    {9414.2f, -2898.7f, 69.51f, 27.29f},
+    {9766.7f, -3667.8f, 70.87f, 32.08f},
+    {10222.2f, -4310.4f, 71.26f, 36.87f},
+    {10755.4f, -4801.9f, 70.64f, 41.58f},
+    {11337.7f, -5127.8f, 69.04f, 46.11f},
+    {11940.1f, -5284.1f, 66.53f, 50.37f},
+    {12535.4f, -5276.3f, 63.19f, 54.32f},
+    {13100.5f, -5117.6f, 59.11f, 57.91f},
+    {13617.4f, -4826.4f, 54.39f, 61.09f},
+    {14072.7f, -4423.5f, 49.07f, 63.79f},
+    {14457.8f, -3931.0f, 43.25f, 65.92f},
+    {14767.9f, -3370.7f, 37.01f, 67.37f},
+    {15001.6f, -2763.8f, 30.48f, 68.03f},
+    {15160.9f, -2130.5f, 23.84f, 67.86f},
+    {15250.8f, -1488.9f, 17.26f, 66.89f},
+    {15279.1f, -854.6f, 10.91f, 65.23f},
+    {15255.6f, -238.9f, 4.92f, 63.03f},
+    {15191.0f, 351.0f, -0.65f, 60.45f},
+    {15095.0f, 911.9f, -5.79f, 57.60f},
+    {14975.5f, 1443.4f, -10.52f, 54.51f},
+    {14837.9f, 1945.8f, -14.85f, 51.16f},
+    {14684.8f, 2418.6f, -18.80f, 47.48f},
+    {14517.1f, 2858.2f, -22.37f, 43.42f},
+    {14334.5f, 3257.7f, -25.59f, 38.95f},
+    {14136.5f, 3606.7f, -28.53f, 34.08f},
+    {13923.1f, 3891.8f, -31.28f, 28.81f},
+    {13695.4f, 4097.8f, -33.98f, 23.11f},
+    {13455.9f, 4208.5f, -36.70f, 16.89f},
+    {13209.2f, 4208.6f, -39.43f, 10.03f},
+    {12962.3f, 4085.3f, -42.04f, 2.49f},
+    {12724.4f, 3829.5f, -44.26f, -5.68f},
+    {12507.3f, 3437.7f, -45.72f, -14.20f},
+    {12324.6f, 2913.1f, -46.08f, -22.60f},
+    {12191.3f, 2266.7f, -45.09f, -30.22f},
+    {12122.6f, 1517.2f, -42.65f, -36.37f},
+    {12132.5f, 691.0f, -38.90f, -40.47f},
+    {12233.2f, -178.6f, -34.14f, -42.16f},
+    {12432.5f, -1053.0f, -28.81f, -41.41f},
+    {12733.0f, -1889.9f, -23.40f, -38.55f},
+    {13130.8f, -2647.0f, -18.34f, -34.22f},
+    {13614.2f, -3284.5f, -13.97f, -29.26f},
+    {14164.7f, -3769.8f, -10.53f, -24.57f},
+    {14757.9f, -4079.6f, -8.06f, -21.01f},
+    {15365.9f, -4202.4f, -6.54f, -19.28f},
+    {15960.1f, -4138.9f, -5.81f, -19.82f},
+    {16513.4f, -3900.3f, -5.63f, -22.79f},
+    {17002.9f, -3506.3f, -5.75f, -28.08f},
+    {17410.5f, -2981.9f, -5.89f, -35.26f},
+    {17723.4f, -2354.1f, -5.79f, -43.71f},
+    {17933.6f, -1650.4f, -5.29f, -52.63f},
+    {18037.0f, -896.6f, -4.25f, -61.19f},
+    {18032.5f, -117.1f, -2.68f, -68.61f},
+    {20650.4f, 906.0f, 0.35f, -66.20f},
+    {20394.2f, 1734.9f, -0.19f, -69.52f},
+    {20058.3f, 2519.5f, -0.63f, -70.72f},
+    {19649.3f, 3240.7f, -0.91f, -69.89f},
+    {19173.7f, 3879.6f, -0.91f, -67.33f},
+    {18638.3f, 4417.6f, -0.49f, -63.42f},
+    {18051.0f, 4837.5f, 0.53f, -58.53f},
+    {17421.3f, 5124.1f, 2.28f, -52.98f},
+    {16760.8f, 5265.7f, 4.85f, -47.04f},
+    {16082.7f, 5255.0f, 8.27f, -40.88f},
+    {15401.8f, 5088.8f, 12.48f, -34.67f},
+    {14733.9f, 4768.2f, 17.40f, -28.55f},
+    {14095.9f, 4297.0f, 22.89f, -22.65f},
+    {13505.6f, 3682.2f, 28.82f, -17.05f},
+    {12981.9f, 2933.7f, 35.02f, -11.78f},
+    {12544.6f, 2066.2f, 41.37f, -6.79f},
+    {12213.8f, 1100.8f, 47.68f, -1.94f},
+    {12007.6f, 66.8f, 53.77f, 2.92f},
+    {11939.5f, -998.0f, 59.43f, 7.99f},
+    {12016.5f, -2048.4f, 64.40f, 13.39f},
+    {12236.2f, -3035.4f, 68.45f, 19.16f},
+    {12586.5f, -3911.3f, 71.37f, 25.23f},
+    {13045.6f, -4634.3f, 73.00f, 31.44f},
+    {13584.8f, -5174.1f, 73.30f, 37.58f},
+    {14171.4f, -5514.6f, 72.30f, 43.44f},
+    {14772.4f, -5654.7f, 70.14f, 48.86f},
+    {15358.5f, -5606.0f, 66.99f, 53.77f},
+    {15905.9f, -5389.7f, 63.00f, 58.16f},
+    {16397.1f, -5031.6f, 58.31f, 62.05f},
+    {16820.5f, -4558.8f, 52.99f, 65.41f},
+    {17169.1f, -3997.6f, 47.11f, 68.15f},
+    {17439.1f, -3372.8f, 40.73f, 70.11f},
+    {17629.5f, -2708.4f, 33.98f, 71.11f},
+    {17742.4f, -2027.8f, 27.06f, 71.03f},
+    {17783.8f, -1352.9f, 20.20f, 69.89f},
+    {17763.6f, -702.5f, 13.62f, 67.84f},
+    {17694.9f, -89.7f, 7.49f, 65.12f},
+    {17591.8f, 479.1f, 1.90f, 62.01f},
+    {17467.9f, 1004.0f, -3.14f, 58.69f},
+    {17333.7f, 1489.6f, -7.69f, 55.21f},
+    {17196.3f, 1941.8f, -11.75f, 51.51f},
+    {17059.8f, 2364.2f, -15.31f, 47.51f},
+    {16926.1f, 2756.8f, -18.32f, 43.17f},
+    {16796.3f, 3114.8f, -20.79f, 38.56f},
+    {16671.0f, 3429.0f, -22.84f, 33.84f},
+    {16550.5f, 3687.6f, -24.68f, 29.12f},
+    {16434.6f, 3876.2f, -26.66f, 24.41f},
+    {16322.4f, 3979.6f, -29.06f, 19.50f},
+    {16213.2f, 3981.9f, -32.05f, 14.02f},
+    {16107.1f, 3868.2f, -35.57f, 7.58f},
+    {16006.3f, 3626.6f, -39.28f, -0.08f},
+    {15915.5f, 3249.5f, -42.67f, -8.88f},
+    {15842.3f, 2735.9f, -45.15f, -18.33f},
+    {15796.9f, 2092.6f, -46.24f, -27.63f},
+    {15791.2f, 1335.0f, -45.63f, -35.78f},
+    {15838.6f, 486.9f, -43.31f, -41.85f},
+    {15952.3f, -419.1f, -39.47f, -45.20f},
+    {16143.4f, -1342.4f, -34.52f, -45.63f},
+    {16419.2f, -2236.2f, -28.91f, -43.38f},
+    {16780.5f, -3050.6f, -23.09f, -39.12f},
+    {17219.7f, -3737.0f, -17.42f, -33.77f},
+    {17720.4f, -4253.5f, -12.21f, -28.30f},
+    {18258.8f, -4570.3f, -7.65f, -23.66f},
+    {18806.0f, -4672.8f, -3.91f, -20.62f},
+    {19332.1f, -4562.4f, -1.04f, -19.70f},
+    {19809.6f, -4255.2f, 0.94f, -21.16f},
+    {20216.0f, -3777.3f, 2.09f, -24.96f},
+    {20535.0f, -3160.9f, 2.55f, -30.80f},
+    {20757.1f, -2439.3f, 2.50f, -38.10f},
+    {20878.1f, -1644.5f, 2.11f, -46.10f},
+    {20898.1f, -805.5f, 1.55f, -53.95f},
+    {20820.5f, 52.3f, 0.94f, -60.87f},
+    {22738.5f, 1194.8f, 1.38f, -56.16f},
+    {22425.1f, 2039.8f, -1.81f, -59.10f},
+    {22066.1f, 2833.3f, -5.00f, -60.34f},
+    {21668.9f, 3560.6f, -7.97f, -60.02f},
+    {21237.8f, 4207.0f, -10.49f, -58.45f},
+    {20774.7f, 4756.7f, -12.31f, -56.00f},
+    {20280.2f, 5193.2f, -13.20f, -52.99f},
+    {19755.9f, 5500.3f, -12.98f, -49.61f},
+    {19205.4f, 5664.2f, -11.51f, -45.98f},
+    {18635.3f, 5674.8f, -8.78f, -42.13f},
+    {18054.6f, 5526.6f, -4.83f, -38.09f},
+    {17474.6f, 5218.2f, 0.20f, -33.93f},
+    {16908.5f, 4750.8f, 6.17f, -29.72f},
+    {16371.9f, 4127.7f, 12.89f, -25.51f},
+    {15883.0f, 3354.7f, 20.18f, -21.32f},
+    {15462.7f, 2442.5f, 27.83f, -17.10f},
+    {15133.7f, 1410.1f, 35.63f, -12.70f},
+    {14917.9f, 287.6f, 43.34f, -7.93f},
+    {14833.7f, -882.3f, 50.71f, -2.59f},
+    {14891.7f, -2046.1f, 57.45f, 3.47f},
+    {15092.9f, -3143.9f, 63.28f, 10.29f},
+    {15426.7f, -4116.3f, 67.90f, 17.73f},
+    {15872.0f, -4911.8f, 71.08f, 25.51f},
+    {16399.2f, -5493.6f, 72.70f, 33.27f},
+    {16974.0f, -5844.1f, 72.76f, 40.62f},
+    {17562.5f, -5965.5f, 71.41f, 47.32f},
+    {18134.4f, -5876.3f, 68.85f, 53.24f},
+    {18666.3f, -5606.2f, 65.32f, 58.41f},
+    {19142.0f, -5188.5f, 61.01f, 62.94f},
+    {19551.0f, -4655.2f, 56.02f, 66.90f},
+    {19886.9f, -4035.0f, 50.41f, 70.22f},
+    {20145.0f, -3353.5f, 44.24f, 72.71f},
+    {20322.6f, -2636.2f, 37.62f, 74.10f},
+    {20420.1f, -1909.5f, 30.75f, 74.18f},
+    {20442.3f, -1200.5f, 23.91f, 72.88f},
+    {20400.2f, -532.7f, 17.39f, 70.40f},
+    {20308.8f, 77.4f, 11.41f, 67.12f},
+    {20185.5f, 623.9f, 6.04f, 63.44f},
+    {20046.0f, 1110.4f, 1.24f, 59.65f},
+    {19902.4f, 1547.1f, -3.07f, 55.79f},
+    {19762.9f, 1944.6f, -6.92f, 51.73f},
+    {19632.5f, 2309.9f, -10.26f, 47.29f},
+    {19516.1f, 2644.1f, -12.96f, 42.43f},
+    {19418.7f, 2942.9f, -14.94f, 37.36f},
+    {19345.8f, 3198.8f, -16.28f, 32.49f},
+    {19301.4f, 3403.4f, -17.31f, 28.20f},
+    {19286.3f, 3547.1f, -18.52f, 24.59f},
+    {19297.4f, 3619.5f, -20.43f, 21.36f},
+    {19328.0f, 3607.8f, -23.37f, 17.82f},
+    {19370.4f, 3497.7f, -27.35f, 13.12f},
+    {19417.8f, 3274.9f, -32.02f, 6.60f},
+    {19466.2f, 2927.9f, -36.74f, -1.95f},
+    {19515.5f, 2451.0f, -40.80f, -12.10f},
+    {19568.8f, 1845.5f, -43.54f, -22.86f},
+    {19632.9f, 1121.1f, -44.56f, -32.96f},
+    {19717.5f, 296.5f, -43.71f, -41.12f},
+    {19835.3f, -600.1f, -41.14f, -46.44f},
+    {19999.5f, -1530.0f, -37.13f, -48.53f},
+    {20222.0f, -2444.5f, -32.03f, -47.59f},
+    {20508.8f, -3287.3f, -26.19f, -44.26f},
+    {20857.4f, -4000.5f, -19.91f, -39.45f},
+    {21254.9f, -4532.1f, -13.50f, -34.11f},
+    {21679.1f, -4844.3f, -7.26f, -29.11f},
+    {22101.7f, -4918.5f, -1.56f, -25.18f},
+    {22493.1f, -4757.7f, 3.28f, -22.86f},
+    {22827.0f, -4382.8f, 6.98f, -22.51f},
+    {23083.1f, -3827.7f, 9.37f, -24.26f},
+    {23249.3f, -3131.9f, 10.42f, -27.98f},
+    {23320.2f, -2335.6f, 10.25f, -33.26f},
+    {23297.1f, -1475.4f, 9.04f, -39.47f},
+    {23185.9f, -583.2f, 7.01f, -45.84f},
+    {22995.9f, 314.3f, 4.39f, -51.61f},
+    {24229.9f, 1554.8f, 1.51f, -45.08f},
+    {23845.1f, 2365.5f, -3.88f, -47.59f},
+    {23458.4f, 3114.3f, -9.25f, -48.90f},
+    {23078.8f, 3795.0f, -14.28f, -49.17f},
+    {22707.9f, 4401.2f, -18.70f, -48.69f},
+    {22340.9f, 4923.8f, -22.23f, -47.76f},
+    {21969.5f, 5349.1f, -24.67f, -46.62f},
+    {21585.4f, 5660.2f, -25.83f, -45.37f},
+    {21182.8f, 5840.0f, -25.59f, -43.99f},
+    {20760.5f, 5874.3f, -23.91f, -42.41f},
+    {20321.1f, 5753.8f, -20.79f, -40.57f},
+    {19870.7f, 5473.7f, -16.31f, -38.44f},
+    {19418.1f, 5031.7f, -10.57f, -36.04f},
+    {18975.2f, 4426.3f, -3.75f, -33.37f},
+    {18558.0f, 3657.7f, 3.93f, -30.41f},
+    {18187.0f, 2730.9f, 12.21f, -27.08f},
+    {17885.8f, 1661.0f, 20.82f, -23.25f},
+    {17679.0f, 477.8f, 29.52f, -18.74f},
+    {17588.0f, -772.4f, 38.06f, -13.34f},
+    {17627.5f, -2028.5f, 46.20f, -6.89f},
+    {17801.9f, -3220.5f, 53.66f, 0.69f},
+    {18104.8f, -4278.1f, 60.11f, 9.26f},
+    {18518.6f, -5140.2f, 65.23f, 18.48f},
+    {19017.3f, -5763.8f, 68.77f, 27.85f},
+    {19569.4f, -6129.0f, 70.60f, 36.82f},
+    {20142.6f, -6240.3f, 70.77f, 44.96f},
+    {20708.0f, -6122.6f, 69.44f, 52.06f},
+    {21242.4f, -5812.6f, 66.87f, 58.14f},
+    {21729.5f, -5350.2f, 63.28f, 63.39f},
+    {22158.0f, -4770.7f, 58.85f, 67.98f},
+    {22519.3f, -4103.1f, 53.67f, 71.90f},
+    {22805.9f, -3372.2f, 47.83f, 74.96f},
+    {23011.3f, -2604.1f, 41.47f, 76.79f},
+    {23132.5f, -1829.2f, 34.82f, 77.04f},
+    {23173.0f, -1080.9f, 28.21f, 75.58f},
+    {23143.9f, -389.8f, 22.00f, 72.64f},
+    {23062.2f, 223.7f, 16.42f, 68.75f},
+    {22946.9f, 754.0f, 11.53f, 64.52f},
+    {22814.7f, 1209.6f, 7.20f, 60.36f},
+    {22677.0f, 1606.4f, 3.25f, 56.30f},
+    {22540.7f, 1958.8f, -0.40f, 52.05f},
+    {22411.6f, 2274.0f, -3.68f, 47.25f},
+    {22298.1f, 2550.5f, -6.35f, 41.80f},
+    {22212.1f, 2781.8f, -8.20f, 36.08f},
+    {22167.3f, 2961.7f, -9.27f, 30.82f},
+    {22174.8f, 3087.4f, -9.91f, 26.74f},
+    {22238.6f, 3159.1f, -10.71f, 24.14f},
+    {22354.1f, 3175.9f, -12.31f, 22.62f},
+    {22508.8f, 3132.1f, -15.12f, 21.12f},
+    {22686.7f, 3016.0f, -19.17f, 18.32f},
+    {22872.2f, 2811.4f, -24.07f, 13.10f},
+    {23052.9f, 2502.9f, -29.15f, 5.01f},
+    {23220.7f, 2079.5f, -33.66f, -5.56f},
+    {23371.5f, 1537.1f, -37.00f, -17.47f},
+    {23504.9f, 879.3f, -38.77f, -29.15f},
+    {23625.2f, 117.3f, -38.86f, -39.08f},
+    {23741.8f, -728.1f, -37.36f, -46.15f},
+    {23868.3f, -1623.8f, -34.44f, -49.91f},
+    {24019.4f, -2522.2f, -30.26f, -50.55f},
+    {24206.3f, -3362.3f, -24.98f, -48.69f},
+    {24431.3f, -4077.0f, -18.77f, -45.12f},
+    {24685.3f, -4603.3f, -11.86f, -40.62f},
+    {24948.4f, -4894.7f, -4.67f, -35.86f},
+    {25194.3f, -4929.0f, 2.26f, -31.41f},
+    {25395.9f, -4710.9f, 8.36f, -27.79f},
+    {25530.2f, -4267.6f, 13.09f, -25.49f},
+    {25582.1f, -3640.8f, 16.12f, -24.84f},
+    {25544.4f, -2877.7f, 17.31f, -25.99f},
+    {25417.9f, -2024.7f, 16.71f, -28.76f},
+    {25209.2f, -1123.1f, 14.54f, -32.70f},
+    {24930.4f, -208.0f, 11.06f, -37.17f},
+    {24597.8f, 691.9f, 6.61f, -41.49f},
+    {25284.6f, 1991.8f, 0.86f, -33.47f},
+    {24826.0f, 2722.6f, -6.43f, -35.64f},
+    {24411.2f, 3378.3f, -13.57f, -37.19f},
+    {24049.9f, 3965.0f, -20.19f, -38.19f},
+    {23740.4f, 4488.8f, -25.99f, -38.83f},
+    {23471.0f, 4950.1f, -30.78f, -39.34f},
+    {23224.4f, 5339.5f, -34.41f, -39.87f},
+    {22982.9f, 5639.1f, -36.77f, -40.46f},
+    {22732.7f, 5827.1f, -37.78f, -41.05f},
+    {22466.1f, 5883.7f, -37.34f, -41.51f},
+    {22180.4f, 5795.1f, -35.38f, -41.74f},
+    {21876.6f, 5552.6f, -31.85f, -41.66f},
+    {21558.5f, 5150.3f, -26.77f, -41.20f},
+    {21233.1f, 4582.1f, -20.28f, -40.22f},
+    {20912.2f, 3841.6f, -12.64f, -38.60f},
+    {20613.2f, 2927.0f, -4.21f, -36.23f},
+    {20358.9f, 1848.2f, 4.65f, -33.03f},
+    {20174.0f, 632.9f, 13.69f, -28.90f},
+    {20081.6f, -669.9f, 22.75f, -23.72f},
+    {20099.1f, -1993.4f, 31.72f, -17.30f},
+    {20235.4f, -3259.7f, 40.43f, -9.50f},
+    {20489.8f, -4390.1f, 48.61f, -0.33f},
+    {20852.7f, -5316.0f, 55.88f, 9.91f},
+    {21306.4f, -5988.3f, 61.85f, 20.65f},
+    {21827.2f, -6383.5f, 66.16f, 31.21f},
+    {22388.3f, -6506.0f, 68.65f, 40.98f},
+    {22963.1f, -6383.2f, 69.30f, 49.59f},
+    {23527.7f, -6056.4f, 68.23f, 56.96f},
+    {24062.7f, -5569.1f, 65.67f, 63.27f},
+    {24551.9f, -4958.4f, 61.86f, 68.72f},
+    {24981.3f, -4252.6f, 57.01f, 73.39f},
+    {25337.7f, -3475.7f, 51.34f, 77.08f},
+    {25609.9f, -2655.0f, 45.07f, 79.34f},
+    {25792.0f, -1826.4f, 38.54f, 79.72f},
+    {25886.7f, -1031.8f, 32.15f, 78.00f},
+    {25906.0f, -310.1f, 26.31f, 74.49f},
+    {25868.9f, 314.4f, 21.25f, 69.89f},
+    {25795.1f, 838.1f, 17.00f, 65.11f},
+    {25699.5f, 1275.9f, 13.30f, 60.71f},
+    {25590.4f, 1649.9f, 9.83f, 56.69f},
+    {25471.4f, 1976.8f, 6.43f, 52.53f},
+    {25347.9f, 2259.7f, 3.21f, 47.57f},
+    {25232.4f, 2489.5f, 0.47f, 41.61f},
+    {25145.2f, 2653.7f, -1.45f, 35.20f},
+    {25110.5f, 2746.7f, -2.52f, 29.43f},
+    {25148.4f, 2774.5f, -3.12f, 25.43f},
+    {25267.3f, 2751.7f, -3.87f, 23.68f},
+    {25461.4f, 2692.4f, -5.44f, 23.66f},
+    {25713.0f, 2601.2f, -8.18f, 23.93f},
+    {25998.9f, 2469.6f, -12.02f, 22.70f},
+    {26296.3f, 2279.5f, -16.50f, 18.49f},
+    {26586.6f, 2011.0f, -20.98f, 10.69f},
+    {26855.6f, 1648.7f, -24.84f, -0.22f},
+    {27091.9f, 1184.5f, -27.66f, -12.91f},
+    {27287.4f, 616.4f, -29.26f, -25.61f},
+    {27438.7f, -52.5f, -29.63f, -36.66f},
+    {27549.5f, -811.4f, -28.82f, -44.94f},
+    {27631.4f, -1636.2f, -26.87f, -50.05f},
+    {27700.8f, -2483.6f, -23.72f, -52.24f},
+    {27772.5f, -3289.7f, -19.26f, -52.07f},
+    {27853.1f, -3978.4f, -13.47f, -50.16f},
+    {27936.9f, -4475.9f, -6.55f, -46.96f},
+    {28007.0f, -4727.1f, 1.02f, -42.80f},
+    {28040.5f, -4707.2f, 8.49f, -38.02f},
+    {28015.0f, -4424.1f, 15.07f, -33.13f},
+    {27914.1f, -3912.2f, 20.04f, -28.76f},
+    {27729.8f, -3220.9f, 22.98f, -25.57f},
+    {27462.0f, -2404.0f, 23.71f, -23.99f},
+    {27117.3f, -1512.8f, 22.30f, -24.09f},
+    {26707.7f, -592.6f, 18.97f, -25.60f},
+    {26250.4f, 317.6f, 14.02f, -28.04f},
+    {25767.6f, 1186.4f, 7.83f, -30.83f},
+    {26110.3f, 2490.6f, 0.07f, -21.46f},
+    {25592.5f, 3106.8f, -8.93f, -23.46f},
+    {25157.7f, 3633.8f, -17.64f, -25.46f},
+    {24814.6f, 4092.6f, -25.58f, -27.38f},
+    {24557.5f, 4504.7f, -32.49f, -29.22f},
+    {24368.7f, 4881.3f, -38.23f, -31.07f},
+    {24224.3f, 5217.3f, -42.78f, -33.04f},
+    {24100.8f, 5492.6f, -46.13f, -35.13f},
+    {23980.0f, 5679.5f, -48.23f, -37.32f},
+    {23850.3f, 5752.0f, -48.97f, -39.53f},
+    {23705.8f, 5691.6f, -48.18f, -41.68f},
+    {23543.1f, 5487.3f, -45.67f, -43.67f},
+    {23360.3f, 5131.0f, -41.36f, -45.24f},
+    {23157.7f, 4612.3f, -35.34f, -46.08f},
+    {22940.5f, 3918.3f, -27.96f, -45.86f},
+    {22720.8f, 3039.1f, -19.69f, -44.40f},
+    {22517.7f, 1978.0f, -11.00f, -41.74f},
+    {22354.7f, 759.5f, -2.17f, -38.00f},
+    {22255.1f, -567.1f, 6.77f, -33.22f},
+    {22238.7f, -1931.3f, 15.90f, -27.28f},
+    {22319.2f, -3251.0f, 25.28f, -19.88f},
+    {22504.2f, -4442.8f, 34.80f, -10.85f},
+    {22795.1f, -5433.5f, 44.09f, -0.30f},
+    {23187.2f, -6168.7f, 52.63f, 11.32f},
+    {23668.7f, -6619.8f, 59.85f, 23.27f},
+    {24221.5f, -6786.1f, 65.25f, 34.79f},
+    {24822.1f, -6692.0f, 68.47f, 45.32f},
+    {25444.0f, -6377.8f, 69.39f, 54.58f},
+    {26060.6f, -5887.4f, 68.09f, 62.57f},
+    {26646.6f, -5258.1f, 64.85f, 69.40f},
+    {27178.7f, -4518.3f, 60.07f, 75.12f},
+    {27636.2f, -3693.1f, 54.21f, 79.53f},
+    {28003.7f, -2813.9f, 47.71f, 82.16f},
+    {28274.0f, -1924.6f, 41.06f, 82.51f},
+    {28450.8f, -1077.3f, 34.75f, 80.35f},
+    {28548.6f, -319.3f, 29.21f, 76.07f},
+    {28587.8f, 322.5f, 24.66f, 70.65f},
+    {28587.3f, 849.2f, 21.01f, 65.28f},
+    {28558.2f, 1284.3f, 17.90f, 60.75f},
+    {28503.4f, 1656.9f, 14.88f, 56.97f},
+    {28421.7f, 1983.1f, 11.73f, 53.12f},
+    {28317.6f, 2257.2f, 8.59f, 48.18f},
+    {28207.5f, 2457.3f, 5.90f, 41.79f},
+    {28120.5f, 2561.2f, 4.06f, 34.68f},
+    {28091.2f, 2563.7f, 3.11f, 28.38f},
+    {28148.2f, 2482.6f, 2.64f, 24.44f},
+    {28304.0f, 2351.5f, 1.95f, 23.46f},
+    {28551.9f, 2203.5f, 0.42f, 24.70f},
+    {28870.3f, 2055.0f, -2.16f, 26.30f},
+    {29231.1f, 1900.8f, -5.52f, 26.04f},
+    {29607.8f, 1719.8f, -9.13f, 22.26f},
+    {29978.4f, 1487.6f, -12.40f, 14.42f},
+    {30324.4f, 1186.2f, -14.95f, 3.19f},
+    {30628.3f, 806.1f, -16.69f, -9.89f},
+    {30873.1f, 342.0f, -17.68f, -22.95f},
+    {31045.8f, -210.9f, -18.05f, -34.39f},
+    {31143.2f, -854.4f, -17.80f, -43.24f},
+    {31173.6f, -1576.9f, -16.76f, -49.30f},
+    {31153.9f, -2342.2f, -14.61f, -52.90f},
+    {31102.1f, -3085.4f, -10.98f, -54.54f},
+    {31028.1f, -3721.7f, -5.68f, -54.53f},
+    {30929.4f, -4166.5f, 1.11f, -52.88f},
+    {30792.2f, -4357.4f, 8.78f, -49.46f},
+    {30598.3f, -4269.3f, 16.41f, -44.36f},
+    {30332.2f, -3915.4f, 22.97f, -38.08f},
+    {29986.5f, -3338.0f, 27.66f, -31.54f},
+    {29562.6f, -2593.4f, 30.02f, -25.75f},
+    {29068.1f, -1739.8f, 29.93f, -21.45f},
+    {28515.3f, -830.8f, 27.51f, -18.92f},
+    {27920.1f, 85.2f, 22.97f, -18.03f},
+    {27303.0f, 965.4f, 16.59f, -18.42f},
+    {26689.9f, 1774.7f, 8.79f, -19.69f},
+    {26898.3f, 3021.8f, -0.35f, -9.11f},
+    {26349.0f, 3502.4f, -10.81f, -11.06f},
+    {25909.2f, 3881.9f, -20.85f, -13.71f},
+    {25584.2f, 4197.5f, -29.91f, -16.73f},
+    {25364.2f, 4485.6f, -37.71f, -19.88f},
+    {25228.1f, 4767.4f, -44.19f, -23.06f},
+    {25149.7f, 5040.5f, -49.42f, -26.30f},
+    {25104.4f, 5281.6f, -53.49f, -29.63f},
+    {25074.1f, 5456.4f, -56.41f, -33.11f},
+    {25046.9f, 5533.3f, -58.08f, -36.81f},
+    {25014.9f, 5491.1f, -58.25f, -40.73f},
+    {24970.7f, 5318.7f, -56.65f, -44.74f},
+    {24906.1f, 5008.0f, -53.08f, -48.42f},
+    {24813.0f, 4545.9f, -47.63f, -51.12f},
+    {24688.1f, 3912.8f, -40.68f, -52.27f},
+    {24536.0f, 3089.9f, -32.83f, -51.60f},
+    {24370.8f, 2071.7f, -24.66f, -49.30f},
+    {24213.7f, 877.4f, -16.43f, -45.82f},
+    {24088.4f, -445.4f, -8.09f, -41.53f},
+    {24017.7f, -1825.8f, 0.68f, -36.40f},
+    {24021.3f, -3180.4f, 10.17f, -30.01f},
+    {24116.1f, -4425.6f, 20.45f, -21.87f},
+    {24316.4f, -5486.8f, 31.25f, -11.79f},
+    {24632.2f, -6305.5f, 42.04f, 0.03f},
+    {25066.1f, -6845.3f, 52.03f, 12.95f},
+    {25609.6f, -7095.2f, 60.42f, 26.20f},
+    {26242.4f, -7069.2f, 66.42f, 39.03f},
+    {26934.0f, -6799.9f, 69.52f, 50.87f},
+    {27647.8f, -6327.3f, 69.55f, 61.35f},
+    {28346.1f, -5688.2f, 66.80f, 70.27f},
+    {28994.2f, -4913.5f, 61.88f, 77.47f},
+    {29564.3f, -4033.5f, 55.56f, 82.71f},
+    {30037.8f, -3088.1f, 48.62f, 85.59f},
+    {30408.9f, -2132.2f, 41.73f, 85.67f},
+    {30684.5f, -1229.0f, 35.47f, 82.81f},
+    {30881.7f, -432.6f, 30.22f, 77.57f},
+    {31021.3f, 230.4f, 26.10f, 71.23f},
+    {31119.0f, 768.7f, 22.89f, 65.30f},
+    {31180.6f, 1216.4f, 20.12f, 60.74f},
+    {31202.3f, 1608.9f, 17.29f, 57.34f},
+    {31179.0f, 1958.9f, 14.21f, 53.89f},
+    {31114.2f, 2247.7f, 11.16f, 48.95f},
+    {31028.4f, 2436.0f, 8.71f, 42.03f},
+    {30957.9f, 2489.9f, 7.33f, 34.10f},
+    {30945.1f, 2404.7f, 7.02f, 27.23f},
+    {31024.3f, 2212.6f, 7.21f, 23.35f},
+    {31210.6f, 1969.6f, 7.12f, 23.14f},
+    {31496.4f, 1729.3f, 6.12f, 25.49f},
+    {31858.1f, 1520.4f, 4.16f, 28.03f},
+    {32266.3f, 1339.4f, 1.66f, 28.21f},
+    {32694.1f, 1161.4f, -0.77f, 24.37f},
+    {33119.1f, 958.4f, -2.66f, 16.22f},
+    {33520.0f, 713.0f, -3.91f, 4.77f},
+    {33872.5f, 418.2f, -4.73f, -8.24f},
+    {34150.2f, 67.9f, -5.40f, -21.01f},
+    {34330.4f, -351.1f, -6.08f, -32.16f},
+    {34402.3f, -855.4f, -6.64f, -41.07f},
+    {34371.5f, -1449.9f, -6.67f, -47.78f},
+    {34256.5f, -2108.2f, -5.58f, -52.75f},
+    {34078.5f, -2765.0f, -2.79f, -56.33f},
+    {33850.8f, -3327.0f, 2.01f, -58.44f},
+    {33573.5f, -3699.1f, 8.64f, -58.49f},
+    {33235.7f, -3813.2f, 16.34f, -55.83f},
+    {32824.5f, -3646.4f, 23.97f, -50.27f},
+    {32332.4f, -3219.9f, 30.33f, -42.44f},
+    {31762.2f, -2584.7f, 34.55f, -33.60f},
+    {31125.1f, -1802.2f, 36.21f, -25.21f},
+    {30436.6f, -932.0f, 35.29f, -18.30f},
+    {29713.6f, -27.5f, 31.97f, -13.28f},
+    {28974.1f, 861.9f, 26.44f, -10.08f},
+    {28240.0f, 1689.8f, 18.94f, -8.45f},
+    {27538.0f, 2417.5f, 9.82f, -8.17f},
+    {27785.8f, 3553.1f, -0.50f, 3.31f},
+    {27235.8f, 3891.6f, -11.86f, 1.36f},
+    {26806.3f, 4122.3f, -22.74f, -2.06f},
+    {26497.4f, 4297.1f, -32.53f, -6.31f},
+    {26296.1f, 4464.9f, -40.91f, -10.86f},
+    {26181.0f, 4653.7f, -47.85f, -15.37f},
+    {26128.3f, 4861.5f, -53.48f, -19.80f},
+    {26117.6f, 5060.7f, -57.96f, -24.20f},
+    {26134.2f, 5211.5f, -61.36f, -28.78f},
+    {26168.0f, 5278.6f, -63.61f, -33.74f},
+    {26210.3f, 5241.1f, -64.49f, -39.24f},
+    {26249.6f, 5090.8f, -63.67f, -45.15f},
+    {26270.8f, 4822.2f, -60.91f, -50.85f},
+    {26257.2f, 4421.0f, -56.25f, -55.38f},
+    {26196.3f, 3861.2f, -50.07f, -57.81f},
+    {26084.6f, 3113.4f, -43.02f, -57.78f},
+    {25930.5f, 2161.1f, -35.69f, -55.69f},
+    {25753.1f, 1015.1f, -28.34f, -52.39f},
+    {25577.6f, -281.1f, -20.80f, -48.63f},
+    {25430.9f, -1658.7f, -12.65f, -44.53f},
+    {25339.8f, -3036.4f, -3.42f, -39.55f},
+    {25330.9f, -4332.7f, 7.08f, -32.89f},
+    {25430.0f, -5474.2f, 18.70f, -23.94f},
+    {25660.2f, -6399.0f, 30.94f, -12.59f},
+    {26036.3f, -7060.9f, 42.97f, 0.81f},
+    {26558.8f, -7433.3f, 53.71f, 15.61f},
+    {27209.9f, -7513.0f, 62.04f, 30.99f},
+    {27954.8f, -7318.3f, 67.04f, 46.01f},
+    {28747.5f, -6881.1f, 68.27f, 59.76f},
+    {29538.6f, -6237.9f, 65.96f, 71.46f},
+    {30283.6f, -5425.6f, 60.92f, 80.55f},
+    {30949.5f, -4484.9f, 54.26f, 86.70f},
+    {31518.0f, -3469.0f, 47.07f, 89.62f},
+    {31986.4f, -2445.8f, 40.23f, 89.12f},
+    {32365.0f, -1488.7f, 34.28f, 85.32f},
+    {32672.1f, -655.8f, 29.49f, 79.04f},
+    {32925.6f, 30.1f, 25.79f, 71.84f},
+    {33135.5f, 588.1f, 22.82f, 65.50f},
+    {33301.1f, 1062.6f, 20.06f, 61.07f},
+    {33413.5f, 1493.5f, 17.07f, 58.14f},
+    {33465.3f, 1887.2f, 13.82f, 55.00f},
+    {33461.6f, 2208.4f, 10.81f, 49.81f},
+    {33426.6f, 2398.8f, 8.80f, 41.99f},
+    {33400.8f, 2412.5f, 8.30f, 32.92f},
+    {33430.1f, 2246.6f, 9.22f, 25.26f},
+    {33550.3f, 1949.5f, 10.84f, 21.40f},
+    {33776.1f, 1600.3f, 12.18f, 21.96f},
+    {34099.4f, 1272.7f, 12.56f, 25.36f},
+    {34496.8f, 1005.9f, 11.97f, 28.66f},
+    {34940.7f, 796.7f, 10.86f, 29.04f},
+    {35406.4f, 616.1f, 9.84f, 24.97f},
+    {35872.0f, 435.3f, 9.16f, 16.59f},
+    {36313.4f, 241.2f, 8.70f, 5.29f},
+    {36699.3f, 33.1f, 8.07f, -7.11f},
+    {36993.6f, -194.0f, 6.92f, -19.00f},
+    {37164.7f, -462.6f, 5.24f, -29.41f},
+    {37196.9f, -808.3f, 3.37f, -38.11f},
+    {37095.5f, -1255.4f, 1.96f, -45.42f},
+    {36882.6f, -1789.7f, 1.81f, -51.86f},
+    {36584.0f, -2345.7f, 3.63f, -57.57f},
+    {36216.6f, -2820.1f, 7.78f, -61.97f},
+    {35782.8f, -3107.1f, 14.03f, -63.84f},
+    {35274.4f, -3134.6f, 21.51f, -61.93f},
+    {34682.6f, -2884.5f, 28.93f, -55.81f},
+    {34008.0f, -2388.5f, 34.95f, -46.27f},
+    {33262.3f, -1706.7f, 38.68f, -35.07f},
+    {32465.5f, -904.0f, 39.76f, -24.13f},
+    {31639.4f, -38.1f, 38.26f, -14.78f},
+    {30803.9f, 840.5f, 34.41f, -7.48f},
+    {29977.8f, 1683.1f, 28.38f, -2.09f},
+    {29182.3f, 2440.8f, 20.31f, 1.54f},
+    {28442.5f, 3071.7f, 10.50f, 3.39f},
+    {28842.4f, 4059.2f, -0.95f, 15.24f},
+    {28316.5f, 4262.6f, -12.30f, 13.32f},
+    {27906.4f, 4358.0f, -23.25f, 9.15f},
+    {27606.6f, 4408.9f, -33.11f, 3.65f},
+    {27402.9f, 4472.0f, -41.55f, -2.30f},
+    {27276.9f, 4577.8f, -48.53f, -8.15f},
+    {27211.7f, 4722.6f, -54.19f, -13.72f},
+    {27194.0f, 4874.3f, -58.71f, -19.12f},
+    {27214.4f, 4989.9f, -62.23f, -24.62f},
+    {27265.2f, 5033.6f, -64.75f, -30.62f},
+    {27336.9f, 4987.8f, -66.11f, -37.43f},
+    {27414.6f, 4849.9f, -66.04f, -44.97f},
+    {27477.5f, 4619.0f, -64.27f, -52.47f},
+    {27501.9f, 4281.2f, -60.80f, -58.64f},
+    {27467.1f, 3804.1f, -55.93f, -62.24f},
+    {27362.0f, 3146.7f, -50.21f, -62.79f},
+    {27189.7f, 2278.9f, -44.15f, -60.89f},
+    {26967.3f, 1200.0f, -37.92f, -57.83f},
+    {26722.0f, -54.2f, -31.29f, -54.71f},
+    {26486.3f, -1419.0f, -23.80f, -51.80f},
+    {26294.3f, -2816.1f, -15.01f, -48.44f},
+    {26180.3f, -4167.1f, -4.70f, -43.51f},
+    {26178.2f, -5400.1f, 7.00f, -36.05f},
+    {26318.5f, -6449.7f, 19.66f, -25.58f},
+    {26622.9f, -7258.5f, 32.48f, -12.10f},
+    {27096.9f, -7781.5f, 44.33f, 4.01f},
+    {27724.8f, -7993.6f, 53.90f, 21.95f},
+    {28469.8f, -7894.3f, 60.04f, 40.47f},
+    {29280.9f, -7505.3f, 62.11f, 57.96f},
+    {30102.9f, -6863.3f, 60.29f, 72.85f},
+    {30888.0f, -6014.5f, 55.54f, 84.04f},
+    {31603.1f, -5015.0f, 49.18f, 91.02f},
+    {32233.3f, -3933.9f, 42.51f, 93.75f},
+    {32779.5f, -2852.4f, 36.42f, 92.43f},
+    {33253.4f, -1850.9f, 31.35f, 87.60f},
+    {33669.6f, -987.2f, 27.32f, 80.38f},
+    {34038.7f, -277.0f, 24.09f, 72.59f},
+    {34362.1f, 308.8f, 21.20f, 66.16f},
+    {34632.5f, 823.2f, 18.21f, 62.08f},
+    {34839.0f, 1306.4f, 14.87f, 59.61f},
+    {34976.1f, 1755.0f, 11.41f, 56.54f},
+    {35053.2f, 2116.7f, 8.58f, 50.64f},
+    {35098.1f, 2315.0f, 7.26f, 41.40f},
+    {35152.4f, 2294.4f, 8.02f, 30.68f},
+    {35260.1f, 2056.0f, 10.65f, 21.89f},
+    {35453.4f, 1664.5f, 14.28f, 17.85f},
+    {35744.3f, 1220.7f, 17.77f, 19.10f},
+    {36124.0f, 816.1f, 20.36f, 23.53f},
+    {36570.9f, 497.6f, 21.90f, 27.62f},
+    {37060.6f, 261.2f, 22.74f, 28.32f},
+    {37571.0f, 75.6f, 23.23f, 24.33f},
+    {38079.9f, -86.2f, 23.44f, 16.23f},
+    {38559.0f, -228.6f, 23.06f, 5.71f},
+    {38969.8f, -343.3f, 21.70f, -5.46f},
+    {39268.4f, -434.4f, 19.21f, -16.04f},
+    {39417.6f, -536.5f, 15.85f, -25.52f},
+    {39400.8f, -707.7f, 12.25f, -34.02f},
+    {39226.8f, -995.5f, 9.23f, -42.06f},
+    {38923.3f, -1398.4f, 7.67f, -50.13f},
+    {38522.2f, -1849.3f, 8.27f, -58.11f},
+    {38044.1f, -2233.4f, 11.36f, -64.92f},
+    {37493.6f, -2432.9f, 16.68f, -68.66f},
+    {36864.5f, -2372.7f, 23.34f, -67.53f},
+    {36151.6f, -2041.8f, 30.01f, -60.84f},
+    {35360.7f, -1483.9f, 35.36f, -49.60f},
+    {34510.4f, -768.2f, 38.49f, -36.10f},
+    {33626.4f, 38.0f, 39.10f, -22.80f},
+    {32734.0f, 881.4f, 37.33f, -11.27f},
+    {31854.2f, 1716.9f, 33.43f, -1.94f},
+    {31005.2f, 2497.8f, 27.50f, 5.45f},
+    {30205.8f, 3173.7f, 19.62f, 11.00f},
+    {29477.6f, 3701.0f, 9.96f, 14.43f},
+    {30063.6f, 4527.2f, -2.27f, 25.97f},
+    {29575.7f, 4614.0f, -12.61f, 24.16f},
+    {29184.8f, 4598.7f, -22.66f, 19.35f},
+    {28881.6f, 4551.9f, -31.79f, 12.72f},
+    {28652.9f, 4533.0f, -39.65f, 5.46f},
+    {28486.8f, 4570.5f, -46.15f, -1.64f},
+    {28374.8f, 4657.2f, -51.39f, -8.31f},
+    {28312.1f, 4758.3f, -55.56f, -14.61f},
+    {28294.8f, 4830.5f, -58.84f, -20.88f},
+    {28317.4f, 4840.8f, -61.35f, -27.66f},
+    {28369.6f, 4776.9f, -63.02f, -35.43f},
+    {28434.7f, 4643.3f, -63.67f, -44.18f},
+    {28489.6f, 4444.8f, -63.10f, -53.07f},
+    {28506.8f, 4169.0f, -61.24f, -60.55f},
+    {28460.3f, 3778.3f, -58.28f, -65.13f},
+    {28333.1f, 3219.9f, -54.55f, -66.27f},
+    {28122.5f, 2448.2f, -50.33f, -64.74f},
+    {27843.0f, 1447.7f, -45.62f, -62.18f},
+    {27523.3f, 243.2f, -40.12f, -59.95f},
+    {27200.6f, -1106.8f, -33.44f, -58.39f},
+    {26915.0f, -2526.6f, -25.25f, -56.68f},
+    {26705.7f, -3939.3f, -15.51f, -53.46f},
+    {26608.9f, -5272.1f, -4.40f, -47.47f},
+    {26655.6f, -6455.1f, 7.63f, -37.95f},
+    {26866.7f, -7419.3f, 19.87f, -24.54f},
+    {27248.0f, -8101.1f, 31.30f, -7.33f},
+    {27784.9f, -8453.8f, 40.71f, 13.01f},
+    {28443.3f, -8457.6f, 46.95f, 34.92f},
+    {29175.6f, -8123.9f, 49.42f, 56.08f},
+    {29931.3f, -7491.2f, 48.32f, 74.08f},
+    {30668.8f, -6617.4f, 44.62f, 87.19f},
+    {31362.1f, -5575.3f, 39.65f, 94.77f},
+    {32002.4f, -4449.9f, 34.62f, 97.11f},
+    {32592.9f, -3331.8f, 30.22f, 94.94f},
+    {33141.8f, -2303.4f, 26.63f, 89.26f},
+    {33653.9f, -1417.7f, 23.63f, 81.50f},
+    {34127.1f, -681.7f, 20.85f, 73.58f},
+    {34552.2f, -58.9f, 17.95f, 67.42f},
+    {34916.4f, 506.3f, 14.70f, 63.81f},
+    {35210.9f, 1049.2f, 11.22f, 61.63f},
+    {35436.9f, 1553.9f, 8.00f, 58.23f},
+    {35611.0f, 1952.0f, 5.93f, 51.10f},
+    {35764.2f, 2153.6f, 5.87f, 39.90f},
+    {35935.9f, 2097.9f, 8.28f, 27.10f},
+    {36163.2f, 1792.5f, 12.86f, 16.81f},
+    {36471.0f, 1317.8f, 18.70f, 12.32f},
+    {36866.0f, 792.9f, 24.64f, 14.06f},
+    {37338.2f, 323.2f, 29.84f, 19.45f},
+    {37868.1f, -39.1f, 33.96f, 24.48f},
+    {38433.8f, -298.5f, 37.01f, 25.93f},
+    {39013.6f, -486.5f, 38.99f, 22.74f},
+    {39582.9f, -624.3f, 39.67f, 15.80f},
+    {40107.8f, -705.8f, 38.71f, 6.89f},
+    {40544.1f, -713.3f, 35.93f, -2.47f},
+    {40843.9f, -651.9f, 31.54f, -11.50f},
+    {40970.2f, -572.3f, 26.19f, -20.12f},
+    {40909.7f, -558.3f, 20.77f, -28.65f},
+    {40677.6f, -682.2f, 16.18f, -37.65f},
+    {40308.1f, -954.9f, 13.18f, -47.45f},
+    {39838.4f, -1305.6f, 12.31f, -57.67f},
+    {39292.7f, -1605.8f, 13.79f, -66.79f},
+    {38677.9f, -1724.7f, 17.36f, -72.35f},
+    {37989.9f, -1584.1f, 22.26f, -72.01f},
+    {37226.5f, -1181.0f, 27.31f, -64.89f},
+    {36396.8f, -572.0f, 31.34f, -52.20f},
+    {35522.1f, 164.7f, 33.57f, -36.73f},
+    {34630.0f, 961.4f, 33.71f, -21.42f},
+    {33746.1f, 1770.1f, 31.90f, -8.08f},
+    {32890.3f, 2552.3f, 28.34f, 2.95f},
+    {32078.6f, 3264.2f, 23.10f, 12.05f},
+    {31326.3f, 3855.3f, 16.13f, 19.34f},
+    {30649.9f, 4281.9f, 7.54f, 24.25f},
+    {31364.8f, 4956.7f, -4.69f, 34.85f},
+    {30917.8f, 4954.3f, -13.11f, 33.25f},
+    {30538.9f, 4859.9f, -21.45f, 28.00f},
+    {30217.2f, 4746.6f, -29.12f, 20.46f},
+    {29943.1f, 4670.9f, -35.77f, 12.08f},
+    {29712.5f, 4656.7f, -41.26f, 3.85f},
+    {29525.9f, 4692.6f, -45.65f, -3.80f},
+    {29386.2f, 4743.3f, -49.12f, -10.89f},
+    {29294.2f, 4768.3f, -51.87f, -17.76f},
+    {29245.8f, 4739.8f, -54.11f, -25.04f},
+    {29231.6f, 4651.8f, -55.90f, -33.34f},
+    {29235.8f, 4515.4f, -57.20f, -42.78f},
+    {29236.6f, 4341.2f, -57.90f, -52.50f},
+    {29207.4f, 4119.7f, -57.92f, -60.81f},
+    {29120.7f, 3810.2f, -57.33f, -66.09f},
+    {28954.8f, 3349.8f, -56.17f, -67.79f},
+    {28701.5f, 2676.9f, -54.42f, -66.87f},
+    {28370.0f, 1758.5f, -51.82f, -65.18f},
+    {27987.5f, 605.2f, -47.99f, -64.22f},
+    {27592.9f, -732.4f, -42.55f, -64.24f},
+    {27229.4f, -2180.7f, -35.40f, -64.21f},
+    {26937.4f, -3660.4f, -26.68f, -62.50f},
+    {26750.7f, -5094.1f, -16.80f, -57.70f},
+    {26693.9f, -6404.9f, -6.27f, -48.85f},
+    {26781.1f, -7512.7f, 4.23f, -35.40f},
+    {27013.7f, -8338.8f, 13.92f, -17.17f},
+    {27378.4f, -8818.9f, 21.87f, 5.23f},
+    {27848.8f, -8918.8f, 27.31f, 29.97f},
+    {28390.3f, -8643.0f, 29.88f, 54.14f},
+    {28968.7f, -8033.2f, 29.87f, 74.57f},
+    {29559.0f, -7159.4f, 28.15f, 89.04f},
+    {30148.9f, -6108.7f, 25.75f, 96.89f},
+    {30737.2f, -4976.6f, 23.46f, 98.81f},
+    {31326.6f, -3856.7f, 21.53f, 96.07f},
+    {31915.9f, -2826.3f, 19.77f, 90.10f},
+    {32494.8f, -1929.5f, 17.81f, 82.45f},
+    {33045.1f, -1166.1f, 15.35f, 74.96f},
+    {33546.3f, -497.9f, 12.38f, 69.29f},
+    {33983.2f, 125.2f, 9.16f, 65.98f},
+    {34352.9f, 726.9f, 6.22f, 63.60f},
+    {34667.2f, 1277.5f, 4.28f, 59.25f},
+    {34951.1f, 1695.8f, 4.08f, 50.38f},
+    {35238.0f, 1885.1f, 6.21f, 36.92f},
+    {35561.8f, 1785.4f, 10.81f, 21.89f},
+    {35949.3f, 1413.5f, 17.47f, 10.01f},
+    {36414.9f, 863.6f, 25.35f, 4.87f},
+    {36958.4f, 269.2f, 33.48f, 6.87f},
+    {37567.7f, -254.8f, 41.08f, 13.07f},
+    {38223.9f, -652.3f, 47.61f, 19.21f},
+    {38905.1f, -926.6f, 52.67f, 22.01f},
+    {39587.1f, -1106.7f, 55.80f, 20.55f},
+    {40240.3f, -1206.2f, 56.54f, 15.81f},
+    {40825.8f, -1208.4f, 54.57f, 9.36f},
+    {41297.2f, -1088.9f, 50.07f, 2.25f},
+    {41608.8f, -858.2f, 43.71f, -5.23f},
+    {41729.4f, -585.5f, 36.56f, -13.27f},
+    {41653.0f, -382.0f, 29.65f, -22.20f},
+    {41400.6f, -344.0f, 23.81f, -32.35f},
+    {41010.5f, -492.9f, 19.53f, -43.81f},
+    {40522.1f, -752.6f, 17.05f, -55.97f},
+    {39961.8f, -979.3f, 16.41f, -67.01f},
+    {39339.5f, -1029.3f, 17.40f, -74.11f},
+    {38654.8f, -821.2f, 19.51f, -74.56f},
+    {37909.0f, -359.5f, 21.95f, -67.28f},
+    {37113.0f, 287.6f, 23.88f, -53.62f},
+    {36288.1f, 1034.3f, 24.73f, -36.75f},
+    {35459.6f, 1813.0f, 24.25f, -20.00f},
+    {34650.1f, 2581.7f, 22.50f, -5.36f},
+    {33876.5f, 3308.5f, 19.56f, 6.91f},
+    {33151.0f, 3953.0f, 15.42f, 17.34f},
+    {32484.6f, 4465.4f, 9.96f, 26.05f},
+    {31887.0f, 4803.8f, 3.18f, 32.27f},
+    {32582.6f, 5356.0f, -7.98f, 41.45f},
+    {32173.1f, 5297.3f, -13.90f, 40.16f},
+    {31797.5f, 5158.5f, -19.95f, 34.71f},
+    {31445.8f, 5010.4f, -25.66f, 26.55f},
+    {31113.8f, 4903.4f, -30.67f, 17.29f},
+    {30804.9f, 4854.5f, -34.81f, 8.12f},
+    {30527.6f, 4848.9f, -38.07f, -0.38f},
+    {30290.4f, 4853.2f, -40.60f, -8.10f},
+    {30097.8f, 4832.0f, -42.65f, -15.38f},
+    {29947.8f, 4763.8f, -44.45f, -22.87f},
+    {29833.1f, 4648.1f, -46.20f, -31.30f},
+    {29741.5f, 4501.3f, -47.98f, -40.87f},
+    {29656.1f, 4339.4f, -49.84f, -50.77f},
+    {29555.1f, 4157.0f, -51.75f, -59.30f},
+    {29412.7f, 3913.8f, -53.65f, -64.86f},
+    {29204.8f, 3539.9f, -55.36f, -66.99f},
+    {28916.5f, 2959.5f, -56.54f, -66.83f},
+    {28549.6f, 2121.0f, -56.66f, -66.36f},
+    {28124.9f, 1018.0f, -55.17f, -67.05f},
+    {27678.4f, -309.0f, -51.71f, -68.95f},
+    {27251.9f, -1787.9f, -46.28f, -70.68f},
+    {26883.9f, -3333.6f, -39.24f, -70.35f},
+    {26602.5f, -4859.7f, -31.18f, -66.38f},
+    {26423.4f, -6278.8f, -22.80f, -57.79f},
+    {26350.6f, -7500.9f, -14.76f, -43.97f},
+    {26379.5f, -8437.4f, -7.64f, -24.73f},
+    {26498.7f, -9014.8f, -1.89f, -0.72f},
+    {26693.6f, -9192.4f, 2.24f, 25.97f},
+    {26949.7f, -8974.0f, 4.83f, 51.98f},
+    {27257.3f, -8406.7f, 6.32f, 73.71f},
+    {27614.8f, -7569.7f, 7.31f, 88.72f},
+    {28026.9f, -6558.4f, 8.29f, 96.52f},
+    {28499.8f, -5469.8f, 9.35f, 98.23f},
+    {29032.6f, -4391.0f, 10.18f, 95.60f},
+    {29611.2f, -3387.4f, 10.22f, 90.21f},
+    {30208.2f, -2492.3f, 9.08f, 83.47f},
+    {30790.0f, -1702.0f, 6.78f, 76.84f},
+    {31327.6f, -984.3f, 3.88f, 71.58f},
+    {31807.2f, -304.1f, 1.28f, 67.96f},
+    {32234.9f, 345.1f, -0.05f, 64.48f},
+    {32633.9f, 919.4f, 0.63f, 58.36f},
+    {33037.4f, 1330.3f, 3.71f, 47.32f},
+    {33478.3f, 1481.9f, 9.15f, 31.64f},
+    {33982.3f, 1321.9f, 16.55f, 14.72f},
+    {34563.2f, 878.1f, 25.32f, 1.56f},
+    {35222.8f, 256.7f, 34.82f, -4.13f},
+    {35953.0f, -399.4f, 44.45f, -2.01f},
+    {36737.9f, -968.6f, 53.64f, 4.90f},
+    {37557.2f, -1391.2f, 61.77f, 12.31f},
+    {38386.4f, -1667.8f, 68.08f, 17.05f},
+    {39196.6f, -1822.3f, 71.74f, 18.23f},
+    {39952.7f, -1860.9f, 72.08f, 16.62f},
+    {40613.7f, -1759.6f, 68.96f, 13.28f},
+    {41136.4f, -1492.9f, 62.92f, 8.63f},
+    {41484.1f, -1080.1f, 55.07f, 2.50f},
+    {41635.9f, -611.0f, 46.71f, -5.38f},
+    {41593.6f, -221.3f, 38.94f, -15.06f},
+    {41380.7f, -27.6f, 32.35f, -26.44f},
+    {41033.3f, -59.3f, 27.08f, -39.27f},
+    {40587.5f, -234.1f, 22.99f, -52.79f},
+    {40069.3f, -395.1f, 19.94f, -65.10f},
+    {39492.5f, -387.0f, 17.77f, -73.25f},
+    {38863.4f, -125.3f, 16.33f, -74.39f},
+    {38189.0f, 379.7f, 15.36f, -67.29f},
+    {37482.3f, 1051.6f, 14.53f, -53.34f},
+    {36762.3f, 1799.2f, 13.55f, -35.89f},
+    {36049.4f, 2556.1f, 12.23f, -18.47f},
+    {35360.7f, 3286.0f, 10.51f, -3.16f},
+    {34708.3f, 3962.4f, 8.32f, 9.83f},
+    {34100.2f, 4548.6f, 5.51f, 21.13f},
+    {33542.0f, 4996.7f, 1.90f, 30.86f},
+    {33036.6f, 5267.9f, -2.62f, 38.10f},
+    {33502.2f, 5738.0f, -11.68f, 45.59f},
+    {33125.6f, 5657.3f, -14.85f, 44.71f},
+    {32749.3f, 5507.5f, -18.35f, 39.32f},
+    {32366.3f, 5353.9f, -21.88f, 30.84f},
+    {31978.0f, 5238.5f, -25.09f, 20.98f},
+    {31593.9f, 5171.1f, -27.78f, 11.09f},
+    {31227.9f, 5135.0f, -29.87f, 1.94f},
+    {30892.5f, 5100.0f, -31.48f, -6.25f},
+    {30594.7f, 5037.3f, -32.84f, -13.74f},
+    {30334.8f, 4931.2f, -34.22f, -21.19f},
+    {30108.7f, 4785.8f, -35.85f, -29.39f},
+    {29909.2f, 4620.6f, -37.97f, -38.59f},
+    {29726.2f, 4456.3f, -40.75f, -48.05f},
+    {29544.4f, 4292.8f, -44.26f, -56.17f},
+    {29342.4f, 4093.8f, -48.40f, -61.49f},
+    {29095.5f, 3787.2f, -52.80f, -63.78f},
+    {28783.1f, 3286.3f, -56.89f, -64.36f},
+    {28397.6f, 2521.9f, -59.92f, -65.28f},
+    {27949.4f, 1469.1f, -61.23f, -67.90f},
+    {27466.3f, 155.8f, -60.41f, -71.91f},
+    {26984.4f, -1348.0f, -57.46f, -75.55f},
+    {26537.3f, -2949.9f, -52.80f, -76.57f},
+    {26147.5f, -4550.2f, -47.17f, -73.22f},
+    {25822.5f, -6049.0f, -41.38f, -64.51f},
+    {25558.6f, -7346.9f, -36.12f, -50.02f},
+    {25346.2f, -8351.2f, -31.80f, -29.76f},
+    {25177.6f, -8988.2f, -28.40f, -4.66f},
+    {25051.2f, -9220.7f, -25.62f, 22.91f},
+    {24974.3f, -9058.5f, -22.90f, 49.39f},
+    {24962.8f, -8555.7f, -19.73f, 71.12f},
+    {25038.3f, -7796.9f, -15.86f, 85.82f},
+    {25221.5f, -6876.7f, -11.47f, 93.38f},
+    {25523.4f, -5883.4f, -7.18f, 95.35f},
+    {25938.0f, -4888.2f, -3.89f, 93.69f},
+    {26439.2f, -3939.6f, -2.36f, 89.85f},
+    {26986.5f, -3060.4f, -2.84f, 84.74f},
+    {27536.4f, -2248.6f, -4.85f, 79.14f},
+    {28057.9f, -1487.1f, -7.17f, 73.81f},
+    {28542.8f, -763.0f, -8.29f, 68.86f},
+    {29007.3f, -90.9f, -6.91f, 63.08f},
+    {29484.6f, 472.6f, -2.40f, 54.27f},
+    {30012.1f, 838.6f, 5.05f, 40.76f},
+    {30618.8f, 919.9f, 14.57f, 23.24f},
+    {31318.6f, 677.6f, 25.13f, 5.24f},
+    {32110.6f, 152.3f, 35.90f, -8.39f},
+    {32982.9f, -540.5f, 46.46f, -14.14f},
+    {33917.9f, -1252.0f, 56.64f, -11.76f},
+    {34895.0f, -1857.2f, 66.24f, -4.14f},
+    {35890.8f, -2292.7f, 74.71f, 4.71f},
+    {36877.3f, -2554.2f, 81.12f, 11.86f},
+    {37821.1f, -2660.2f, 84.44f, 16.33f},
+    {38684.4f, -2611.9f, 84.02f, 18.42f},
+    {39428.7f, -2383.9f, 79.90f, 18.47f},
+    {40020.3f, -1955.4f, 72.93f, 16.20f},
+    {40436.2f, -1358.3f, 64.43f, 11.07f},
+    {40668.1f, -700.0f, 55.78f, 2.95f},
+    {40723.2f, -135.0f, 47.90f, -7.71f},
+    {40620.7f, 206.6f, 41.11f, -20.23f},
+    {40386.5f, 290.7f, 35.16f, -33.98f},
+    {40046.8f, 203.4f, 29.63f, -48.10f},
+    {39624.3f, 109.9f, 24.17f, -60.83f},
+    {39137.2f, 172.4f, 18.72f, -69.41f},
+    {38601.5f, 477.4f, 13.49f, -71.04f},
+    {38032.8f, 1012.4f, 8.81f, -64.47f},
+    {37447.8f, 1697.1f, 4.90f, -50.99f},
+    {36862.5f, 2439.4f, 1.82f, -33.88f},
+    {36291.3f, 3175.0f, -0.51f, -16.66f},
+    {35744.5f, 3872.1f, -2.31f, -1.39f},
+    {35229.2f, 4508.6f, -3.81f, 11.73f},
+    {34748.8f, 5050.9f, -5.28f, 23.38f},
+    {34303.9f, 5454.3f, -6.95f, 33.67f},
+    {33891.1f, 5683.6f, -9.04f, 41.60f},
+    {33912.1f, 6116.4f, -15.32f, 47.30f},
+    {33567.0f, 6044.0f, -15.78f, 46.92f},
+    {33195.4f, 5911.5f, -16.77f, 41.85f},
+    {32793.7f, 5776.1f, -18.16f, 33.39f},
+    {32367.9f, 5670.8f, -19.67f, 23.26f},
+    {31931.7f, 5599.1f, -21.07f, 12.93f},
+    {31501.6f, 5543.5f, -22.23f, 3.34f},
+    {31091.8f, 5478.1f, -23.19f, -5.13f},
+    {30710.5f, 5380.5f, -24.13f, -12.66f},
+    {30360.0f, 5240.4f, -25.28f, -19.89f},
+    {30038.9f, 5064.7f, -26.90f, -27.61f},
+    {29744.7f, 4874.8f, -29.30f, -36.08f},
+    {29472.9f, 4694.7f, -32.76f, -44.61f},
+    {29215.1f, 4530.6f, -37.41f, -51.79f},
+    {28955.4f, 4352.7f, -43.15f, -56.41f},
+    {28671.3f, 4091.4f, -49.52f, -58.53f},
+    {28339.1f, 3653.8f, -55.84f, -59.68f},
+    {27942.3f, 2956.1f, -61.31f, -61.95f},
+    {27479.8f, 1955.0f, -65.23f, -66.50f},
+    {26966.9f, 664.2f, -67.19f, -72.68f},
+    {26430.3f, -850.7f, -67.14f, -78.29f},
+    {25897.0f, -2490.4f, -65.42f, -80.69f},
+    {25384.7f, -4141.2f, -62.72f, -77.89f},
+    {24897.5f, -5688.8f, -59.86f, -68.92f},
+    {24428.6f, -7025.7f, -57.46f, -53.62f},
+    {23968.6f, -8058.7f, -55.77f, -32.45f},
+    {23514.7f, -8722.1f, -54.44f, -6.83f},
+    {23076.8f, -8989.9f, -52.74f, 20.60f},
+    {22679.6f, -8883.4f, -49.82f, 46.28f},
+    {22358.0f, -8464.7f, -45.21f, 66.85f},
+    {22149.6f, -7818.6f, -39.02f, 80.58f},
+    {22084.6f, -7031.0f, -32.01f, 87.89f},
+    {22175.6f, -6172.8f, -25.36f, 90.65f},
+    {22412.5f, -5293.2f, -20.29f, 90.77f},
+    {22763.2f, -4421.9f, -17.58f, 89.22f},
+    {23182.9f, -3574.0f, -17.22f, 86.10f},
+    {23629.0f, -2755.2f, -18.26f, 81.35f},
+    {24076.4f, -1969.7f, -19.05f, 75.18f},
+    {24526.2f, -1231.1f, -17.70f, 67.73f},
+    {25003.8f, -575.7f, -12.78f, 58.44f},
+    {25547.8f, -68.4f, -3.93f, 46.13f},
+    {26194.2f, 207.9f, 8.04f, 30.05f},
+    {26963.1f, 182.3f, 21.55f, 11.35f},
+    {27854.4f, -166.4f, 34.95f, -6.63f},
+    {28850.6f, -783.9f, 47.21f, -19.58f},
+    {29925.5f, -1548.0f, 58.08f, -24.55f},
+    {31051.8f, -2308.0f, 67.81f, -21.47f},
+    {32203.5f, -2937.7f, 76.56f, -12.92f},
+    {33354.5f, -3370.3f, 84.00f, -2.42f},
+    {34474.7f, -3596.6f, 89.29f, 7.39f},
+    {35529.8f, -3630.5f, 91.50f, 15.38f},
+    {36484.1f, -3472.5f, 90.15f, 21.24f},
+    {37307.1f, -3102.4f, 85.50f, 24.48f},
+    {37979.2f, -2509.8f, 78.51f, 24.19f},
+    {38493.1f, -1739.2f, 70.48f, 19.64f},
+    {38851.9f, -910.5f, 62.54f, 11.01f},
+    {39063.2f, -187.2f, 55.32f, -0.64f},
+    {39135.3f, 295.5f, 48.81f, -14.00f},
+    {39076.5f, 501.4f, 42.52f, -28.07f},
+    {38897.4f, 516.2f, 35.82f, -41.99f},
+    {38614.3f, 504.6f, 28.27f, -54.30f},
+    {38250.1f, 628.6f, 19.92f, -62.65f},
+    {37831.7f, 974.6f, 11.30f, -64.53f},
+    {37385.6f, 1531.2f, 3.21f, -58.75f},
+    {36933.2f, 2220.9f, -3.60f, -46.42f},
+    {36489.2f, 2955.2f, -8.74f, -30.54f},
+    {36061.6f, 3673.9f, -12.19f, -14.38f},
+    {35654.9f, 4348.1f, -14.24f, 0.12f},
+    {35271.2f, 4958.3f, -15.26f, 12.78f},
+    {34910.9f, 5473.7f, -15.58f, 24.24f},
+    {34570.5f, 5853.1f, -15.51f, 34.61f},
+    {34241.8f, 6066.4f, -15.32f, 42.83f},
+    {33668.0f, 6501.8f, -18.58f, 46.82f},
+    {33359.6f, 6460.7f, -16.67f, 46.97f},
+    {33007.9f, 6365.3f, -15.42f, 42.48f},
+    {32612.9f, 6264.0f, -14.92f, 34.42f},
+    {32183.5f, 6181.0f, -15.02f, 24.41f},
+    {31735.2f, 6115.3f, -15.48f, 13.98f},
+    {31284.6f, 6049.6f, -16.11f, 4.22f},
+    {30845.0f, 5962.6f, -16.86f, -4.35f},
+    {30424.3f, 5837.9f, -17.80f, -11.79f},
+    {30025.2f, 5669.7f, -19.06f, -18.72f},
+    {29647.4f, 5466.7f, -20.90f, -25.83f},
+    {29289.9f, 5251.0f, -23.63f, -33.38f},
+    {28952.1f, 5048.7f, -27.56f, -40.73f},
+    {28630.7f, 4871.4f, -32.85f, -46.69f},
+    {28316.3f, 4697.0f, -39.35f, -50.35f},
+    {27991.7f, 4461.3f, -46.59f, -52.09f},
+    {27634.4f, 4070.4f, -53.92f, -53.61f},
+    {27222.9f, 3430.5f, -60.66f, -56.98f},
+    {26745.6f, 2482.9f, -66.28f, -63.18f},
+    {26204.6f, 1226.0f, -70.47f, -71.27f},
+    {25614.4f, -281.4f, -73.15f, -78.67f},
+    {24993.9f, -1936.1f, -74.53f, -82.37f},
+    {24357.9f, -3612.6f, -75.04f, -80.13f},
+    {23711.1f, -5183.0f, -75.27f, -70.94f},
+    {23050.2f, -6532.1f, -75.68f, -54.96f},
+    {22371.0f, -7568.9f, -76.30f, -33.20f},
+    {21677.1f, -8238.6f, -76.60f, -7.64f},
+    {20986.8f, -8530.9f, -75.68f, 18.81f},
+    {20333.5f, -8480.9f, -72.68f, 42.76f},
+    {19759.4f, -8157.5f, -67.27f, 61.47f},
+    {19306.8f, -7642.1f, -59.89f, 73.91f},
+    {19006.3f, -7006.9f, -51.63f, 81.07f},
+    {18869.2f, -6301.0f, -43.88f, 84.99f},
+    {18884.5f, -5550.9f, -37.80f, 87.27f},
+    {19022.9f, -4770.0f, -33.97f, 88.18f},
+    {19247.4f, -3970.1f, -32.12f, 86.88f},
+    {19527.6f, -3169.4f, -31.11f, 82.44f},
+    {19851.7f, -2395.7f, -29.17f, 74.60f},
+    {20231.7f, -1688.7f, -24.48f, 63.72f},
+    {20699.0f, -1102.5f, -15.83f, 50.14f},
+    {21291.4f, -704.7f, -3.16f, 33.94f},
+    {22037.1f, -565.4f, 12.29f, 15.51f},
+    {22943.2f, -734.4f, 28.50f, -3.60f},
+    {23993.4f, -1211.5f, 43.52f, -20.39f},
+    {25154.0f, -1929.3f, 56.22f, -31.49f},
+    {26385.7f, -2761.6f, 66.47f, -34.71f},
+    {27651.9f, -3559.3f, 74.80f, -30.26f},
+    {28922.7f, -4198.2f, 81.66f, -20.38f},
+    {30171.1f, -4610.0f, 87.02f, -8.05f},
+    {31369.3f, -4781.6f, 90.36f, 4.42f},
+    {32487.1f, -4724.8f, 91.08f, 15.69f},
+    {33496.7f, -4443.9f, 89.00f, 24.82f},
+    {34379.6f, -3929.6f, 84.56f, 30.58f},
+    {35131.6f, -3184.9f, 78.64f, 31.65f},
+    {35759.6f, -2265.2f, 72.21f, 27.30f},
+    {36273.7f, -1294.1f, 65.93f, 18.11f},
+    {36677.2f, -433.1f, 60.03f, 5.74f},
+    {36962.7f, 186.1f, 54.21f, -7.96f},
+    {37117.4f, 527.0f, 47.89f, -21.71f},
+    {37133.5f, 668.4f, 40.41f, -34.70f},
+    {37018.9f, 764.5f, 31.37f, -45.87f},
+    {36799.2f, 967.9f, 20.94f, -53.42f},
+    {36511.5f, 1362.1f, 9.84f, -55.30f},
+    {36192.7f, 1940.0f, -0.80f, -50.48f},
+    {35870.1f, 2633.2f, -9.89f, -39.81f},
+    {35557.7f, 3362.0f, -16.75f, -25.86f},
+    {35259.8f, 4071.6f, -21.28f, -11.46f},
+    {34976.3f, 4735.2f, -23.77f, 1.65f},
+    {34706.4f, 5333.9f, -24.63f, 13.30f},
+    {34448.7f, 5839.0f, -24.23f, 24.04f},
+    {34197.6f, 6213.6f, -22.84f, 33.97f},
+    {33942.4f, 6432.5f, -20.81f, 42.09f},
+    {32734.2f, 6899.3f, -21.25f, 44.58f},
+    {32474.5f, 6903.3f, -17.58f, 45.24f},
+    {32165.6f, 6855.5f, -14.61f, 41.53f},
+    {31810.0f, 6795.4f, -12.66f, 34.24f},
+    {31418.3f, 6740.3f, -11.73f, 24.78f},
+    {31005.4f, 6686.0f, -11.64f, 14.64f},
+    {30585.8f, 6617.0f, -12.15f, 5.01f},
+    {30170.1f, 6516.3f, -13.10f, -3.45f},
+    {29763.6f, 6373.0f, -14.41f, -10.73f},
+    {29367.1f, 6185.4f, -16.12f, -17.31f},
+    {28978.6f, 5963.6f, -18.42f, -23.82f},
+    {28596.2f, 5729.6f, -21.56f, -30.45f},
+    {28220.0f, 5509.4f, -25.82f, -36.63f},
+    {27850.5f, 5317.8f, -31.27f, -41.40f},
+    {27485.1f, 5138.8f, -37.71f, -44.18f},
+    {27115.0f, 4914.9f, -44.68f, -45.57f},
+    {26723.3f, 4555.4f, -51.65f, -47.35f},
+    {26289.3f, 3962.5f, -58.24f, -51.50f},
+    {25794.4f, 3066.3f, -64.25f, -58.83f},
+    {25229.3f, 1852.3f, -69.61f, -68.21f},
+    {24595.4f, 370.0f, -74.33f, -76.85f},
+    {23902.6f, -1277.9f, -78.43f, -81.53f},
+    {23162.4f, -2958.7f, -82.02f, -79.77f},
+    {22383.2f, -4534.2f, -85.27f, -70.55f},
+    {21569.4f, -5882.9f, -88.27f, -54.25f},
+    {20725.7f, -6915.8f, -90.82f, -32.40f},
+    {19863.6f, -7588.5f, -92.33f, -7.47f},
+    {19005.6f, -7905.0f, -91.98f, 17.44f},
+    {18185.1f, -7912.7f, -89.14f, 39.24f},
+    {17440.6f, -7684.9f, -83.75f, 55.87f},
+    {16807.3f, -7297.6f, -76.45f, 67.04f},
+    {16309.1f, -6808.0f, -68.36f, 74.16f},
+    {15954.0f, -6246.1f, -60.65f, 79.23f},
+    {15734.3f, -5620.4f, -54.13f, 83.42f},
+    {15632.1f, -4934.1f, -49.02f, 86.23f},
+    {15628.3f, -4200.8f, -44.89f, 86.00f},
+    {15712.6f, -3453.0f, -40.71f, 81.13f},
+    {15889.9f, -2739.9f, -35.12f, 71.04f},
+    {16182.1f, -2122.1f, -26.80f, 56.39f},
+    {16621.3f, -1664.3f, -15.00f, 38.48f},
+    {17237.9f, -1430.0f, 0.00f, 18.68f},
+    {18047.2f, -1471.5f, 16.84f, -1.53f},
+    {19040.7f, -1813.8f, 33.52f, -20.24f},
+    {20186.6f, -2434.8f, 48.19f, -34.94f},
+    {21437.6f, -3255.1f, 59.83f, -43.25f},
+    {22744.0f, -4147.4f, 68.43f, -43.92f},
+    {24063.9f, -4968.3f, 74.62f, -37.45f},
+    {25366.0f, -5599.1f, 79.04f, -25.84f},
+    {26626.9f, -5973.2f, 81.94f, -11.58f},
+    {27825.2f, -6075.9f, 83.21f, 3.27f},
+    {28940.3f, -5919.9f, 82.69f, 17.14f},
+    {29956.1f, -5517.1f, 80.52f, 28.58f},
+    {30867.4f, -4871.5f, 77.21f, 35.90f},
+    {31682.9f, -4000.0f, 73.36f, 37.61f},
+    {32419.0f, -2964.4f, 69.42f, 33.20f},
+    {33087.5f, -1883.5f, 65.49f, 23.67f},
+    {33684.0f, -906.2f, 61.33f, 11.11f},
+    {34184.8f, -153.3f, 56.50f, -2.28f},
+    {34557.0f, 338.9f, 50.43f, -15.07f},
+    {34776.0f, 636.1f, 42.63f, -26.57f},
+    {34840.2f, 871.8f, 32.87f, -36.13f},
+    {34775.0f, 1180.6f, 21.40f, -42.51f},
+    {34623.6f, 1639.4f, 9.05f, -44.20f},
+    {34430.4f, 2247.6f, -2.95f, -40.35f},
+    {34227.7f, 2950.5f, -13.36f, -31.59f},
+    {34030.9f, 3681.6f, -21.37f, -19.95f},
+    {33842.8f, 4393.1f, -26.78f, -7.77f},
+    {33661.8f, 5059.4f, -29.83f, 3.52f},
+    {33486.1f, 5660.8f, -30.89f, 13.70f},
+    {33313.9f, 6169.9f, -30.27f, 23.26f},
+    {33139.4f, 6554.8f, -28.20f, 32.26f},
+    {32951.2f, 6795.2f, -25.02f, 39.85f},
+    {31182.8f, 7307.5f, -23.22f, 41.26f},
+    {30989.0f, 7361.8f, -18.64f, 42.30f},
+    {30748.1f, 7363.9f, -14.67f, 39.47f},
+    {30464.5f, 7345.1f, -11.81f, 33.23f},
+    {30149.1f, 7317.5f, -10.26f, 24.71f},
+    {29814.6f, 7276.1f, -9.92f, 15.26f},
+    {29471.8f, 7207.7f, -10.55f, 6.08f},
+    {29127.2f, 7100.5f, -11.89f, -2.09f},
+    {28781.9f, 6948.6f, -13.76f, -9.13f},
+    {28432.4f, 6754.3f, -16.07f, -15.40f},
+    {28073.4f, 6529.0f, -18.92f, -21.39f},
+    {27700.2f, 6293.0f, -22.48f, -27.24f},
+    {27312.1f, 6070.3f, -26.91f, -32.48f},
+    {26912.1f, 5874.5f, -32.17f, -36.39f},
+    {26504.7f, 5692.5f, -37.96f, -38.64f},
+    {26090.7f, 5473.1f, -43.84f, -39.98f},
+    {25662.7f, 5131.2f, -49.48f, -42.10f},
+    {25204.8f, 4571.0f, -54.83f, -46.74f},
+    {24696.6f, 3718.0f, -60.08f, -54.57f},
+    {24120.0f, 2548.5f, -65.53f, -64.38f},
+    {23465.1f, 1102.6f, -71.33f, -73.42f},
+    {22731.7f, -522.2f, -77.38f, -78.46f},
+    {21926.9f, -2191.6f, -83.45f, -76.97f},
+    {21062.2f, -3762.7f, -89.22f, -67.88f},
+    {20150.6f, -5109.8f, -94.32f, -51.74f},
+    {19207.0f, -6145.2f, -98.32f, -30.40f},
+    {18250.8f, -6830.6f, -100.61f, -6.61f},
+    {17306.4f, -7179.5f, -100.65f, 16.48f},
+    {16401.9f, -7246.1f, -98.18f, 36.15f},
+    {15565.2f, -7105.0f, -93.43f, 50.93f},
+    {14818.3f, -6825.8f, -87.11f, 61.06f},
+    {14174.8f, -6454.8f, -80.09f, 68.15f},
+    {13639.5f, -6009.8f, -73.09f, 73.97f},
+    {13211.4f, -5490.5f, -66.37f, 79.18f},
+    {12888.8f, -4897.9f, -59.78f, 82.74f},
+    {12674.4f, -4251.9f, -52.89f, 82.48f},
+    {12579.2f, -3597.7f, -45.08f, 76.43f},
+    {12623.4f, -3000.0f, -35.73f, 63.91f},
+    {12833.6f, -2530.7f, -24.31f, 45.91f},
+    {13237.1f, -2256.8f, -10.71f, 24.50f},
+    {13851.3f, -2231.2f, 4.55f, 2.09f},
+    {14675.9f, -2485.2f, 20.27f, -19.01f},
+    {15687.3f, -3018.3f, 34.90f, -36.60f},
+    {16841.3f, -3788.0f, 47.06f, -48.69f},
+    {18082.5f, -4705.1f, 56.09f, -53.81f},
+    {19357.1f, -5644.8f, 62.12f, -51.52f},
+    {20622.6f, -6472.9f, 65.80f, -42.69f},
+    {21851.9f, -7080.2f, 67.82f, -29.17f},
+    {23028.7f, -7405.4f, 68.64f, -13.10f},
+    {24142.4f, -7435.2f, 68.48f, 3.56f},
+    {25184.8f, -7185.4f, 67.57f, 19.07f},
+    {26152.5f, -6676.4f, 66.26f, 31.67f},
+    {27051.6f, -5925.4f, 64.95f, 39.54f},
+    {27898.4f, -4960.8f, 63.85f, 41.30f},
+    {28712.3f, -3845.5f, 62.84f, 36.79f},
+    {29502.3f, -2686.2f, 61.46f, 27.34f},
+    {30255.4f, -1611.9f, 59.16f, 15.30f},
+    {30935.2f, -727.5f, 55.43f, 2.93f},
+    {31494.5f, -69.3f, 49.86f, -8.35f},
+    {31895.9f, 410.5f, 42.22f, -18.02f},
+    {32129.0f, 817.0f, 32.49f, -25.74f},
+    {32215.6f, 1260.1f, 21.03f, -30.80f},
+    {32199.1f, 1806.5f, 8.65f, -32.18f},
+    {32126.5f, 2462.2f, -3.47f, -29.23f},
+    {32033.0f, 3188.7f, -14.15f, -22.37f},
+    {31936.3f, 3935.0f, -22.59f, -13.12f},
+    {31841.0f, 4661.4f, -28.51f, -3.27f},
+    {31746.4f, 5343.1f, -32.08f, 5.98f},
+    {31651.8f, 5959.1f, -33.58f, 14.45f},
+    {31555.9f, 6483.6f, -33.22f, 22.47f},
+    {31453.5f, 6889.0f, -31.15f, 30.15f},
+    {31333.8f, 7160.6f, -27.64f, 36.83f},
+    {29154.4f, 7719.6f, -24.48f, 37.68f},
+    {29044.4f, 7823.9f, -19.90f, 38.88f},
+    {28894.0f, 7873.0f, -15.70f, 36.88f},
+    {28708.3f, 7891.3f, -12.52f, 31.81f},
+    {28497.1f, 7887.7f, -10.71f, 24.49f},
+    {28270.2f, 7858.2f, -10.28f, 16.04f},
+    {28034.1f, 7793.8f, -11.05f, 7.58f},
+    {27790.3f, 7687.7f, -12.73f, -0.14f},
+    {27534.9f, 7539.4f, -15.04f, -6.89f},
+    {27260.2f, 7354.8f, -17.85f, -12.88f},
+    {26957.1f, 7146.0f, -21.13f, -18.47f},
+    {26618.3f, 6930.7f, -24.97f, -23.76f},
+    {26242.2f, 6727.2f, -29.39f, -28.41f},
+    {25834.5f, 6544.4f, -34.23f, -31.94f},
+    {25405.5f, 6367.6f, -39.12f, -34.20f},
+    {24964.9f, 6149.5f, -43.66f, -35.92f},
+    {24515.3f, 5812.7f, -47.69f, -38.55f},
+    {24047.7f, 5268.1f, -51.44f, -43.51f},
+    {23543.4f, 4443.6f, -55.45f, -51.24f},
+    {22979.3f, 3311.6f, -60.31f, -60.63f},
+    {22336.2f, 1904.5f, -66.34f, -69.14f},
+    {21603.9f, 312.1f, -73.40f, -73.81f},
+    {20783.8f, -1336.1f, -80.98f, -72.24f},
+    {19887.7f, -2898.1f, -88.36f, -63.41f},
+    {18934.8f, -4247.9f, -94.77f, -47.89f},
+    {17949.0f, -5297.8f, -99.54f, -27.61f},
+    {16956.3f, -6011.5f, -102.15f, -5.36f},
+    {15982.8f, -6404.6f, -102.32f, 15.87f},
+    {15051.0f, -6531.7f, -100.17f, 33.72f},
+    {14177.6f, -6464.3f, -96.17f, 47.12f},
+    {13372.6f, -6267.2f, -91.00f, 56.54f},
+    {12640.4f, -5981.2f, -85.19f, 63.47f},
+    {11984.3f, -5621.3f, -78.92f, 69.34f},
+    {11411.2f, -5188.8f, -71.97f, 74.39f},
+    {10934.6f, -4690.2f, -63.93f, 77.31f},
+    {10575.8f, -4154.0f, -54.48f, 75.87f},
+    {10361.4f, -3634.1f, -43.57f, 68.10f},
+    {10319.7f, -3201.9f, -31.39f, 53.46f},
+    {10475.8f, -2930.9f, -18.25f, 33.17f},
+    {10846.1f, -2881.4f, -4.65f, 9.74f},
+    {11432.8f, -3091.3f, 8.80f, -13.82f},
+    {12219.9f, -3569.8f, 21.24f, -34.71f},
+    {13171.8f, -4293.8f, 31.80f, -50.65f},
+    {14237.9f, -5203.6f, 39.81f, -60.04f},
+    {15362.1f, -6204.2f, 45.12f, -62.12f},
+    {16493.6f, -7176.0f, 48.05f, -57.07f},
+    {17596.5f, -7997.8f, 49.26f, -46.04f},
+    {18652.1f, -8573.0f, 49.42f, -30.81f},
+    {19655.2f, -8848.3f, 49.06f, -13.38f},
+    {20607.5f, -8814.3f, 48.60f, 4.32f},
+    {21513.4f, -8490.0f, 48.43f, 20.45f},
+    {22380.1f, -7902.9f, 48.89f, 33.17f},
+    {23220.5f, -7080.7f, 50.14f, 40.78f},
+    {24052.7f, -6059.0f, 51.95f, 42.28f},
+    {24893.4f, -4897.1f, 53.71f, 37.88f},
+    {25746.0f, -3685.2f, 54.62f, 29.14f},
+    {26590.4f, -2528.9f, 53.93f, 18.36f},
+    {27383.7f, -1516.1f, 51.21f, 7.65f},
+    {28072.3f, -683.2f, 46.28f, -1.72f},
+    {28612.2f, -2.6f, 39.18f, -9.40f},
+    {28986.1f, 598.9f, 30.12f, -15.31f},
+    {29209.1f, 1202.8f, 19.51f, -19.11f},
+    {29318.9f, 1862.7f, 8.10f, -20.14f},
+    {29359.7f, 2589.1f, -3.13f, -17.95f},
+    {29366.5f, 3359.0f, -13.17f, -12.80f},
+    {29359.7f, 4136.9f, -21.30f, -5.73f},
+    {29347.2f, 4891.5f, -27.27f, 1.90f},
+    {29331.8f, 5599.5f, -31.14f, 9.17f},
+    {29314.6f, 6239.4f, -33.10f, 15.85f},
+    {29295.3f, 6787.0f, -33.28f, 22.21f},
+    {29269.1f, 7219.7f, -31.75f, 28.35f},
+    {29226.2f, 7527.3f, -28.67f, 33.83f},
+    {26803.3f, 8126.3f, -25.16f, 34.65f},
+    {26792.3f, 8278.0f, -21.29f, 35.78f},
+    {26748.3f, 8369.6f, -17.54f, 34.38f},
+    {26676.2f, 8420.3f, -14.56f, 30.40f},
+    {26583.6f, 8437.5f, -12.76f, 24.33f},
+    {26477.0f, 8420.0f, -12.30f, 17.02f},
+    {26358.5f, 8363.9f, -13.07f, 9.43f},
+    {26225.0f, 8268.4f, -14.82f, 2.29f},
+    {26068.9f, 8137.8f, -17.29f, -4.12f},
+    {25879.5f, 7981.2f, -20.27f, -9.86f},
+    {25645.6f, 7810.4f, -23.69f, -15.17f},
+    {25359.5f, 7638.6f, -27.54f, -20.13f},
+    {25020.3f, 7476.3f, -31.74f, -24.55f},
+    {24635.6f, 7323.6f, -36.06f, -28.14f},
+    {24220.0f, 7161.1f, -40.10f, -30.90f},
+    {23789.5f, 6943.0f, -43.54f, -33.40f},
+    {23353.3f, 6599.6f, -46.33f, -36.73f},
+    {22908.7f, 6052.7f, -48.86f, -41.91f},
+    {22439.3f, 5238.4f, -51.84f, -49.16f},
+    {21920.1f, 4131.0f, -56.01f, -57.47f},
+    {21325.0f, 2758.3f, -61.78f, -64.73f},
+    {20635.7f, 1201.5f, -69.01f, -68.41f},
+    {19846.9f, -419.0f, -77.05f, -66.44f},
+    {18967.8f, -1968.1f, -84.94f, -57.92f},
+    {18020.0f, -3323.3f, -91.69f, -43.38f},
+    {17033.0f, -4397.7f, -96.48f, -24.58f},
+    {16038.5f, -5153.3f, -98.86f, -4.12f},
+    {15064.7f, -5601.6f, -98.79f, 15.35f},
+    {14132.1f, -5791.7f, -96.63f, 31.78f},
+    {13251.7f, -5789.0f, -93.00f, 44.28f},
+    {12427.0f, -5654.2f, -88.47f, 53.26f},
+    {11658.3f, -5428.5f, -83.31f, 59.85f},
+    {10949.9f, -5132.6f, -77.30f, 65.04f},
+    {10314.7f, -4777.2f, -69.94f, 68.83f},
+    {9776.0f, -4379.8f, -60.75f, 69.97f},
+    {9364.6f, -3976.9f, -49.63f, 66.51f},
+    {9112.7f, -3625.8f, -37.01f, 56.88f},
+    {9047.5f, -3396.2f, -23.70f, 40.80f},
+    {9185.6f, -3353.6f, -10.68f, 19.59f},
+    {9529.6f, -3545.8f, 1.21f, -4.14f},
+    {10066.2f, -3993.2f, 11.32f, -27.27f},
+    {10766.9f, -4685.5f, 19.23f, -46.91f},
+    {11589.3f, -5581.5f, 24.76f, -60.87f},
+    {12483.2f, -6609.9f, 27.97f, -67.86f},
+    {13398.6f, -7673.9f, 29.19f, -67.53f},
+    {14295.1f, -8663.0f, 29.03f, -60.43f},
+    {15148.4f, -9470.6f, 28.15f, -47.86f},
+    {15952.2f, -10014.6f, 27.20f, -31.58f},
+    {16713.4f, -10251.0f, 26.67f, -13.55f},
+    {17445.4f, -10174.3f, 26.97f, 4.33f},
+    {18162.7f, -9805.5f, 28.41f, 20.19f},
+    {18879.8f, -9176.2f, 31.13f, 32.30f},
+    {19611.5f, -8319.3f, 34.93f, 39.30f},
+    {20373.3f, -7273.2f, 39.23f, 40.61f},
+    {21175.8f, -6090.5f, 43.13f, 36.78f},
+    {22016.3f, -4844.1f, 45.65f, 29.40f},
+    {22871.3f, -3616.9f, 46.10f, 20.54f},
+    {23697.6f, -2480.8f, 44.18f, 11.98f},
+    {24442.9f, -1472.7f, 39.95f, 4.72f},
+    {25062.9f, -585.0f, 33.68f, -1.02f},
+    {25536.1f, 224.8f, 25.72f, -5.31f},
+    {25868.9f, 1009.3f, 16.51f, -8.01f},
+    {26089.8f, 1806.8f, 6.68f, -8.75f},
+    {26234.9f, 2629.1f, -3.00f, -7.18f},
+    {26336.4f, 3465.1f, -11.76f, -3.44f},
+    {26415.8f, 4292.5f, -19.02f, 1.78f},
+    {26484.8f, 5088.2f, -24.55f, 7.51f},
+    {26549.8f, 5831.6f, -28.38f, 13.01f},
+    {26614.2f, 6502.1f, -30.64f, 18.08f},
+    {26678.2f, 7078.2f, -31.39f, 22.84f},
+    {26737.3f, 7542.5f, -30.64f, 27.44f},
+    {26782.5f, 7888.6f, -28.46f, 31.60f},
+    {24253.7f, 8518.5f, -25.45f, 32.83f},
+    {24352.0f, 8715.6f, -22.67f, 33.63f},
+    {24423.3f, 8846.9f, -19.78f, 32.54f},
+    {24471.0f, 8927.8f, -17.32f, 29.37f},
+    {24499.9f, 8965.9f, -15.74f, 24.38f},
+    {24513.0f, 8964.1f, -15.25f, 18.16f},
+    {24508.8f, 8924.1f, -15.86f, 11.46f},
+    {24481.4f, 8850.8f, -17.41f, 4.93f},
+    {24421.4f, 8753.1f, -19.68f, -1.10f},
+    {24317.9f, 8641.7f, -22.47f, -6.61f},
+    {24161.0f, 8526.8f, -25.67f, -11.73f},
+    {23945.0f, 8415.6f, -29.21f, -16.55f},
+    {23671.3f, 8309.2f, -32.98f, -21.01f},
+    {23349.3f, 8197.4f, -36.72f, -24.97f},
+    {22995.3f, 8054.0f, -40.11f, -28.50f},
+    {22626.8f, 7833.2f, -42.91f, -31.99f},
+    {22255.1f, 7473.4f, -45.13f, -36.11f},
+    {21879.8f, 6908.9f, -47.17f, -41.45f},
+    {21486.0f, 6087.9f, -49.74f, -48.04f},
+    {21047.4f, 4991.7f, -53.53f, -54.99f},
+    {20534.4f, 3646.8f, -58.93f, -60.64f},
+    {19922.8f, 2126.6f, -65.80f, -63.02f},
+    {19201.3f, 539.8f, -73.47f, -60.50f},
+    {18375.1f, -989.7f, -80.94f, -52.35f},
+    {17465.2f, -2347.2f, -87.18f, -38.99f},
+    {16503.1f, -3448.5f, -91.36f, -21.93f},
+    {15524.5f, -4252.7f, -93.07f, -3.35f},
+    {14561.0f, -4764.2f, -92.40f, 14.48f},
+    {13635.8f, -5022.4f, -89.81f, 29.78f},
+    {12761.2f, -5084.7f, -85.92f, 41.71f},
+    {11941.4f, -5008.4f, -81.22f, 50.38f},
+    {11178.7f, -4838.6f, -75.82f, 56.45f},
+    {10479.7f, -4606.2f, -69.41f, 60.48f},
+    {9860.4f, -4335.3f, -61.46f, 62.36f},
+    {9345.8f, -4055.2f, -51.63f, 61.12f},
+    {8965.8f, -3808.2f, -40.02f, 55.40f},
+    {8747.9f, -3650.0f, -27.35f, 44.19f},
+    {8710.0f, -3641.2f, -14.77f, 27.51f},
+    {8855.9f, -3833.9f, -3.50f, 6.72f},
+    {9174.1f, -4259.8f, 5.47f, -15.78f},
+    {9638.9f, -4922.9f, 11.62f, -37.15f},
+    {10213.8f, -5797.6f, 14.88f, -54.77f},
+    {10855.6f, -6831.0f, 15.59f, -66.66f},
+    {11519.6f, -7946.4f, 14.36f, -71.75f},
+    {12167.4f, -9050.7f, 11.94f, -69.90f},
+    {12772.6f, -10044.4f, 9.14f, -61.77f},
+    {13325.5f, -10836.5f, 6.71f, -48.68f},
+    {13832.6f, -11358.9f, 5.24f, -32.34f},
+    {14311.8f, -11576.4f, 5.14f, -14.61f},
+    {14785.5f, -11486.0f, 6.67f, 2.61f},
+    {15275.1f, -11107.8f, 9.90f, 17.57f},
+    {15798.2f, -10472.8f, 14.66f, 28.78f},
+    {16369.3f, -9614.8f, 20.42f, 35.24f},
+    {16999.0f, -8570.4f, 26.35f, 36.78f},
+    {17692.1f, -7384.7f, 31.46f, 34.10f},
+    {18441.3f, -6114.8f, 34.84f, 28.67f},
+    {19223.8f, -4825.0f, 35.93f, 22.19f},
+    {20001.2f, -3573.9f, 34.63f, 16.03f},
+    {20728.3f, -2399.3f, 31.17f, 10.91f},
+    {21365.3f, -1310.5f, 25.94f, 6.94f},
+    {21889.1f, -292.0f, 19.35f, 4.01f},
+    {22298.2f, 682.8f, 11.83f, 2.16f},
+    {22609.5f, 1636.0f, 3.86f, 1.64f},
+    {22849.0f, 2577.0f, -3.99f, 2.71f},
+    {23042.5f, 3501.2f, -11.14f, 5.33f},
+    {23210.4f, 4396.0f, -17.18f, 9.08f},
+    {23366.6f, 5245.4f, -21.92f, 13.27f},
+    {23519.7f, 6032.4f, -25.37f, 17.35f},
+    {23674.5f, 6739.3f, -27.64f, 21.08f},
+    {23831.3f, 7348.9f, -28.78f, 24.51f},
+    {23985.8f, 7848.6f, -28.76f, 27.74f},
+    {24129.6f, 8235.5f, -27.60f, 30.66f},
+    {21575.8f, 8888.3f, -25.40f, 32.52f},
+    {21789.2f, 9131.5f, -23.70f, 32.83f},
+    {21979.4f, 9303.4f, -21.75f, 31.73f},
+    {22147.2f, 9417.0f, -19.95f, 29.01f},
+    {22294.3f, 9481.6f, -18.68f, 24.78f},
+    {22420.5f, 9504.1f, -18.20f, 19.43f},
+    {22522.2f, 9491.8f, -18.58f, 13.51f},
+    {22592.8f, 9454.5f, -19.76f, 7.54f},
+    {22624.1f, 9403.6f, -21.58f, 1.86f},
+    {22607.9f, 9350.2f, -23.90f, -3.45f},
+    {22538.5f, 9301.3f, -26.59f, -8.46f},
+    {22414.3f, 9257.3f, -29.57f, -13.27f},
+    {22240.0f, 9209.9f, -32.71f, -17.91f},
+    {22025.9f, 9139.1f, -35.85f, -22.36f},
+    {21787.2f, 9012.3f, -38.75f, -26.69f},
+    {21538.2f, 8783.9f, -41.27f, -31.11f},
+    {21287.6f, 8400.1f, -43.46f, -35.94f},
+    {21032.6f, 7808.3f, -45.67f, -41.40f},
+    {20757.0f, 6970.6f, -48.43f, -47.31f},
+    {20433.8f, 5877.7f, -52.25f, -52.94f},
+    {20031.9f, 4557.6f, -57.40f, -57.03f},
+    {19524.2f, 3077.0f, -63.73f, -58.15f},
+    {18895.6f, 1532.1f, -70.64f, -55.13f},
+    {18147.9f, 32.9f, -77.21f, -47.42f},
+    {17299.7f, -1317.3f, -82.51f, -35.37f},
+    {16382.5f, -2439.7f, -85.79f, -20.14f},
+    {15433.9f, -3292.0f, -86.68f, -3.48f},
+    {14489.9f, -3870.9f, -85.27f, 12.77f},
+    {13579.1f, -4205.7f, -81.97f, 27.05f},
+    {12720.2f, -4344.7f, -77.34f, 38.47f},
+    {11924.0f, -4341.8f, -71.80f, 46.79f},
+    {11197.8f, -4246.1f, -65.47f, 52.21f},
+    {10551.3f, -4098.5f, -58.17f, 54.94f},
+    {9999.8f, -3935.8f, -49.58f, 54.84f},
+    {9563.4f, -3796.5f, -39.59f, 51.34f},
+    {9263.2f, -3725.1f, -28.49f, 43.71f},
+    {9114.8f, -3771.5f, -17.08f, 31.52f},
+    {9122.6f, -3983.4f, -6.53f, 15.13f},
+    {9277.0f, -4397.2f, 2.02f, -4.19f},
+    {9555.2f, -5028.7f, 7.69f, -24.42f},
+    {9923.9f, -5868.5f, 10.14f, -43.21f},
+    {10344.0f, -6881.3f, 9.53f, -58.38f},
+    {10775.6f, -8009.3f, 6.48f, -68.28f},
+    {11183.4f, -9176.8f, 1.90f, -72.03f},
+    {11541.7f, -10298.2f, -3.22f, -69.55f},
+    {11838.7f, -11286.9f, -7.94f, -61.45f},
+    {12077.8f, -12066.7f, -11.47f, -48.93f},
+    {12275.9f, -12581.9f, -13.25f, -33.54f},
+    {12458.7f, -12803.4f, -12.95f, -17.02f},
+    {12654.2f, -12728.4f, -10.50f, -1.11f},
+    {12887.0f, -12373.1f, -6.09f, 12.62f},
+    {13176.2f, -11764.0f, -0.18f, 22.96f},
+    {13534.9f, -10931.3f, 6.50f, 29.26f},
+    {13970.5f, -9907.5f, 13.01f, 31.54f},
+    {14484.0f, -8730.0f, 18.44f, 30.55f},
+    {15067.5f, -7443.9f, 22.06f, 27.46f},
+    {15701.6f, -6099.6f, 23.50f, 23.57f},
+    {16356.7f, -4746.3f, 22.80f, 19.83f},
+    {16997.5f, -3422.6f, 20.27f, 16.72f},
+    {17591.3f, -2150.3f, 16.30f, 14.29f},
+    {18116.2f, -935.2f, 11.28f, 12.46f},
+    {18564.5f, 227.7f, 5.58f, 11.26f},
+    {18942.3f, 1345.3f, -0.45f, 10.89f},
+    {19264.4f, 2420.9f, -6.40f, 11.57f},
+    {19548.4f, 3451.7f, -11.87f, 13.35f},
+    {19810.4f, 4430.2f, -16.56f, 15.97f},
+    {20063.0f, 5345.6f, -20.32f, 19.00f},
+    {20315.0f, 6185.5f, -23.17f, 21.99f},
+    {20570.9f, 6936.3f, -25.18f, 24.72f},
+    {20830.7f, 7586.0f, -26.42f, 27.15f},
+    {21089.8f, 8126.7f, -26.88f, 29.34f},
+    {21340.8f, 8558.1f, -26.52f, 31.22f},
+    {18777.9f, 9227.1f, -24.79f, 33.74f},
+    {19110.3f, 9521.3f, -23.86f, 33.48f},
+    {19420.3f, 9739.8f, -22.65f, 32.13f},
+    {19706.6f, 9894.8f, -21.44f, 29.52f},
+    {19968.0f, 9997.2f, -20.49f, 25.69f},
+    {20202.2f, 10057.6f, -20.04f, 20.89f},
+    {20405.0f, 10087.7f, -20.21f, 15.53f},
+    {20571.5f, 10100.0f, -20.99f, 9.99f},
+    {20696.9f, 10106.8f, -22.30f, 4.57f},
+    {20777.9f, 10117.3f, -24.02f, -0.62f},
+    {20814.4f, 10134.5f, -26.05f, -5.63f},
+    {20809.9f, 10152.2f, -28.33f, -10.53f},
+    {20771.5f, 10154.2f, -30.77f, -15.40f},
+    {20709.7f, 10113.5f, -33.28f, -20.31f},
+    {20635.6f, 9993.4f, -35.76f, -25.28f},
+    {20557.7f, 9750.1f, -38.17f, -30.38f},
+    {20477.8f, 9337.7f, -40.60f, -35.69f},
+    {20387.5f, 8716.3f, -43.26f, -41.14f},
+    {20267.5f, 7861.4f, -46.50f, -46.43f},
+    {20089.6f, 6773.2f, -50.62f, -50.95f},
+    {19822.8f, 5482.3f, -55.72f, -53.78f},
+    {19439.8f, 4049.3f, -61.61f, -53.93f},
+    {18924.8f, 2558.1f, -67.78f, -50.60f},
+    {18277.6f, 1103.2f, -73.46f, -43.45f},
+    {17514.6f, -225.7f, -77.87f, -32.75f},
+    {16666.3f, -1358.2f, -80.36f, -19.38f},
+    {15770.7f, -2253.2f, -80.61f, -4.66f},
+    {14867.0f, -2902.1f, -78.61f, 9.93f},
+    {13989.5f, -3324.7f, -74.66f, 23.06f},
+    {13164.6f, -3561.1f, -69.22f, 33.76f},
+    {12410.8f, -3660.3f, -62.66f, 41.54f},
+    {11741.4f, -3673.1f, -55.23f, 46.23f},
+    {11168.0f, -3646.6f, -46.97f, 47.80f},
+    {10702.6f, -3625.4f, -37.89f, 46.14f},
+    {10357.0f, -3652.5f, -28.12f, 41.02f},
+    {10139.9f, -3771.1f, -18.11f, 32.27f},
+    {10053.2f, -4022.4f, -8.60f, 19.93f},
+    {10088.1f, -4440.9f, -0.53f, 4.59f},
+    {10224.6f, -5048.0f, 5.18f, -12.60f},
+    {10433.0f, -5846.3f, 7.93f, -30.04f},
+    {10677.6f, -6817.4f, 7.53f, -45.91f},
+    {10921.4f, -7921.8f, 4.28f, -58.54f},
+    {11130.8f, -9102.3f, -1.11f, -66.64f},
+    {11280.3f, -10289.6f, -7.69f, -69.52f},
+    {11355.7f, -11408.3f, -14.43f, -67.08f},
+    {11356.1f, -12385.2f, -20.36f, -59.82f},
+    {11294.1f, -13157.0f, -24.70f, -48.72f},
+    {11193.1f, -13677.7f, -26.90f, -35.10f},
+    {11082.2f, -13921.9f, -26.73f, -20.46f},
+    {10991.3f, -13884.2f, -24.24f, -6.30f},
+    {10946.4f, -13574.9f, -19.77f, 6.09f},
+    {10967.1f, -13013.3f, -13.92f, 15.77f},
+    {11066.6f, -12223.6f, -7.48f, 22.27f},
+    {11252.1f, -11232.6f, -1.32f, 25.72f},
+    {11524.8f, -10071.3f, 3.79f, 26.70f},
+    {11879.4f, -8776.3f, 7.33f, 26.07f},
+    {12303.1f, -7388.8f, 9.07f, 24.70f},
+    {12775.9f, -5951.8f, 9.12f, 23.20f},
+    {13273.4f, -4504.1f, 7.75f, 21.87f},
+    {13771.4f, -3076.2f, 5.28f, 20.76f},
+    {14250.5f, -1688.2f, 2.02f, 19.84f},
+    {14699.6f, -351.8f, -1.78f, 19.18f},
+    {15116.4f, 926.7f, -5.87f, 18.97f},
+    {15505.3f, 2142.9f, -9.97f, 19.42f},
+    {15874.6f, 3291.7f, -13.80f, 20.61f},
+    {16233.6f, 4367.0f, -17.14f, 22.43f},
+    {16590.5f, 5361.1f, -19.87f, 24.61f},
+    {16951.1f, 6265.3f, -21.99f, 26.83f},
+    {17317.9f, 7070.9f, -23.56f, 28.87f},
+    {17689.5f, 7770.7f, -24.63f, 30.63f},
+    {18061.3f, 8361.2f, -25.21f, 32.09f},
+    {18426.5f, 8844.2f, -25.27f, 33.18f},
+    {15810.0f, 9522.7f, -23.14f, 36.23f},
+    {16263.4f, 9878.6f, -22.51f, 35.44f},
+    {16694.0f, 10155.8f, -21.67f, 33.71f},
+    {17098.5f, 10366.5f, -20.78f, 30.97f},
+    {17473.9f, 10523.2f, -20.03f, 27.23f},
+    {17817.3f, 10638.7f, -19.60f, 22.68f},
+    {18125.7f, 10726.6f, -19.58f, 17.61f},
+    {18397.2f, 10800.0f, -20.00f, 12.30f},
+    {18631.4f, 10870.1f, -20.83f, 6.98f},
+    {18830.6f, 10942.7f, -21.98f, 1.77f},
+    {18999.7f, 11016.4f, -23.38f, -3.35f},
+    {19146.1f, 11079.8f, -25.00f, -8.43f},
+    {19278.4f, 11111.9f, -26.79f, -13.57f},
+    {19405.0f, 11082.2f, -28.76f, -18.81f},
+    {19531.9f, 10954.0f, -30.90f, -24.17f},
+    {19660.2f, 10687.5f, -33.26f, -29.63f},
+    {19783.7f, 10245.3f, -35.92f, -35.09f},
+    {19887.4f, 9599.1f, -39.03f, -40.35f},
+    {19948.3f, 8735.8f, -42.77f, -45.06f},
+    {19937.4f, 7663.5f, -47.25f, -48.69f},
+    {19824.9f, 6414.0f, -52.43f, -50.60f},
+    {19585.7f, 5042.0f, -58.08f, -50.12f},
+    {19205.4f, 3618.8f, -63.74f, -46.75f},
+    {18683.7f, 2223.3f, -68.82f, -40.29f},
+    {18036.0f, 930.3f, -72.66f, -30.98f},
+    {17290.6f, -200.5f, -74.72f, -19.47f},
+    {16484.6f, -1131.8f, -74.68f, -6.76f},
+    {15658.0f, -1852.7f, -72.46f, 5.98f},
+    {14848.5f, -2376.0f, -68.23f, 17.62f},
+    {14087.5f, -2733.7f, -62.34f, 27.24f},
+    {13399.0f, -2968.9f, -55.15f, 34.18f},
+    {12800.4f, -3129.5f, -47.01f, 38.08f},
+    {12303.6f, -3263.7f, -38.22f, 38.76f},
+    {11916.1f, -3417.4f, -29.05f, 36.17f},
+    {11641.3f, -3633.0f, -19.86f, 30.33f},
+    {11476.8f, -3948.9f, -11.16f, 21.40f},
+    {11413.0f, -4397.1f, -3.57f, 9.75f},
+    {11431.8f, -5000.3f, 2.21f, -3.94f},
+    {11507.5f, -5767.8f, 5.58f, -18.66f},
+    {11608.4f, -6693.4f, 6.18f, -33.17f},
+    {11700.8f, -7753.7f, 3.99f, -46.15f},
+    {11752.8f, -8909.5f, -0.65f, -56.37f},
+    {11738.1f, -10108.7f, -7.10f, -62.89f},
+    {11639.6f, -11290.6f, -14.49f, -65.18f},
+    {11451.3f, -12391.6f, -21.89f, -63.15f},
+    {11179.0f, -13350.9f, -28.43f, -57.14f},
+    {10839.4f, -14116.4f, -33.37f, -47.92f},
+    {10457.6f, -14648.8f, -36.24f, -36.50f},
+    {10062.7f, -14924.2f, -36.82f, -24.08f},
+    {9684.2f, -14933.8f, -35.20f, -11.83f},
+    {9348.0f, -14680.7f, -31.74f, -0.77f},
+    {9074.9f, -14176.6f, -27.01f, 8.38f},
+    {8880.0f, -13438.7f, -21.70f, 15.28f},
+    {8773.2f, -12488.2f, -16.52f, 19.99f},
+    {8759.6f, -11350.8f, -12.06f, 22.88f},
+    {8839.4f, -10057.3f, -8.69f, 24.49f},
+    {9007.7f, -8643.3f, -6.55f, 25.32f},
+    {9254.0f, -7147.4f, -5.58f, 25.74f},
+    {9564.3f, -5608.3f, -5.60f, 25.94f},
+    {9922.1f, -4060.9f, -6.41f, 25.97f},
+    {10312.4f, -2534.4f, -7.83f, 25.88f},
+    {10722.8f, -1051.2f, -9.71f, 25.77f},
+    {11145.5f, 372.0f, -11.90f, 25.83f},
+    {11576.8f, 1723.0f, -14.22f, 26.24f},
+    {12016.2f, 2992.4f, -16.47f, 27.14f},
+    {12464.9f, 4172.5f, -18.49f, 28.47f},
+    {12924.5f, 5256.5f, -20.17f, 30.11f},
+    {13395.6f, 6238.3f, -21.49f, 31.82f},
+    {13877.0f, 7112.9f, -22.45f, 33.41f},
+    {14365.2f, 7877.1f, -23.10f, 34.75f},
+    {14854.6f, 8530.5f, -23.45f, 35.73f},
+    {15338.5f, 9076.7f, -23.46f, 36.27f},
+    {12580.5f, 9758.3f, -20.01f, 39.59f},
+    {13154.4f, 10192.4f, -19.18f, 38.33f},
+    {13705.9f, 10546.3f, -18.24f, 36.22f},
+    {14230.6f, 10831.9f, -17.31f, 33.23f},
+    {14725.0f, 11062.2f, -16.50f, 29.39f},
+    {15186.9f, 11250.6f, -15.93f, 24.86f},
+    {15615.4f, 11410.1f, -15.68f, 19.84f},
+    {16011.9f, 11552.3f, -15.77f, 14.55f},
+    {16380.2f, 11685.3f, -16.19f, 9.17f},
+    {16726.3f, 11811.3f, -16.88f, 3.79f},
+    {17058.4f, 11925.1f, -17.81f, -1.56f},
+    {17385.4f, 12012.4f, -18.95f, -6.91f},
+    {17715.0f, 12050.7f, -20.33f, -12.30f},
+    {18052.5f, 12010.6f, -21.97f, -17.77f},
+    {18398.2f, 11858.8f, -23.95f, -23.28f},
+    {18746.4f, 11562.3f, -26.33f, -28.77f},
+    {19084.3f, 11092.7f, -29.21f, -34.07f},
+    {19391.8f, 10431.8f, -32.68f, -38.94f},
+    {19643.5f, 9575.2f, -36.80f, -43.03f},
+    {19810.8f, 8535.8f, -41.55f, -45.93f},
+    {19866.5f, 7344.8f, -46.83f, -47.18f},
+    {19789.1f, 6049.3f, -52.35f, -46.36f},
+    {19566.9f, 4708.4f, -57.73f, -43.16f},
+    {19200.8f, 3385.3f, -62.46f, -37.52f},
+    {18704.9f, 2139.6f, -66.02f, -29.65f},
+    {18105.3f, 1019.5f, -67.96f, -20.06f},
+    {17435.9f, 56.1f, -67.97f, -9.49f},
+    {16734.7f, -739.4f, -65.93f, 1.14f},
+    {16038.3f, -1375.3f, -61.93f, 10.93f},
+    {15379.2f, -1875.7f, -56.20f, 19.03f},
+    {14782.9f, -2276.3f, -49.11f, 24.82f},
+    {14267.5f, -2618.6f, -41.07f, 27.85f},
+    {13843.5f, -2945.8f, -32.52f, 27.92f},
+    {13514.6f, -3299.6f, -23.90f, 25.01f},
+    {13277.8f, -3717.4f, -15.70f, 19.27f},
+    {13123.4f, -4230.5f, -8.41f, 11.01f},
+    {13035.1f, -4862.4f, -2.56f, 0.74f},
+    {12990.7f, -5626.2f, 1.39f, -10.88f},
+    {12963.2f, -6523.3f, 3.08f, -22.99f},
+    {12923.1f, -7542.2f, 2.34f, -34.65f},
+    {12841.3f, -8658.6f, -0.74f, -44.92f},
+    {12692.3f, -9836.2f, -5.84f, -52.94f},
+    {12456.6f, -11030.0f, -12.41f, -58.05f},
+    {12123.6f, -12189.2f, -19.75f, -59.87f},
+    {11691.9f, -13261.5f, -27.11f, -58.30f},
+    {11170.1f, -14197.1f, -33.77f, -53.60f},
+    {10575.3f, -14952.4f, -39.10f, -46.28f},
+    {9931.1f, -15493.5f, -42.69f, -37.10f},
+    {9264.4f, -15797.1f, -44.35f, -26.90f},
+    {8602.9f, -15850.8f, -44.10f, -16.54f},
+    {7972.1f, -15651.6f, -42.23f, -6.78f},
+    {7394.5f, -15204.5f, -39.16f, 1.84f},
+    {6888.4f, -14520.3f, -35.40f, 9.03f},
+    {6468.4f, -13615.5f, -31.46f, 14.75f},
+    {6145.4f, -12511.2f, -27.75f, 19.17f},
+    {5926.1f, -11234.2f, -24.56f, 22.52f},
+    {5813.5f, -9816.2f, -22.00f, 25.09f},
+    {5805.9f, -8292.7f, -20.10f, 27.05f},
+    {5897.7f, -6700.7f, -18.79f, 28.52f},
+    {6080.0f, -5076.6f, -18.01f, 29.59f},
+    {6341.8f, -3453.7f, -17.69f, 30.33f},
+    {6671.9f, -1860.6f, -17.78f, 30.87f},
+    {7059.8f, -320.9f, -18.20f, 31.37f},
+    {7496.6f, 1147.1f, -18.84f, 32.02f},
+    {7974.8f, 2529.3f, -19.58f, 32.92f},
+    {8488.3f, 3815.0f, -20.28f, 34.10f},
+    {9031.7f, 4996.7f, -20.85f, 35.47f},
+    {9599.7f, 6068.8f, -21.23f, 36.90f},
+    {10186.5f, 7028.1f, -21.40f, 38.22f},
+    {10785.4f, 7873.6f, -21.36f, 39.28f},
+    {11389.1f, 8607.1f, -21.12f, 39.94f},
+    {11989.9f, 9233.0f, -20.66f, 40.09f},
+    {8997.1f, 9913.4f, -15.37f, 43.27f},
+    {9685.2f, 10446.9f, -13.89f, 41.65f},
+    {10355.5f, 10898.9f, -12.43f, 39.22f},
+    {11003.1f, 11280.7f, -11.05f, 35.97f},
+    {11625.0f, 11604.0f, -9.85f, 31.97f},
+    {12220.2f, 11880.8f, -8.91f, 27.35f},
+    {12789.7f, 12121.9f, -8.29f, 22.25f},
+    {13337.0f, 12335.6f, -8.01f, 16.84f},
+    {13868.0f, 12526.4f, -8.05f, 11.27f},
+    {14390.2f, 12693.4f, -8.41f, 5.64f},
+    {14911.9f, 12828.9f, -9.06f, 0.00f},
+    {15440.7f, 12918.5f, -10.00f, -5.63f},
+    {15981.7f, 12941.6f, -11.26f, -11.23f},
+    {16535.9f, 12873.2f, -12.88f, -16.81f},
+    {17099.1f, 12686.8f, -14.94f, -22.29f},
+    {17660.6f, 12357.7f, -17.51f, -27.57f},
+    {18203.9f, 11866.8f, -20.65f, -32.48f},
+    {18707.1f, 11204.0f, -24.41f, -36.80f},
+    {19144.8f, 10370.8f, -28.77f, -40.25f},
+    {19491.2f, 9381.9f, -33.67f, -42.51f},
+    {19722.9f, 8265.1f, -38.92f, -43.30f},
+    {19822.6f, 7059.2f, -44.27f, -42.35f},
+    {19781.7f, 5810.2f, -49.37f, -39.53f},
+    {19602.1f, 4566.5f, -53.82f, -34.84f},
+    {19296.4f, 3373.3f, -57.19f, -28.49f},
+    {18886.9f, 2267.1f, -59.13f, -20.88f},
+    {18402.5f, 1272.3f, -59.38f, -12.58f},
+    {17875.5f, 398.8f, -57.80f, -4.26f},
+    {17338.4f, -358.2f, -54.45f, 3.37f},
+    {16819.7f, -1015.9f, -49.52f, 9.65f},
+    {16342.6f, -1600.9f, -43.33f, 14.03f},
+    {15922.9f, -2145.6f, -36.29f, 16.15f},
+    {15569.1f, -2684.5f, -28.87f, 15.81f},
+    {15281.8f, -3250.9f, -21.55f, 13.02f},
+    {15054.7f, -3874.3f, -14.81f, 7.96f},
+    {14875.3f, -4577.8f, -9.12f, 0.96f},
+    {14725.6f, -5377.2f, -4.88f, -7.49f},
+    {14583.4f, -6278.8f, -2.40f, -16.79f},
+    {14424.2f, -7279.3f, -1.89f, -26.28f},
+    {14223.0f, -8365.2f, -3.39f, -35.26f},
+    {13956.6f, -9513.4f, -6.77f, -43.06f},
+    {13605.6f, -10692.5f, -11.76f, -49.09f},
+    {13156.5f, -11864.9f, -17.91f, -52.90f},
+    {12602.8f, -12989.3f, -24.70f, -54.22f},
+    {11945.7f, -14023.0f, -31.57f, -53.00f},
+    {11194.3f, -14925.7f, -37.94f, -49.39f},
+    {10364.1f, -15661.1f, -43.35f, -43.73f},
+    {9476.0f, -16199.2f, -47.45f, -36.51f},
+    {8554.0f, -16517.7f, -50.05f, -28.30f},
+    {7623.8f, -16602.1f, -51.12f, -19.69f},
+    {6710.6f, -16445.4f, -50.81f, -11.20f},
+    {5838.4f, -16047.6f, -49.38f, -3.24f},
+    {5028.7f, -15415.0f, -47.12f, 3.92f},
+    {4300.9f, -14559.8f, -44.38f, 10.18f},
+    {3671.2f, -13499.8f, -41.43f, 15.52f},
+    {3152.9f, -12258.2f, -38.49f, 20.03f},
+    {2755.2f, -10863.4f, -35.69f, 23.80f},
+    {2483.8f, -9347.3f, -33.11f, 26.91f},
+    {2339.6f, -7744.6f, -30.80f, 29.44f},
+    {2319.8f, -6090.4f, -28.79f, 31.46f},
+    {2418.0f, -4418.3f, -27.08f, 33.07f},
+    {2625.3f, -2759.3f, -25.70f, 34.37f},
+    {2931.0f, -1140.1f, -24.61f, 35.53f},
+    {3324.0f, 416.9f, -23.76f, 36.65f},
+    {3792.6f, 1894.0f, -23.08f, 37.85f},
+    {4325.9f, 3277.5f, -22.46f, 39.15f},
+    {4912.9f, 4557.8f, -21.83f, 40.52f},
+    {5543.2f, 5728.5f, -21.10f, 41.85f},
+    {6206.6f, 6786.1f, -20.24f, 43.01f},
+    {6893.2f, 7730.2f, -19.23f, 43.87f},
+    {7593.1f, 8562.7f, -18.07f, 44.28f},
+    {8297.2f, 9288.2f, -16.77f, 44.12f},
+    {5025.9f, 9968.2f, -9.79f, 46.64f},
+    {5813.5f, 10622.5f, -7.39f, 44.76f},
+    {6594.8f, 11193.6f, -5.09f, 42.10f},
+    {7365.1f, 11690.7f, -2.97f, 38.68f},
+    {8121.6f, 12123.0f, -1.11f, 34.57f},
+    {8863.7f, 12499.4f, 0.41f, 29.86f},
+    {9593.1f, 12827.2f, 1.56f, 24.68f},
+    {10313.3f, 13111.2f, 2.30f, 19.17f},
+    {11029.5f, 13352.8f, 2.62f, 13.44f},
+    {11747.9f, 13548.8f, 2.53f, 7.61f},
+    {12474.0f, 13691.5f, 2.03f, 1.76f},
+    {13212.1f, 13768.4f, 1.11f, -4.05f},
+    {13963.3f, 13763.4f, -0.24f, -9.76f},
+    {14724.8f, 13658.3f, -2.06f, -15.30f},
+    {15489.0f, 13434.6f, -4.38f, -20.60f},
+    {16243.3f, 13076.7f, -7.23f, -25.54f},
+    {16970.6f, 12573.6f, -10.65f, -29.96f},
+    {17650.3f, 11921.5f, -14.61f, -33.70f},
+    {18260.3f, 11125.3f, -19.06f, -36.56f},
+    {18779.4f, 10199.0f, -23.88f, -38.34f},
+    {19189.0f, 9164.9f, -28.91f, -38.88f},
+    {19476.1f, 8052.7f, -33.90f, -38.04f},
+    {19634.7f, 6896.0f, -38.57f, -35.79f},
+    {19666.8f, 5729.4f, -42.61f, -32.21f},
+    {19582.5f, 4585.1f, -45.71f, -27.47f},
+    {19398.5f, 3489.2f, -47.61f, -21.91f},
+    {19137.1f, 2459.6f, -48.13f, -15.92f},
+    {18822.7f, 1504.5f, -47.18f, -9.99f},
+    {18480.2f, 622.1f, -44.79f, -4.63f},
+    {18131.6f, -198.0f, -41.13f, -0.29f},
+    {17794.8f, -973.5f, -36.47f, 2.62f},
+    {17481.7f, -1726.3f, -31.15f, 3.83f},
+    {17197.9f, -2480.2f, -25.58f, 3.22f},
+    {16942.6f, -3258.2f, -20.18f, 0.80f},
+    {16708.7f, -4080.2f, -15.36f, -3.28f},
+    {16484.3f, -4961.3f, -11.48f, -8.72f},
+    {16253.2f, -5910.3f, -8.85f, -15.14f},
+    {15996.6f, -6928.8f, -7.69f, -22.08f},
+    {15694.6f, -8010.9f, -8.09f, -29.05f},
+    {15327.7f, -9142.9f, -10.05f, -35.54f},
+    {14878.8f, -10304.6f, -13.45f, -41.10f},
+    {14334.0f, -11469.7f, -18.06f, -45.33f},
+    {13684.6f, -12607.8f, -23.55f, -47.92f},
+    {12927.2f, -13685.6f, -29.54f, -48.70f},
+    {12064.5f, -14669.3f, -35.64f, -47.64f},
+    {11105.1f, -15526.0f, -41.43f, -44.80f},
+    {10062.9f, -16225.8f, -46.57f, -40.41f},
+    {8956.3f, -16743.0f, -50.79f, -34.76f},
+    {7806.8f, -17057.0f, -53.91f, -28.21f},
+    {6638.1f, -17153.2f, -55.87f, -21.13f},
+    {5475.0f, -17022.9f, -56.71f, -13.88f},
+    {4341.9f, -16663.5f, -56.53f, -6.75f},
+    {3262.7f, -16078.3f, -55.50f, 0.03f},
+    {2259.8f, -15276.5f, -53.80f, 6.31f},
+    {1353.2f, -14272.7f, -51.60f, 12.01f},
+    {560.4f, -13086.9f, -49.09f, 17.11f},
+    {-104.5f, -11743.5f, -46.38f, 21.61f},
+    {-631.2f, -10270.7f, -43.58f, 25.52f},
+    {-1013.5f, -8699.3f, -40.79f, 28.89f},
+    {-1249.8f, -7061.1f, -38.09f, 31.78f},
+    {-1342.1f, -5387.8f, -35.52f, 34.24f},
+    {-1296.4f, -3709.2f, -33.12f, 36.39f},
+    {-1121.3f, -2052.6f, -30.90f, 38.30f},
+    {-827.7f, -441.6f, -28.84f, 40.07f},
+    {-428.0f, 1104.1f, -26.90f, 41.75f},
+    {64.8f, 2568.5f, -25.01f, 43.35f},
+    {637.0f, 3939.9f, -23.12f, 44.86f},
+    {1275.4f, 5209.9f, -21.15f, 46.21f},
+    {1966.9f, 6373.7f, -19.09f, 47.29f},
+    {2698.9f, 7429.4f, -16.90f, 47.98f},
+    {3459.7f, 8377.9f, -14.60f, 48.18f},
+    {4238.6f, 9222.4f, -12.22f, 47.76f},
+    {746.6f, 9908.5f, -4.25f, 49.04f},
+    {1609.0f, 10699.1f, -0.88f, 47.00f},
+    {2484.9f, 11404.1f, 2.32f, 44.25f},
+    {3369.2f, 12029.1f, 5.26f, 40.79f},
+    {4258.4f, 12579.9f, 7.86f, 36.70f},
+    {5151.1f, 13061.3f, 10.06f, 32.04f},
+    {6047.3f, 13477.1f, 11.80f, 26.93f},
+    {6948.4f, 13829.0f, 13.04f, 21.47f},
+    {7856.6f, 14116.1f, 13.76f, 15.78f},
+    {8774.1f, 14335.0f, 13.95f, 9.97f},
+    {9702.3f, 14479.1f, 13.60f, 4.13f},
+    {10641.0f, 14539.9f, 12.72f, -1.64f},
+    {11587.5f, 14506.6f, 11.30f, -7.24f},
+    {12536.0f, 14368.4f, 9.35f, -12.59f},
+    {13477.3f, 14114.8f, 6.86f, -17.60f},
+    {14399.1f, 13737.9f, 3.86f, -22.14f},
+    {15286.3f, 13233.5f, 0.37f, -26.12f},
+    {16122.1f, 12602.0f, -3.55f, -29.40f},
+    {16889.6f, 11849.5f, -7.80f, -31.87f},
+    {17572.6f, 10987.5f, -12.27f, -33.44f},
+    {18157.8f, 10032.6f, -16.80f, -34.02f},
+    {18636.0f, 9005.3f, -21.20f, -33.59f},
+    {19002.6f, 7928.4f, -25.26f, -32.18f},
+    {19258.7f, 6824.9f, -28.76f, -29.87f},
+    {19410.5f, 5715.9f, -31.51f, -26.84f},
+    {19468.7f, 4619.3f, -33.35f, -23.31f},
+    {19447.4f, 3547.5f, -34.18f, -19.57f},
+    {19362.4f, 2507.6f, -33.95f, -15.93f},
+    {19229.4f, 1500.4f, -32.71f, -12.70f},
+    {19062.8f, 521.3f, -30.60f, -10.20f},
+    {18873.8f, -438.5f, -27.81f, -8.64f},
+    {18669.9f, -1390.8f, -24.61f, -8.21f},
+    {18453.9f, -2348.6f, -21.28f, -8.98f},
+    {18224.2f, -3324.4f, -18.14f, -10.92f},
+    {17975.0f, -4328.8f, -15.47f, -13.92f},
+    {17696.8f, -5368.9f, -13.53f, -17.77f},
+    {17377.3f, -6447.4f, -12.53f, -22.20f},
+    {17002.9f, -7562.2f, -12.60f, -26.91f},
+    {16559.2f, -8705.9f, -13.80f, -31.55f},
+    {16033.0f, -9865.7f, -16.10f, -35.81f},
+    {15412.8f, -11024.5f, -19.41f, -39.36f},
+    {14690.0f, -12161.0f, -23.56f, -41.97f},
+    {13859.8f, -13251.0f, -28.32f, -43.43f},
+    {12921.8f, -14268.6f, -33.45f, -43.63f},
+    {11879.8f, -15187.3f, -38.66f, -42.52f},
+    {10742.5f, -15981.2f, -43.69f, -40.16f},
+    {9522.5f, -16626.5f, -48.30f, -36.66f},
+    {8236.3f, -17101.8f, -52.28f, -32.18f},
+    {6903.4f, -17390.0f, -55.50f, -26.93f},
+    {5545.7f, -17477.8f, -57.87f, -21.15f},
+    {4186.4f, -17357.0f, -59.37f, -15.05f},
+    {2849.6f, -17024.4f, -60.01f, -8.83f},
+    {1559.2f, -16481.7f, -59.87f, -2.69f},
+    {338.1f, -15735.8f, -59.04f, 3.26f},
+    {-792.0f, -14798.7f, -57.61f, 8.89f},
+    {-1811.9f, -13686.6f, -55.71f, 14.16f},
+    {-2705.2f, -12419.8f, -53.42f, 19.01f},
+    {-3458.9f, -11022.1f, -50.86f, 23.43f},
+    {-4063.9f, -9519.2f, -48.11f, 27.43f},
+    {-4514.7f, -7938.6f, -45.23f, 31.03f},
+    {-4810.0f, -6307.8f, -42.30f, 34.27f},
+    {-4952.1f, -4653.8f, -39.35f, 37.18f},
+    {-4946.8f, -3001.6f, -36.40f, 39.82f},
+    {-4802.2f, -1374.2f, -33.46f, 42.21f},
+    {-4529.1f, 208.5f, -30.50f, 44.39f},
+    {-4139.4f, 1729.7f, -27.51f, 46.34f},
+    {-3646.2f, 3175.8f, -24.44f, 48.04f},
+    {-3063.2f, 4536.6f, -21.29f, 49.43f},
+    {-2403.9f, 5805.1f, -18.02f, 50.44f},
+    {-1681.3f, 6977.0f, -14.65f, 50.98f},
+    {-908.0f, 8050.8f, -11.20f, 50.98f},
+    {-95.3f, 9027.1f, -7.71f, 50.35f},
+    {-3632.5f, 9729.2f, 0.45f, 49.95f},
+    {-2728.6f, 10659.7f, 4.56f, 47.89f},
+    {-1785.2f, 11502.1f, 8.44f, 45.19f},
+    {-808.6f, 12258.0f, 12.02f, 41.87f},
+    {196.1f, 12928.7f, 15.22f, 37.99f},
+    {1224.9f, 13515.4f, 17.98f, 33.61f},
+    {2274.9f, 14018.6f, 20.24f, 28.81f},
+    {3343.6f, 14437.7f, 21.96f, 23.69f},
+    {4428.8f, 14771.1f, 23.11f, 18.33f},
+    {5528.1f, 15015.8f, 23.67f, 12.86f},
+    {6638.4f, 15167.6f, 23.64f, 7.36f},
+    {7755.2f, 15221.8f, 23.02f, 1.93f},
+    {8872.8f, 15173.2f, 21.82f, -3.33f},
+    {9983.5f, 15016.8f, 20.08f, -8.32f},
+    {11078.2f, 14748.8f, 17.82f, -12.95f},
+    {12146.0f, 14366.9f, 15.10f, -17.14f},
+    {13174.9f, 13871.2f, 11.98f, -20.80f},
+    {14152.4f, 13264.7f, 8.53f, -23.87f},
+    {15066.4f, 12553.0f, 4.86f, -26.28f},
+    {15905.8f, 11744.9f, 1.07f, -28.00f},
+    {16661.1f, 10851.8f, -2.71f, -29.02f},
+    {17325.6f, 9886.6f, -6.34f, -29.34f},
+    {17895.2f, 8863.7f, -9.71f, -29.02f},
+    {18369.0f, 7797.2f, -12.67f, -28.15f},
+    {18749.0f, 6700.6f, -15.12f, -26.85f},
+    {19039.6f, 5585.4f, -16.98f, -25.26f},
+    {19247.3f, 4460.7f, -18.22f, -23.56f},
+    {19379.2f, 3332.9f, -18.82f, -21.93f},
+    {19442.8f, 2205.2f, -18.84f, -20.55f},
+    {19444.9f, 1078.4f, -18.37f, -19.58f},
+    {19390.6f, -49.1f, -17.53f, -19.13f},
+    {19282.9f, -1180.2f, -16.50f, -19.29f},
+    {19122.5f, -2318.6f, -15.44f, -20.10f},
+    {18907.7f, -3467.5f, -14.55f, -21.53f},
+    {18634.3f, -4628.8f, -13.99f, -23.50f},
+    {18296.2f, -5802.7f, -13.92f, -25.90f},
+    {17886.1f, -6986.6f, -14.45f, -28.56f},
+    {17395.6f, -8175.2f, -15.66f, -31.29f},
+    {16816.9f, -9359.8f, -17.56f, -33.91f},
+    {16142.6f, -10528.8f, -20.15f, -36.22f},
+    {15367.1f, -11667.9f, -23.36f, -38.04f},
+    {14486.9f, -12760.1f, -27.08f, -39.21f},
+    {13501.3f, -13787.0f, -31.17f, -39.62f},
+    {12412.4f, -14729.1f, -35.48f, -39.19f},
+    {11226.1f, -15566.4f, -39.83f, -37.89f},
+    {9951.0f, -16279.8f, -44.07f, -35.74f},
+    {8599.5f, -16851.2f, -48.02f, -32.78f},
+    {7186.4f, -17264.7f, -51.57f, -29.10f},
+    {5729.3f, -17507.0f, -54.60f, -24.81f},
+    {4247.7f, -17568.1f, -57.02f, -20.04f},
+    {2762.5f, -17441.3f, -58.81f, -14.92f},
+    {1295.7f, -17124.1f, -59.93f, -9.58f},
+    {-130.9f, -16617.7f, -60.41f, -4.14f},
+    {-1495.7f, -15927.6f, -60.26f, 1.29f},
+    {-2778.5f, -15062.8f, -59.54f, 6.62f},
+    {-3960.4f, -14036.2f, -58.31f, 11.78f},
+    {-5025.2f, -12863.7f, -56.61f, 16.71f},
+    {-5958.9f, -11563.9f, -54.52f, 21.38f},
+    {-6750.9f, -10157.4f, -52.09f, 25.75f},
+    {-7393.6f, -8666.3f, -49.38f, 29.83f},
+    {-7882.8f, -7113.1f, -46.43f, 33.60f},
+    {-8217.5f, -5520.4f, -43.28f, 37.06f},
+    {-8399.7f, -3909.8f, -39.94f, 40.22f},
+    {-8433.9f, -2301.8f, -36.44f, 43.07f},
+    {-8327.2f, -715.0f, -32.79f, 45.60f},
+    {-8088.3f, 834.0f, -28.98f, 47.78f},
+    {-7727.5f, 2331.1f, -25.03f, 49.59f},
+    {-7255.7f, 3764.6f, -20.95f, 50.98f},
+    {-6684.5f, 5125.1f, -16.74f, 51.90f},
+    {-6025.6f, 6405.7f, -12.46f, 52.30f},
+    {-5290.3f, 7601.6f, -8.12f, 52.14f},
+    {-4489.3f, 8709.8f, -3.80f, 51.36f},
+    {-7814.1f, 9436.0f, 4.08f, 49.18f},
+    {-6907.1f, 10494.5f, 8.49f, 47.25f},
+    {-5933.4f, 11464.4f, 12.65f, 44.78f},
+    {-4900.6f, 12342.9f, 16.52f, 41.80f},
+    {-3815.9f, 13127.6f, 20.02f, 38.35f},
+    {-2685.9f, 13816.3f, 23.11f, 34.49f},
+    {-1517.3f, 14406.8f, 25.73f, 30.28f},
+    {-316.3f, 14897.1f, 27.85f, 25.78f},
+    {910.6f, 15285.1f, 29.44f, 21.08f},
+    {2156.9f, 15568.5f, 30.49f, 16.25f},
+    {3415.7f, 15745.4f, 30.99f, 11.39f},
+    {4679.5f, 15813.7f, 30.94f, 6.56f},
+    {5940.6f, 15772.1f, 30.38f, 1.85f},
+    {7190.2f, 15619.5f, 29.32f, -2.67f},
+    {8419.5f, 15356.1f, 27.81f, -6.92f},
+    {9619.0f, 14982.8f, 25.90f, -10.85f},
+    {10779.1f, 14502.1f, 23.65f, -14.40f},
+    {11890.5f, 13917.4f, 21.13f, -17.53f},
+    {12944.1f, 13234.1f, 18.41f, -20.23f},
+    {13931.7f, 12458.2f, 15.57f, -22.46f},
+    {14846.0f, 11597.4f, 12.70f, -24.24f},
+    {15680.9f, 10659.9f, 9.86f, -25.60f},
+    {16431.8f, 9654.5f, 7.14f, -26.56f},
+    {17095.4f, 8590.1f, 4.59f, -27.19f},
+    {17669.7f, 7475.7f, 2.27f, -27.54f},
+    {18154.0f, 6319.3f, 0.21f, -27.71f},
+    {18548.3f, 5128.5f, -1.58f, -27.76f},
+    {18853.4f, 3910.1f, -3.11f, -27.79f},
+    {19070.2f, 2669.5f, -4.40f, -27.87f},
+    {19199.6f, 1411.8f, -5.51f, -28.06f},
+    {19242.0f, 141.1f, -6.49f, -28.42f},
+    {19197.6f, -1138.7f, -7.43f, -28.98f},
+    {19065.3f, -2424.1f, -8.41f, -29.74f},
+    {18843.9f, -3710.8f, -9.50f, -30.69f},
+    {18531.1f, -4994.3f, -10.79f, -31.79f},
+    {18124.2f, -6268.9f, -12.34f, -32.97f},
+    {17620.6f, -7528.0f, -14.20f, -34.17f},
+    {17017.4f, -8763.3f, -16.39f, -35.29f},
+    {16312.5f, -9965.3f, -18.93f, -36.24f},
+    {15504.6f, -11123.3f, -21.79f, -36.93f},
+    {14593.5f, -12225.1f, -24.95f, -37.26f},
+    {13580.7f, -13257.7f, -28.34f, -37.17f},
+    {12469.6f, -14207.3f, -31.89f, -36.59f},
+    {11265.4f, -15060.2f, -35.51f, -35.48f},
+    {9975.7f, -15802.4f, -39.12f, -33.82f},
+    {8609.9f, -16420.9f, -42.61f, -31.60f},
+    {7180.0f, -16903.6f, -45.91f, -28.86f},
+    {5699.4f, -17239.9f, -48.93f, -25.61f},
+    {4183.5f, -17421.0f, -51.58f, -21.92f},
+    {2649.0f, -17440.6f, -53.83f, -17.84f},
+    {1113.7f, -17294.5f, -55.61f, -13.46f},
+    {-404.2f, -16981.5f, -56.90f, -8.83f},
+    {-1886.2f, -16503.0f, -57.68f, -4.04f},
+    {-3314.2f, -15863.3f, -57.94f, 0.84f},
+    {-4670.7f, -15069.2f, -57.70f, 5.75f},
+    {-5939.4f, -14130.3f, -56.96f, 10.61f},
+    {-7105.5f, -13058.2f, -55.75f, 15.38f},
+    {-8156.2f, -11866.8f, -54.09f, 20.01f},
+    {-9080.5f, -10571.3f, -52.02f, 24.44f},
+    {-9869.9f, -9188.4f, -49.55f, 28.65f},
+    {-10518.3f, -7735.3f, -46.73f, 32.61f},
+    {-11021.8f, -6229.7f, -43.58f, 36.27f},
+    {-11378.8f, -4689.1f, -40.12f, 39.61f},
+    {-11590.2f, -3130.6f, -36.39f, 42.60f},
+    {-11658.5f, -1570.5f, -32.41f, 45.22f},
+    {-11588.1f, -23.9f, -28.21f, 47.44f},
+    {-11384.9f, 1495.1f, -23.82f, 49.21f},
+    {-11055.9f, 2974.1f, -19.28f, 50.52f},
+    {-10608.9f, 4402.1f, -14.63f, 51.33f},
+    {-10052.5f, 5769.6f, -9.91f, 51.62f},
+    {-9395.4f, 7068.7f, -5.18f, 51.37f},
+    {-8646.3f, 8292.6f, -0.50f, 50.56f},
+    {-11491.7f, 9044.6f, 7.00f, 46.87f},
+    {-10620.3f, 10204.5f, 11.24f, 45.28f},
+    {-9659.3f, 11279.6f, 15.29f, 43.25f},
+    {-8616.9f, 12263.6f, 19.09f, 40.83f},
+    {-7501.4f, 13150.9f, 22.60f, 38.03f},
+    {-6321.5f, 13936.4f, 25.78f, 34.90f},
+    {-5085.9f, 14615.8f, 28.61f, 31.49f},
+    {-3803.5f, 15185.6f, 31.04f, 27.83f},
+    {-2483.6f, 15642.8f, 33.08f, 23.97f},
+    {-1135.4f, 15985.1f, 34.69f, 19.98f},
+    {231.8f, 16210.9f, 35.89f, 15.89f},
+    {1608.6f, 16319.3f, 36.66f, 11.77f},
+    {2985.4f, 16310.1f, 37.01f, 7.66f},
+    {4352.8f, 16183.9f, 36.97f, 3.60f},
+    {5701.4f, 15942.1f, 36.56f, -0.35f},
+    {7021.9f, 15586.6f, 35.79f, -4.15f},
+    {8305.3f, 15120.5f, 34.71f, -7.79f},
+    {9542.7f, 14547.5f, 33.34f, -11.22f},
+    {10725.9f, 13871.8f, 31.73f, -14.43f},
+    {11846.8f, 13098.6f, 29.91f, -17.40f},
+    {12898.0f, 12233.6f, 27.91f, -20.13f},
+    {13872.7f, 11283.2f, 25.78f, -22.62f},
+    {14764.8f, 10253.9f, 23.55f, -24.88f},
+    {15568.5f, 9153.1f, 21.24f, -26.91f},
+    {16279.0f, 7988.1f, 18.88f, -28.74f},
+    {16891.9f, 6766.6f, 16.48f, -30.37f},
+    {17403.6f, 5496.5f, 14.06f, -31.82f},
+    {17810.7f, 4185.7f, 11.62f, -33.13f},
+    {18110.7f, 2842.4f, 9.16f, -34.29f},
+    {18301.3f, 1474.7f, 6.68f, -35.33f},
+    {18380.9f, 90.9f, 4.16f, -36.26f},
+    {18347.9f, -1300.6f, 1.60f, -37.07f},
+    {18201.6f, -2691.1f, -1.02f, -37.76f},
+    {17941.3f, -4071.9f, -3.72f, -38.33f},
+    {17567.3f, -5434.0f, -6.49f, -38.75f},
+    {17079.9f, -6768.0f, -9.36f, -39.02f},
+    {16480.4f, -8064.4f, -12.31f, -39.11f},
+    {15770.7f, -9313.5f, -15.35f, -38.99f},
+    {14953.5f, -10505.3f, -18.46f, -38.63f},
+    {14032.5f, -11629.8f, -21.63f, -38.01f},
+    {13012.2f, -12676.8f, -24.84f, -37.10f},
+    {11898.5f, -13636.3f, -28.05f, -35.88f},
+    {10698.1f, -14498.7f, -31.23f, -34.34f},
+    {9419.0f, -15254.6f, -34.34f, -32.46f},
+    {8070.4f, -15895.4f, -37.33f, -30.24f},
+    {6662.6f, -16413.1f, -40.17f, -27.68f},
+    {5206.9f, -16800.9f, -42.81f, -24.79f},
+    {3715.5f, -17053.1f, -45.20f, -21.60f},
+    {2201.6f, -17165.1f, -47.30f, -18.12f},
+    {678.8f, -17134.1f, -49.09f, -14.38f},
+    {-838.9f, -16958.7f, -50.52f, -10.43f},
+    {-2336.9f, -16639.0f, -51.57f, -6.30f},
+    {-3801.0f, -16177.1f, -52.22f, -2.03f},
+    {-5217.0f, -15576.5f, -52.45f, 2.33f},
+    {-6571.4f, -14842.5f, -52.25f, 6.73f},
+    {-7851.1f, -13982.0f, -51.62f, 11.13f},
+    {-9043.9f, -13003.2f, -50.57f, 15.47f},
+    {-10139.0f, -11915.6f, -49.09f, 19.72f},
+    {-11126.4f, -10730.2f, -47.20f, 23.82f},
+    {-11997.6f, -9458.6f, -44.91f, 27.74f},
+    {-12745.6f, -8113.3f, -42.25f, 31.43f},
+    {-13364.9f, -6707.4f, -39.24f, 34.86f},
+    {-13851.3f, -5254.1f, -35.90f, 37.98f},
+    {-14202.3f, -3767.2f, -32.27f, 40.76f},
+    {-14416.8f, -2259.9f, -28.38f, 43.18f},
+    {-14495.0f, -745.6f, -24.27f, 45.20f},
+    {-14438.5f, 762.8f, -19.98f, 46.81f},
+    {-14250.0f, 2253.0f, -15.56f, 47.97f},
+    {-13933.3f, 3713.2f, -11.04f, 48.69f},
+    {-13493.2f, 5132.4f, -6.47f, 48.93f},
+    {-12935.3f, 6500.3f, -1.91f, 48.71f},
+    {-12265.9f, 7807.2f, 2.59f, 48.02f},
+    {-14425.6f, 8578.4f, 9.71f, 43.40f},
+    {-13623.0f, 9803.0f, 13.46f, 42.39f},
+    {-12716.8f, 10953.0f, 17.10f, 41.05f},
+    {-11713.8f, 12019.7f, 20.61f, 39.41f},
+    {-10621.6f, 12994.9f, 23.97f, 37.46f},
+    {-9448.6f, 13871.2f, 27.14f, 35.23f},
+    {-8203.7f, 14641.9f, 30.11f, 32.73f},
+    {-6896.4f, 15301.2f, 32.85f, 29.98f},
+    {-5536.6f, 15844.0f, 35.34f, 27.00f},
+    {-4134.6f, 16266.3f, 37.56f, 23.82f},
+    {-2701.2f, 16564.7f, 39.49f, 20.46f},
+    {-1247.2f, 16737.1f, 41.12f, 16.94f},
+    {216.3f, 16782.1f, 42.44f, 13.29f},
+    {1678.1f, 16699.4f, 43.44f, 9.54f},
+    {3127.2f, 16489.6f, 44.10f, 5.72f},
+    {4552.5f, 16154.3f, 44.43f, 1.85f},
+    {5943.1f, 15696.0f, 44.43f, -2.03f},
+    {7288.5f, 15118.3f, 44.08f, -5.89f},
+    {8578.4f, 14425.6f, 43.40f, -9.71f},
+    {9803.0f, 13623.0f, 42.39f, -13.46f},
+    {10953.0f, 12716.8f, 41.05f, -17.10f},
+    {12019.7f, 11713.8f, 39.41f, -20.61f},
+    {12994.9f, 10621.6f, 37.46f, -23.97f},
+    {13871.2f, 9448.6f, 35.23f, -27.14f},
+    {14641.9f, 8203.7f, 32.73f, -30.11f},
+    {15301.2f, 6896.4f, 29.98f, -32.85f},
+    {15844.0f, 5536.6f, 27.00f, -35.34f},
+    {16266.3f, 4134.6f, 23.82f, -37.56f},
+    {16564.7f, 2701.2f, 20.46f, -39.49f},
+    {16737.1f, 1247.2f, 16.94f, -41.12f},
+    {16782.1f, -216.3f, 13.29f, -42.44f},
+    {16699.4f, -1678.1f, 9.54f, -43.44f},
+    {16489.6f, -3127.2f, 5.72f, -44.10f},
+    {16154.3f, -4552.5f, 1.85f, -44.43f},
+    {15696.0f, -5943.1f, -2.03f, -44.43f},
+    {15118.3f, -7288.5f, -5.89f, -44.08f},
+    {14425.6f, -8578.4f, -9.71f, -43.40f},
+    {13623.0f, -9803.0f, -13.46f, -42.39f},
+    {12716.8f, -10953.0f, -17.10f, -41.05f},
+    {11713.8f, -12019.7f, -20.61f, -39.41f},
+    {10621.6f, -12994.9f, -23.97f, -37.46f},
+    {9448.6f, -13871.2f, -27.14f, -35.23f},
+    {8203.7f, -14641.9f, -30.11f, -32.73f},
+    {6896.4f, -15301.2f, -32.85f, -29.98f},
+    {5536.6f, -15844.0f, -35.34f, -27.00f},
+    {4134.6f, -16266.3f, -37.56f, -23.82f},
+    {2701.2f, -16564.7f, -39.49f, -20.46f},
+    {1247.2f, -16737.1f, -41.12f, -16.94f},
+    {-216.3f, -16782.1f, -42.44f, -13.29f},
+    {-1678.1f, -16699.4f, -43.44f, -9.54f},
+    {-3127.2f, -16489.6f, -44.10f, -5.72f},
+    {-4552.5f, -16154.3f, -44.43f, -1.85f},
+    {-5943.1f, -15696.0f, -44.43f, 2.03f},
+    {-7288.5f, -15118.3f, -44.08f, 5.89f},
+    {-8578.4f, -14425.6f, -43.40f, 9.71f},
+    {-9803.0f, -13623.0f, -42.39f, 13.46f},
+    {-10953.0f, -12716.8f, -41.05f, 17.10f},
+    {-12019.7f, -11713.8f, -39.41f, 20.61f},
+    {-12994.9f, -10621.6f, -37.46f, 23.97f},
+    {-13871.2f, -9448.6f, -35.23f, 27.14f},
+    {-14641.9f, -8203.7f, -32.73f, 30.11f},
+    {-15301.2f, -6896.4f, -29.98f, 32.85f},
+    {-15844.0f, -5536.6f, -27.00f, 35.34f},
+    {-16266.3f, -4134.6f, -23.82f, 37.56f},
+    {-16564.7f, -2701.2f, -20.46f, 39.49f},
+    {-16737.1f, -1247.2f, -16.94f, 41.12f},
+    {-16782.1f, 216.3f, -13.29f, 42.44f},
+    {-16699.4f, 1678.1f, -9.54f, 43.44f},
+    {-16489.6f, 3127.2f, -5.72f, 44.10f},
+    {-16154.3f, 4552.5f, -1.85f, 44.43f},
+    {-15696.0f, 5943.1f, 2.03f, 44.43f},
+    {-15118.3f, 7288.5f, 5.89f, 44.08f},
+};
+
+} // namespace data
+} // namespace pixhawk
@@ -1,11 +1,122 @@
-// Stub AStar implementation
+#include "AStar.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+
 namespace pixhawk {
 
-class AStar {
-public:
-    AStar() = default;
-    ~AStar() = default;
-    bool findPath() { return true; }
-};
+namespace {
+
+bool inside(const CostGrid& grid, int x, int y) {
+    return x >= 0 && y >= 0 && x < grid.width && y < grid.height;
+}
+
+} // namespace
+
+void AStar::reserve(int width, int height) {
+    reserveCells(static_cast<size_t>(std::max(width, 0)) * static_cast<size_t>(std::max(height, 0)));
+}
+
+void AStar::reserveCells(size_t cells) {
+    if (nodes.size() >= cells) return;
+    nodes.resize(cells, Node{0.0f, 0, 0});
+    open.resize(cells);
+}
+
+void AStar::nextGeneration(size_t cells) {
+    reserveCells(cells);
+    if (generation > UINT32_MAX - 2) {
+        // About to wrap: old stamps could look current
+        for (Node& node : nodes) node.stamp = 0;
+        generation = 0;
+    }
+    generation += 2;
+    open.clear();
+}
+
+bool AStar::findPath(const CostGrid& grid, GridCell start, GridCell goal, std::vector<GridCell>& path) {
+    path.clear();
+    pathCost = 0.0;
+    expanded = 0;
+    if (!grid.costs || !inside(grid, start.x, start.y) || !inside(grid, goal.x, goal.y)) return false;
+
+    const int width = grid.width;
+    const float* costs = grid.costs;
+    const uint32_t startIndex = static_cast<uint32_t>(start.y * width + start.x);
+    const uint32_t goalIndex = static_cast<uint32_t>(goal.y * width + goal.x);
+    if (!isPassable(costs[startIndex]) || !isPassable(costs[goalIndex])) return false;
+
+    nextGeneration(static_cast<size_t>(width) * static_cast<size_t>(grid.height));
+    const bool diagonals = connectivity == Connectivity::EIGHT;
+    const int stepCount = diagonals ? 8 : 4;
+    const float minCost = grid.minCost;
+
+    // Manhattan distance without diagonal steps
+    auto heuristic = [&](int x, int y) {
+        if (diagonals) return octileDistance({x, y}, goal, minCost);
+        return minCost * static_cast<float>(std::abs(x - goal.x) + std::abs(y - goal.y));
+    };
+
+    nodes[startIndex] = {0.0f, startIndex, generation};
+    const float startH = heuristic(start.x, start.y);
+    open.push(startIndex, {startH, startH});
+
+    bool found = false;
+    while (!open.empty()) {
+        const uint32_t current = open.pop();
+        if (current == goalIndex) {
+            found = true;
+            break;
+        }
+        nodes[current].stamp = generation + 1;
+        expanded++;
+
+        const int cx = static_cast<int>(current % static_cast<uint32_t>(width));
+        const int cy = static_cast<int>(current / static_cast<uint32_t>(width));
+        const float g = nodes[current].g;
+        bool orthogonalOpen[4] = {};
+
+        for (int s = 0; s < stepCount; s++) {
+            const GridStep& step = GRID_STEPS[s];
+            const int nx = cx + step.dx;
+            const int ny = cy + step.dy;
+            if (!inside(grid, nx, ny)) continue;
+            const uint32_t next = static_cast<uint32_t>(ny * width + nx);
+            const float cost = costs[next];
+            if (s < 4) {
+                orthogonalOpen[s] = isPassable(cost);
+                if (!orthogonalOpen[s]) continue;
+            } else {
+                // Diagonal s passes between orthogonal steps s - 4 and s - 3
+                if (!isPassable(cost) || !orthogonalOpen[s - 4] || !orthogonalOpen[(s - 3) & 3]) continue;
+            }
+
+            // The heuristic is consistent, so closed cells are final
+            Node& node = nodes[next];
+            if (node.stamp == generation + 1) continue;
+            const float tentative = g + step.length * cost;
+            const bool isOpen = node.stamp == generation;
+            if (isOpen && !(tentative < node.g)) continue;
+            node = {tentative, current, generation};
+            const float h = heuristic(nx, ny);
+            if (isOpen) {
+                open.set(next, {tentative + h, h});
+            } else {
+                open.push(next, {tentative + h, h});
+            }
+        }
+    }
+    if (!found) return false;
+
+    pathCost = nodes[goalIndex].g;
+    for (uint32_t cell = goalIndex;; cell = nodes[cell].parent) {
+        path.push_back({static_cast<int>(cell % static_cast<uint32_t>(width)),
+                        static_cast<int>(cell / static_cast<uint32_t>(width))});
+        if (cell == startIndex) break;
+    }
+    std::reverse(path.begin(), path.end());
+    return true;
+}
 
-} // namespace pixhawk
\ No newline at end of file
+} // namespace pixhawk
@@ -0,0 +1,111 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "IndexedHeap.hpp"
+
+namespace pixhawk {
+
+struct GridCell {
+    int x;
+    int y;
+};
+
+// Row-major raster of traversal costs. A step into a cell costs its value
+// times the step length (1, or sqrt(2) on a diagonal); infinite or NaN
+// cells are blocked. 'minCost' is a lower bound on passable values and
+// scales the heuristic, so it must not be larger than any of them.
+struct CostGrid {
+    const float* costs = nullptr;
+    int width = 0;
+    int height = 0;
+    float minCost = 1.0f;
+};
+
+// Neighbor steps of the grid planners: the four orthogonal ones first, so
+// diagonal i + 4 lies between orthogonal steps i and (i + 1) % 4
+struct GridStep {
+    int dx;
+    int dy;
+    float length;
+};
+
+constexpr float GRID_DIAGONAL = 1.41421356f;
+constexpr GridStep GRID_STEPS[8] = {
+    {1, 0, 1.0f}, {0, 1, 1.0f}, {-1, 0, 1.0f}, {0, -1, 1.0f},
+    {1, 1, GRID_DIAGONAL}, {-1, 1, GRID_DIAGONAL}, {-1, -1, GRID_DIAGONAL}, {1, -1, GRID_DIAGONAL},
+};
+
+inline bool isPassable(float cost) {
+    return cost < INFINITY;     // false for NaN as well
+}
+
+// Octile distance in cells, scaled by the cheapest cell cost
+inline float octileDistance(GridCell a, GridCell b, float minCost) {
+    const int dx = a.x > b.x ? a.x - b.x : b.x - a.x;
+    const int dy = a.y > b.y ? a.y - b.y : b.y - a.y;
+    const int lo = dx < dy ? dx : dy;
+    const int hi = dx < dy ? dy : dx;
+    return minCost * (static_cast<float>(hi - lo) + GRID_DIAGONAL * static_cast<float>(lo));
+}
+
+// Grid A* with an octile heuristic. Search state lives in flat per-cell
+// arrays stamped with a query generation, so nothing is cleared between
+// queries and a planner reused on the same size of grid does not allocate.
+class AStar {
+public:
+    enum class Connectivity {
+        FOUR,
+        EIGHT       // diagonal steps may not cut the corner of a blocked cell
+    };
+
+    AStar() = default;
+    ~AStar() = default;
+
+    void setConnectivity(Connectivity value) { connectivity = value; }
+    Connectivity getConnectivity() const { return connectivity; }
+
+    // Sizes the search state up front; findPath grows it on demand otherwise
+    void reserve(int width, int height);
+
+    // Cells from start to goal inclusive. Returns false, with 'path' empty,
+    // if either end is blocked or outside the grid or the goal is unreachable.
+    bool findPath(const CostGrid& grid, GridCell start, GridCell goal, std::vector<GridCell>& path);
+
+    // Statistics of the last query
+    double getPathCost() const { return pathCost; }
+    size_t getExpandedCount() const { return expanded; }
+
+private:
+    struct Key {
+        float f;
+        float h;        // ties go to the cell nearer the goal
+
+        bool operator<(const Key& other) const {
+            return f < other.f || (f == other.f && h < other.h);
+        }
+    };
+
+    Connectivity connectivity = Connectivity::EIGHT;
+    IndexedHeap<Key> open;
+    // Per-cell search state, indexed like the grid. 'stamp' is 'generation'
+    // while a cell is open and one more once closed; anything lower is left
+    // over from earlier queries.
+    struct Node {
+        float g;
+        uint32_t parent;
+        uint32_t stamp;
+    };
+
+    std::vector<Node> nodes;
+    uint32_t generation = 0;
+
+    double pathCost = 0.0;
+    size_t expanded = 0;
+
+    void reserveCells(size_t cells);
+    void nextGeneration(size_t cells);
+};
+
+} // namespace pixhawk
@@ -1,11 +1,332 @@
-// Stub CostMap implementation  
+#include "CostMap.hpp"
+#include <algorithm>
+#include "ElevationLookup.hpp"
+
+#ifdef PIXHAWKCORE_VERBOSE
+#include <android/log.h>
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, "CostMap", __VA_ARGS__)
+#else
+#define LOGI(...)
+#endif
+
 namespace pixhawk {
 
-class CostMap {
-public:
-    CostMap() = default;
-    ~CostMap() = default;
-    double getCost(int x, int y) { return 1.0; }
-};
+namespace {
+
+constexpr int SAMPLE_SIZE = CostMap::TILE_SIZE + 2;    // cell centers plus a one-cell halo for slope
+
+int floorDiv(int value, int divisor) {
+    return value >= 0 ? value / divisor : -((-value - 1) / divisor) - 1;
+}
+
+// Columns whose cells overlap [from, to] meters east, clipped to the tile
+void blockSpan(double from, double to, double cellSize, int x0, float* row) {
+    const double first = std::max(std::floor(from / cellSize) - x0, 0.0);
+    const double last = std::min(std::floor(to / cellSize) - x0, CostMap::TILE_SIZE - 1.0);
+    for (int c = static_cast<int>(first); c <= static_cast<int>(last); c++) {
+        row[c] = INFINITY;
+    }
+}
+
+} // namespace
+
+CostMap::CostMap(double cellMeters) : cellMeters(cellMeters) {}
+
+CostMap::~CostMap() = default;
+
+void CostMap::setElevationSource(const ElevationLookup* source) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    elevation = source;
+    clearTiles();
+}
+
+void CostMap::setParameters(const Parameters& values) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    parameters = values;
+    clearTiles();
+}
+
+void CostMap::setCacheCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    cacheCapacity = std::max<size_t>(capacity, 1);
+    while (tiles.size() > cacheCapacity) {
+        tileIndex.erase(tiles.back().key);
+        tiles.pop_back();
+    }
+}
+
+void CostMap::setOrigin(double lat, double lon) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    frame.setOrigin(lat, lon, 0.0);
+    // Zones are kept in plane coordinates, so they move with the origin
+    for (Zone& zone : zones) {
+        for (size_t i = 0; i < zone.east.size(); i++) {
+            double up;
+            frame.toLocal(zone.lat[i], zone.lon[i], 0.0, zone.east[i], zone.north[i], up);
+        }
+        const auto [minEast, maxEast] = std::minmax_element(zone.east.begin(), zone.east.end());
+        const auto [minNorth, maxNorth] = std::minmax_element(zone.north.begin(), zone.north.end());
+        zone.minEast = *minEast;
+        zone.maxEast = *maxEast;
+        zone.minNorth = *minNorth;
+        zone.maxNorth = *maxNorth;
+    }
+    clearTiles();
+    LOGI("Origin moved to %.6f, %.6f", lat, lon);
+}
+
+LocalFrame CostMap::getFrame() const {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    return frame;
+}
+
+GridCell CostMap::toCell(int level, double east, double north) const {
+    const double size = getCellSize(level);
+    return {static_cast<int>(std::floor(east / size)), static_cast<int>(std::floor(north / size))};
+}
+
+void CostMap::cellCenter(int level, GridCell cell, double& east, double& north) const {
+    const double size = getCellSize(level);
+    east = (cell.x + 0.5) * size;
+    north = (cell.y + 0.5) * size;
+}
+
+int CostMap::addNoFlyZone(const std::vector<double>& lat, const std::vector<double>& lon) {
+    if (lat.size() < 3 || lat.size() != lon.size()) return 0;
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    Zone zone;
+    zone.id = nextZoneId++;
+    zone.lat = lat;
+    zone.lon = lon;
+    zone.east.resize(lat.size());
+    zone.north.resize(lat.size());
+    for (size_t i = 0; i < lat.size(); i++) {
+        double up;
+        frame.toLocal(lat[i], lon[i], 0.0, zone.east[i], zone.north[i], up);
+    }
+    const auto [minEast, maxEast] = std::minmax_element(zone.east.begin(), zone.east.end());
+    const auto [minNorth, maxNorth] = std::minmax_element(zone.north.begin(), zone.north.end());
+    zone.minEast = *minEast;
+    zone.maxEast = *maxEast;
+    zone.minNorth = *minNorth;
+    zone.maxNorth = *maxNorth;
+
+    dropTiles(zone);
+    zones.push_back(std::move(zone));
+    LOGI("Added no-fly zone %d with %zu vertices", zones.back().id, lat.size());
+    return zones.back().id;
+}
+
+bool CostMap::removeNoFlyZone(int id) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = std::find_if(zones.begin(), zones.end(), [id](const Zone& zone) { return zone.id == id; });
+    if (it == zones.end()) return false;
+    dropTiles(*it);
+    zones.erase(it);
+    return true;
+}
+
+bool CostMap::getZoneBounds(int id, double& west, double& south, double& east, double& north) const {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = std::find_if(zones.begin(), zones.end(), [id](const Zone& zone) { return zone.id == id; });
+    if (it == zones.end()) return false;
+    west = it->minEast;
+    south = it->minNorth;
+    east = it->maxEast;
+    north = it->maxNorth;
+    return true;
+}
+
+float CostMap::getCost(int level, int x, int y) const {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    const Tile& tile = acquireTile(level, floorDiv(x, TILE_SIZE), floorDiv(y, TILE_SIZE));
+    const int col = x - tile.tx * TILE_SIZE;
+    const int row = y - tile.ty * TILE_SIZE;
+    return tile.costs[static_cast<size_t>(row * TILE_SIZE + col)];
+}
+
+void CostMap::rasterize(int level, int x0, int y0, int width, int height, float* out) const {
+    if (width <= 0 || height <= 0) return;
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    const int x1 = x0 + width;
+    const int y1 = y0 + height;
+    // One tile at a time, copying the part of each of its rows in the window
+    for (int ty = floorDiv(y0, TILE_SIZE); ty * TILE_SIZE < y1; ty++) {
+        for (int tx = floorDiv(x0, TILE_SIZE); tx * TILE_SIZE < x1; tx++) {
+            const Tile& tile = acquireTile(level, tx, ty);
+            const int colFrom = std::max(x0, tx * TILE_SIZE);
+            const int colTo = std::min(x1, (tx + 1) * TILE_SIZE);
+            const int rowFrom = std::max(y0, ty * TILE_SIZE);
+            const int rowTo = std::min(y1, (ty + 1) * TILE_SIZE);
+            for (int y = rowFrom; y < rowTo; y++) {
+                const float* src = tile.costs.data() + (y - ty * TILE_SIZE) * TILE_SIZE + (colFrom - tx * TILE_SIZE);
+                float* dst = out + static_cast<size_t>(y - y0) * static_cast<size_t>(width) + static_cast<size_t>(colFrom - x0);
+                std::copy(src, src + (colTo - colFrom), dst);
+            }
+        }
+    }
+}
+
+void CostMap::invalidate() {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    clearTiles();
+}
+
+uint64_t CostMap::tileKey(int level, int tx, int ty) {
+    constexpr uint64_t INDEX_MASK = (uint64_t(1) << 28) - 1;
+    return (static_cast<uint64_t>(level) << 56) |
+           ((static_cast<uint64_t>(static_cast<uint32_t>(tx)) & INDEX_MASK) << 28) |
+           (static_cast<uint64_t>(static_cast<uint32_t>(ty)) & INDEX_MASK);
+}
+
+const CostMap::Tile& CostMap::acquireTile(int level, int tx, int ty) const {
+    const uint64_t key = tileKey(level, tx, ty);
+    auto found = tileIndex.find(key);
+    if (found != tileIndex.end()) {
+        tiles.splice(tiles.begin(), tiles, found->second);
+        return tiles.front();
+    }
+
+    // Reuse the least recently used tile's storage once the cache is full
+    if (tiles.size() >= cacheCapacity) {
+        tileIndex.erase(tiles.back().key);
+        tiles.splice(tiles.begin(), tiles, std::prev(tiles.end()));
+    } else {
+        tiles.emplace_front();
+        tiles.front().costs.resize(static_cast<size_t>(TILE_SIZE) * TILE_SIZE);
+    }
+    Tile& tile = tiles.front();
+    tile.key = key;
+    tile.level = level;
+    tile.tx = tx;
+    tile.ty = ty;
+    generateTile(level, tx, ty, tile.costs.data());
+    tileIndex[key] = tiles.begin();
+    return tile;
+}
+
+void CostMap::generateTile(int level, int tx, int ty, float* costs) const {
+    const double size = getCellSize(level);
+    const int x0 = tx * TILE_SIZE;
+    const int y0 = ty * TILE_SIZE;
+    const size_t samples = static_cast<size_t>(SAMPLE_SIZE) * SAMPLE_SIZE;
+
+    // Terrain at the cell centers of the tile and its halo
+    sampleElevation.assign(samples, 0.0);
+    if (elevation) {
+        sampleEast.resize(samples);
+        sampleNorth.resize(samples);
+        sampleUp.assign(samples, 0.0);
+        sampleLat.resize(samples);
+        sampleLon.resize(samples);
+        sampleHeight.resize(samples);
+        for (int r = 0; r < SAMPLE_SIZE; r++) {
+            for (int c = 0; c < SAMPLE_SIZE; c++) {
+                const size_t i = static_cast<size_t>(r * SAMPLE_SIZE + c);
+                sampleEast[i] = (x0 + c - 1 + 0.5) * size;
+                sampleNorth[i] = (y0 + r - 1 + 0.5) * size;
+            }
+        }
+        frame.fromLocal({sampleEast.data(), sampleNorth.data(), sampleUp.data()},
+                        {sampleLat.data(), sampleLon.data(), sampleHeight.data()}, samples);
+        for (size_t i = 0; i < samples; i++) {
+            sampleElevation[i] = elevation->getElevation(sampleLat[i], sampleLon[i]);
+        }
+    }
+
+    const double slopeScale = 0.5 / size;
+    for (int r = 0; r < TILE_SIZE; r++) {
+        const double* above = sampleElevation.data() + (r + 2) * SAMPLE_SIZE + 1;
+        const double* here = sampleElevation.data() + (r + 1) * SAMPLE_SIZE + 1;
+        const double* below = sampleElevation.data() + r * SAMPLE_SIZE + 1;
+        float* row = costs + r * TILE_SIZE;
+        for (int c = 0; c < TILE_SIZE; c++) {
+            const double slope = std::hypot((here[c + 1] - here[c - 1]) * slopeScale,
+                                            (above[c] - below[c]) * slopeScale);
+            const bool blocked = slope > parameters.maxSlope || here[c] > parameters.maxElevation;
+            row[c] = blocked ? INFINITY : static_cast<float>(1.0 + parameters.slopeWeight * slope);
+        }
+    }
+
+    const double west = x0 * size;
+    const double south = y0 * size;
+    const double extent = TILE_SIZE * size;
+    for (const Zone& zone : zones) {
+        if (zone.maxEast < west || zone.minEast > west + extent ||
+            zone.maxNorth < south || zone.minNorth > south + extent) continue;
+        blockZone(zone, level, tx, ty, costs);
+    }
+}
+
+// A polygon reaches into a row of cells where it covers the row's lower or
+// upper boundary line, or where one of its edges crosses the row, so the
+// spans of those three cover every cell it overlaps
+void CostMap::blockZone(const Zone& zone, int level, int tx, int ty, float* costs) const {
+    const double size = getCellSize(level);
+    const int x0 = tx * TILE_SIZE;
+    const size_t count = zone.east.size();
+
+    auto blockCrossings = [&](double line, float* row) {
+        crossings.clear();
+        for (size_t i = 0, j = count - 1; i < count; j = i++) {
+            if ((zone.north[i] > line) != (zone.north[j] > line)) {
+                const double t = (line - zone.north[i]) / (zone.north[j] - zone.north[i]);
+                crossings.push_back(zone.east[i] + t * (zone.east[j] - zone.east[i]));
+            }
+        }
+        std::sort(crossings.begin(), crossings.end());
+        for (size_t k = 0; k + 1 < crossings.size(); k += 2) {
+            blockSpan(crossings[k], crossings[k + 1], size, x0, row);
+        }
+    };
+
+    for (int r = 0; r < TILE_SIZE; r++) {
+        const double bottom = (ty * TILE_SIZE + r) * size;
+        const double top = bottom + size;
+        if (zone.maxNorth < bottom || zone.minNorth > top) continue;
+        float* row = costs + r * TILE_SIZE;
+
+        blockCrossings(bottom, row);
+        blockCrossings(top, row);
+        for (size_t i = 0, j = count - 1; i < count; j = i++) {
+            double e0 = zone.east[j], n0 = zone.north[j];
+            double e1 = zone.east[i], n1 = zone.north[i];
+            if (std::max(n0, n1) < bottom || std::min(n0, n1) > top) continue;
+            // Clip the edge to the row
+            if (n0 != n1) {
+                const double t0 = std::clamp((bottom - n0) / (n1 - n0), 0.0, 1.0);
+                const double t1 = std::clamp((top - n0) / (n1 - n0), 0.0, 1.0);
+                const double from = e0 + t0 * (e1 - e0);
+                const double to = e0 + t1 * (e1 - e0);
+                e0 = from;
+                e1 = to;
+            }
+            blockSpan(std::min(e0, e1), std::max(e0, e1), size, x0, row);
+        }
+    }
+}
+
+void CostMap::dropTiles(const Zone& zone) {
+    for (auto it = tiles.begin(); it != tiles.end();) {
+        const double size = getCellSize(it->level);
+        const double west = it->tx * TILE_SIZE * size;
+        const double south = it->ty * TILE_SIZE * size;
+        const double extent = TILE_SIZE * size;
+        if (zone.maxEast < west || zone.minEast > west + extent ||
+            zone.maxNorth < south || zone.minNorth > south + extent) {
+            ++it;
+            continue;
+        }
+        tileIndex.erase(it->key);
+        it = tiles.erase(it);
+    }
+}
+
+void CostMap::clearTiles() {
+    tiles.clear();
+    tileIndex.clear();
+}
 
-} // namespace pixhawk
\ No newline at end of file
+} // namespace pixhawk
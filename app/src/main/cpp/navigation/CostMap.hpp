@@ -0,0 +1,121 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "AStar.hpp"
+#include "Geodesy.hpp"
+
+namespace pixhawk {
+
+class ElevationLookup;
+
+// Traversal costs over a local east-north plane at a fixed origin, at
+// several resolutions: level 0 has the finest cells and each level up
+// doubles the cell size. Cells are indexed from the origin, x east and y
+// north, and cell (0, 0) at every level has its south-west corner there.
+//
+// Costs come in TILE_SIZE x TILE_SIZE tiles, each contiguous in memory,
+// generated on first access from terrain elevation, slope and no-fly
+// zones and kept in a bounded LRU cache, so only the parts of the map a
+// planner reads are ever materialized.
+class CostMap {
+public:
+    static constexpr int TILE_SIZE = 64;
+    static constexpr int LEVEL_COUNT = 8;
+    static constexpr double DEFAULT_CELL_METERS = 5.0;
+
+    struct Parameters {
+        double slopeWeight = 4.0;           // added cost per unit of slope (rise over run)
+        double maxSlope = 1.0;              // steeper cells are blocked
+        double maxElevation = INFINITY;     // terrain above this (meters) is blocked
+    };
+
+    explicit CostMap(double cellMeters = DEFAULT_CELL_METERS);
+    ~CostMap();
+
+    // Null uses flat terrain at 0 m
+    void setElevationSource(const ElevationLookup* elevation);
+    void setParameters(const Parameters& parameters);
+    void setCacheCapacity(size_t tiles);
+
+    // Moves the plane; drops every tile
+    void setOrigin(double lat, double lon);
+    LocalFrame getFrame() const;
+
+    double getCellSize(int level) const { return cellMeters * static_cast<double>(1 << level); }
+    GridCell toCell(int level, double east, double north) const;
+    void cellCenter(int level, GridCell cell, double& east, double& north) const;
+
+    // Polygon of lat/lon vertices; every cell it reaches into is blocked,
+    // at all levels. Returns the zone's id.
+    int addNoFlyZone(const std::vector<double>& lat, const std::vector<double>& lon);
+    bool removeNoFlyZone(int id);
+    // Plane bounding box of a zone; false if there is no such zone
+    bool getZoneBounds(int id, double& west, double& south, double& east, double& north) const;
+
+    // Passable costs are at least 1; blocked cells are infinite
+    float getCost(int level, int x, int y) const;
+    // Costs of cells [x0, x0 + width) x [y0, y0 + height), rows from y0
+    void rasterize(int level, int x0, int y0, int width, int height, float* out) const;
+
+    // Drops every tile, e.g. after the terrain source changed
+    void invalidate();
+
+private:
+    struct Zone {
+        int id;
+        std::vector<double> lat;
+        std::vector<double> lon;
+        std::vector<double> east;
+        std::vector<double> north;
+        double minEast;
+        double maxEast;
+        double minNorth;
+        double maxNorth;
+    };
+
+    struct Tile {
+        uint64_t key;
+        int level;
+        int tx;
+        int ty;
+        std::vector<float> costs;   // TILE_SIZE rows from the south
+    };
+
+    static constexpr size_t DEFAULT_CACHE_TILES = 512;     // 8 MB; a full trip grid plus the fine grid
+
+    const double cellMeters;
+    LocalFrame frame;
+    const ElevationLookup* elevation = nullptr;
+    Parameters parameters;
+    size_t cacheCapacity = DEFAULT_CACHE_TILES;
+
+    // Most recently used first
+    mutable std::mutex cacheMutex;
+    mutable std::list<Tile> tiles;
+    mutable std::unordered_map<uint64_t, std::list<Tile>::iterator> tileIndex;
+    // Guarded by cacheMutex, like everything tile generation reads
+    std::vector<Zone> zones;
+    int nextZoneId = 1;
+    // Scratch for tile generation
+    mutable std::vector<double> sampleEast;
+    mutable std::vector<double> sampleNorth;
+    mutable std::vector<double> sampleUp;
+    mutable std::vector<double> sampleLat;
+    mutable std::vector<double> sampleLon;
+    mutable std::vector<double> sampleHeight;
+    mutable std::vector<double> sampleElevation;
+    mutable std::vector<double> crossings;
+
+    static uint64_t tileKey(int level, int tx, int ty);
+    const Tile& acquireTile(int level, int tx, int ty) const;
+    void generateTile(int level, int tx, int ty, float* costs) const;
+    void blockZone(const Zone& zone, int level, int tx, int ty, float* costs) const;
+    void dropTiles(const Zone& zone);
+    void clearTiles();
+};
+
+} // namespace pixhawk
@@ -0,0 +1,217 @@
+#include "DStarLite.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace pixhawk {
+
+namespace {
+
+// Fixed-point units per cell length; the diagonal is rounded down, which
+// keeps the heuristic admissible
+constexpr double COST_UNITS = 1000.0;
+constexpr uint64_t STRAIGHT_UNITS = 1000;
+constexpr uint64_t DIAGONAL_UNITS = 1414;
+// Caps a cell's cost so that no path sum can overflow
+constexpr double MAX_CELL_COST = 1.0e6;
+
+uint64_t diagonalCost(uint64_t straight) {
+    return straight * DIAGONAL_UNITS / STRAIGHT_UNITS;
+}
+
+} // namespace
+
+void DStarLite::initialize(const CostGrid& grid, GridCell startCell, GridCell goalCell) {
+    width = grid.width;
+    height = grid.height;
+    start = startCell;
+    last = startCell;
+    goal = goalCell;
+    km = 0;
+    const double minCost = std::clamp(static_cast<double>(grid.minCost), 0.0, MAX_CELL_COST);
+    minStraight = static_cast<uint32_t>(std::floor(minCost * COST_UNITS));
+    minDiagonal = static_cast<uint32_t>(diagonalCost(minStraight));
+
+    const size_t cells = static_cast<size_t>(width) * static_cast<size_t>(height);
+    costs.resize(cells);
+    straightCost.resize(cells);
+    for (size_t i = 0; i < cells; i++) {
+        setCost(static_cast<uint32_t>(i), grid.costs[i]);
+    }
+    g.assign(cells, UNREACHABLE);
+    rhs.assign(cells, UNREACHABLE);
+    open.resize(cells);
+    open.clear();
+
+    const uint32_t goalIndex = index(goal);
+    rhs[goalIndex] = 0;
+    open.push(goalIndex, calculateKey(goalIndex));
+}
+
+void DStarLite::moveStart(GridCell startCell) {
+    // Keys already queued were computed from the old start; raising km by
+    // the distance moved keeps them lower bounds
+    km += heuristic(last, startCell);
+    last = startCell;
+    start = startCell;
+}
+
+void DStarLite::updateCells(const CellChange* changes, size_t count) {
+    const uint32_t goalIndex = index(goal);
+    for (size_t i = 0; i < count; i++) {
+        const GridCell cell = changes[i].cell;
+        if (!inside(cell.x, cell.y)) continue;
+        const uint32_t at = index(cell);
+        if (costs[at] == changes[i].cost) continue;
+        setCost(at, changes[i].cost);
+
+        // Steps into the cell, and diagonals past its sides, all leave from
+        // its neighbors
+        for (const GridStep& step : GRID_STEPS) {
+            const int nx = cell.x + step.dx;
+            const int ny = cell.y + step.dy;
+            if (!inside(nx, ny)) continue;
+            const uint32_t neighbor = index({nx, ny});
+            if (neighbor == goalIndex) continue;
+            rhs[neighbor] = bestSuccessor(neighbor, nullptr);
+            queue(neighbor);
+        }
+    }
+}
+
+bool DStarLite::findPath(std::vector<GridCell>& path) {
+    path.clear();
+    expanded = 0;
+    if (!isInitialized()) return false;
+    computeShortestPath();
+
+    uint32_t current = index(start);
+    if (rhs[current] == UNREACHABLE) return false;
+
+    const uint32_t goalIndex = index(goal);
+    const size_t maxSteps = costs.size();
+    path.push_back(start);
+    while (current != goalIndex) {
+        uint32_t next = current;
+        if (bestSuccessor(current, &next) == UNREACHABLE || path.size() > maxSteps) {
+            path.clear();
+            return false;
+        }
+        path.push_back(cellAt(next));
+        current = next;
+    }
+    return true;
+}
+
+void DStarLite::setCost(uint32_t cell, float cost) {
+    costs[cell] = cost;
+    straightCost[cell] = isPassable(cost)
+        ? static_cast<uint32_t>(std::lround(std::clamp(static_cast<double>(cost), 0.0, MAX_CELL_COST) * COST_UNITS))
+        : BLOCKED;
+}
+
+DStarLite::Distance DStarLite::heuristic(GridCell a, GridCell b) const {
+    const Distance dx = static_cast<Distance>(std::abs(a.x - b.x));
+    const Distance dy = static_cast<Distance>(std::abs(a.y - b.y));
+    const Distance diagonal = std::min(dx, dy);
+    return minStraight * (std::max(dx, dy) - diagonal) + minDiagonal * diagonal;
+}
+
+DStarLite::Key DStarLite::calculateKey(uint32_t cell) const {
+    const Distance best = std::min(g[cell], rhs[cell]);
+    if (best == UNREACHABLE) return {UNREACHABLE, UNREACHABLE};
+    return {best + heuristic(start, cellAt(cell)) + km, best};
+}
+
+DStarLite::Distance DStarLite::stepCost(GridCell cell, int s) const {
+    const GridStep& step = GRID_STEPS[s];
+    const uint32_t target = straightCost[index({cell.x + step.dx, cell.y + step.dy})];
+    if (target == BLOCKED) return UNREACHABLE;
+    if (s < 4) return target;
+    // No cutting past a blocked side
+    if (straightCost[index({cell.x + step.dx, cell.y})] == BLOCKED ||
+        straightCost[index({cell.x, cell.y + step.dy})] == BLOCKED) {
+        return UNREACHABLE;
+    }
+    return diagonalCost(target);
+}
+
+DStarLite::Distance DStarLite::bestSuccessor(uint32_t cell, uint32_t* next) const {
+    const GridCell at = cellAt(cell);
+    Distance best = UNREACHABLE;
+    for (int s = 0; s < 8; s++) {
+        const int nx = at.x + GRID_STEPS[s].dx;
+        const int ny = at.y + GRID_STEPS[s].dy;
+        if (!inside(nx, ny)) continue;
+        const uint32_t neighbor = index({nx, ny});
+        if (g[neighbor] == UNREACHABLE) continue;
+        const Distance cost = stepCost(at, s);
+        if (cost != UNREACHABLE && cost + g[neighbor] < best) {
+            best = cost + g[neighbor];
+            if (next) *next = neighbor;
+        }
+    }
+    return best;
+}
+
+void DStarLite::queue(uint32_t cell) {
+    if (g[cell] != rhs[cell]) {
+        open.set(cell, calculateKey(cell));
+    } else {
+        open.remove(cell);
+    }
+}
+
+// The paper's optimized loop: lowering a cell's g can only lower its
+// predecessors' rhs, and raising it only rescans those whose rhs came
+// through it
+void DStarLite::computeShortestPath() {
+    const uint32_t startIndex = index(start);
+    const uint32_t goalIndex = index(goal);
+    while (!open.empty() &&
+           (open.topKey() < calculateKey(startIndex) || rhs[startIndex] > g[startIndex])) {
+        const uint32_t cell = open.top();
+        const Key oldKey = open.topKey();
+        const Key newKey = calculateKey(cell);
+        if (oldKey < newKey) {
+            open.set(cell, newKey);
+            continue;
+        }
+        expanded++;
+
+        const GridCell at = cellAt(cell);
+        const Distance oldG = g[cell];
+        const bool lowered = g[cell] > rhs[cell];
+        if (lowered) {
+            g[cell] = rhs[cell];
+            open.remove(cell);
+        } else {
+            g[cell] = UNREACHABLE;
+        }
+        for (int s = 0; s < 8; s++) {
+            const int px = at.x - GRID_STEPS[s].dx;
+            const int py = at.y - GRID_STEPS[s].dy;
+            if (!inside(px, py)) continue;
+            const uint32_t pred = index({px, py});
+            if (pred == goalIndex) continue;
+            const Distance cost = stepCost({px, py}, s);
+            if (cost == UNREACHABLE) continue;
+            if (lowered) {
+                if (cost + g[cell] < rhs[pred]) {
+                    rhs[pred] = cost + g[cell];
+                    queue(pred);
+                }
+            } else if (oldG != UNREACHABLE && rhs[pred] == cost + oldG) {
+                rhs[pred] = bestSuccessor(pred, nullptr);
+                queue(pred);
+            }
+        }
+        if (!lowered) {
+            if (cell != goalIndex) {
+                rhs[cell] = bestSuccessor(cell, nullptr);
+            }
+            queue(cell);
+        }
+    }
+}
+
+} // namespace pixhawk
@@ -0,0 +1,98 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "AStar.hpp"
+#include "IndexedHeap.hpp"
+
+namespace pixhawk {
+
+struct CellChange {
+    GridCell cell;
+    float cost;
+};
+
+// Incremental grid planner (D* Lite, Koenig & Likhachev 2002) with the
+// same step costs and 8-connectivity as AStar. The search runs backward
+// from the goal and is kept between queries, so after the start moves or
+// cell costs change only the affected part of the search is repaired.
+//
+// Costs are held in fixed point, so path costs and the heuristic agree
+// exactly; the search relies on comparing keys that are equal in theory.
+class DStarLite {
+public:
+    DStarLite() = default;
+    ~DStarLite() = default;
+
+    // Copies the grid's costs and searches from scratch on the next query
+    void initialize(const CostGrid& grid, GridCell start, GridCell goal);
+    bool isInitialized() const { return width > 0; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    GridCell getGoal() const { return goal; }
+
+    // Requires a cell inside the grid
+    void moveStart(GridCell start);
+    // Row-major costs as last initialized or updated
+    const std::vector<float>& getCosts() const { return costs; }
+    void updateCells(const CellChange* changes, size_t count);
+    void updateCells(const std::vector<CellChange>& changes) { updateCells(changes.data(), changes.size()); }
+
+    // Cells from start to goal inclusive; false, with 'path' empty, if the
+    // goal is unreachable
+    bool findPath(std::vector<GridCell>& path);
+
+    // Cells expanded by the last findPath
+    size_t getExpandedCount() const { return expanded; }
+
+private:
+    using Distance = uint64_t;
+
+    struct Key {
+        Distance k1;
+        Distance k2;
+
+        bool operator<(const Key& other) const {
+            return k1 < other.k1 || (k1 == other.k1 && k2 < other.k2);
+        }
+    };
+
+    static constexpr Distance UNREACHABLE = UINT64_MAX;
+    static constexpr uint32_t BLOCKED = UINT32_MAX;
+
+    int width = 0;
+    int height = 0;
+    GridCell start{0, 0};
+    GridCell goal{0, 0};
+    GridCell last{0, 0};            // start when km was last brought up to date
+    Distance km = 0;
+    uint32_t minStraight = 0;       // heuristic step costs
+    uint32_t minDiagonal = 0;
+
+    std::vector<float> costs;
+    std::vector<uint32_t> straightCost;     // fixed-point cost of stepping into the cell
+    std::vector<Distance> g;
+    std::vector<Distance> rhs;
+    IndexedHeap<Key> open;
+    size_t expanded = 0;
+
+    uint32_t index(GridCell cell) const {
+        return static_cast<uint32_t>(cell.y) * static_cast<uint32_t>(width) + static_cast<uint32_t>(cell.x);
+    }
+    GridCell cellAt(uint32_t i) const {
+        return {static_cast<int>(i % static_cast<uint32_t>(width)), static_cast<int>(i / static_cast<uint32_t>(width))};
+    }
+    bool inside(int x, int y) const { return x >= 0 && y >= 0 && x < width && y < height; }
+
+    void setCost(uint32_t cell, float cost);
+    Distance heuristic(GridCell a, GridCell b) const;
+    Key calculateKey(uint32_t cell) const;
+    // Cost of step 's' out of 'cell', or UNREACHABLE; the target must be inside
+    Distance stepCost(GridCell cell, int s) const;
+    // Cheapest step plus g over the cell's successors
+    Distance bestSuccessor(uint32_t cell, uint32_t* next) const;
+    void queue(uint32_t cell);
+    void computeShortestPath();
+};
+
+} // namespace pixhawk
@@ -0,0 +1,343 @@
+#include "Geofence.hpp"
+#include <algorithm>
+#include <cmath>
+
+#ifdef PIXHAWKCORE_VERBOSE
+#include <android/log.h>
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, "Geofence", __VA_ARGS__)
+#else
+#define LOGI(...)
+#endif
+
+namespace pixhawk {
+
+namespace {
+
+constexpr double DEG_TO_RAD = M_PI / 180.0;
+// Cells are grown by this much (degrees) before testing edges against them,
+// so rounding can only mark a cell as boundary, never miss one
+constexpr double CELL_SLACK = 1e-9;
+constexpr size_t EDGES_PER_BAND = 4;
+constexpr size_t MAX_BANDS = 1024;
+
+// Whether segment (x0, y0)-(x1, y1) touches the box (Liang-Barsky clipping)
+bool segmentTouchesBox(double x0, double y0, double x1, double y1,
+                       double minX, double minY, double maxX, double maxY) {
+    double t0 = 0.0;
+    double t1 = 1.0;
+    const double dx = x1 - x0;
+    const double dy = y1 - y0;
+    const double p[4] = {-dx, dx, -dy, dy};
+    const double q[4] = {x0 - minX, maxX - x0, y0 - minY, maxY - y0};
+    for (int i = 0; i < 4; i++) {
+        if (p[i] == 0.0) {
+            if (q[i] < 0.0) return false;
+            continue;
+        }
+        const double t = q[i] / p[i];
+        if (p[i] < 0.0) {
+            t0 = std::max(t0, t);
+        } else {
+            t1 = std::min(t1, t);
+        }
+        if (t0 > t1) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+Geofence::Geofence(double cellDegrees) : cellDegrees(cellDegrees) {}
+
+Geofence::~Geofence() = default;
+
+int Geofence::addPolygon(Kind kind, const std::vector<double>& lat, const std::vector<double>& lon) {
+    const size_t count = lat.size();
+    if (count < 3 || lon.size() != count) return 0;
+    for (size_t i = 0; i < count; i++) {
+        if (!std::isfinite(lat[i]) || !std::isfinite(lon[i])) return 0;
+    }
+
+    Fence fence;
+    fence.kind = kind;
+    fence.circle = false;
+    fence.x = lon;
+    fence.y = lat;
+    fence.minLat = *std::min_element(lat.begin(), lat.end());
+    fence.maxLat = *std::max_element(lat.begin(), lat.end());
+    fence.minLon = *std::min_element(lon.begin(), lon.end());
+    fence.maxLon = *std::max_element(lon.begin(), lon.end());
+
+    // Each edge goes into every band its latitude range touches
+    const size_t bandCount = std::clamp<size_t>(count / EDGES_PER_BAND, 1, MAX_BANDS);
+    fence.bandOrigin = fence.minLat;
+    fence.bandHeight = fence.maxLat > fence.minLat ? (fence.maxLat - fence.minLat) / static_cast<double>(bandCount) : 1.0;
+    auto band = [&](double y) {
+        const double b = std::floor((y - fence.bandOrigin) / fence.bandHeight);
+        return static_cast<size_t>(std::clamp(b, 0.0, static_cast<double>(bandCount - 1)));
+    };
+    fence.bandStart.assign(bandCount + 1, 0);
+    for (size_t e = 0; e < count; e++) {
+        const size_t next = (e + 1) % count;
+        for (size_t b = band(std::min(lat[e], lat[next])); b <= band(std::max(lat[e], lat[next])); b++) {
+            fence.bandStart[b + 1]++;
+        }
+    }
+    for (size_t b = 0; b < bandCount; b++) {
+        fence.bandStart[b + 1] += fence.bandStart[b];
+    }
+    fence.bandEdges.resize(fence.bandStart[bandCount]);
+    std::vector<uint32_t> fill(fence.bandStart.begin(), fence.bandStart.end() - 1);
+    for (size_t e = 0; e < count; e++) {
+        const size_t next = (e + 1) % count;
+        for (size_t b = band(std::min(lat[e], lat[next])); b <= band(std::max(lat[e], lat[next])); b++) {
+            fence.bandEdges[fill[b]++] = static_cast<uint32_t>(e);
+        }
+    }
+    return addFence(std::move(fence));
+}
+
+int Geofence::addCircle(Kind kind, double lat, double lon, double radius) {
+    if (!std::isfinite(lat) || !std::isfinite(lon) || !(radius > 0.0) || !std::isfinite(radius)) return 0;
+
+    // Meters per degree on the ellipsoid at the center's latitude
+    const double phi = lat * DEG_TO_RAD;
+    Fence fence;
+    fence.kind = kind;
+    fence.circle = true;
+    fence.centerLat = lat;
+    fence.centerLon = lon;
+    fence.radius = radius;
+    fence.metersPerLat = 111132.954 - 559.822 * std::cos(2.0 * phi) + 1.175 * std::cos(4.0 * phi);
+    fence.metersPerLon = std::max(111412.84 * std::cos(phi) - 93.5 * std::cos(3.0 * phi), 1.0);
+    fence.minLat = std::max(lat - radius / fence.metersPerLat, -90.0);
+    fence.maxLat = std::min(lat + radius / fence.metersPerLat, 90.0);
+    fence.minLon = std::max(lon - radius / fence.metersPerLon, -180.0);
+    fence.maxLon = std::min(lon + radius / fence.metersPerLon, 180.0);
+    return addFence(std::move(fence));
+}
+
+bool Geofence::remove(int id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = fences.find(id);
+    if (it == fences.end()) return false;
+
+    unindexFence(it->second);
+    // Removing a fence is not leaving it
+    for (auto& [sysid, vehicle] : vehicles) {
+        vehicle.inside.erase(std::remove(vehicle.inside.begin(), vehicle.inside.end(), id), vehicle.inside.end());
+    }
+    fences.erase(it);
+    generation++;
+    return true;
+}
+
+void Geofence::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    cells.clear();
+    largeFences.clear();
+    fences.clear();
+    for (auto& [sysid, vehicle] : vehicles) {
+        vehicle.inside.clear();
+    }
+    generation++;
+}
+
+size_t Geofence::getFenceCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return fences.size();
+}
+
+void Geofence::findContaining(double lat, double lon, std::vector<int>& ids) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cells.find(cellKey(toIndex(lat), toIndex(lon)));
+    collectInside(it != cells.end() ? &it->second : nullptr, lat, lon, ids);
+}
+
+size_t Geofence::update(int32_t sysid, int64_t timestamp_ms, double lat, double lon, double alt,
+                        std::vector<GeofenceEvent>& events) {
+    std::lock_guard<std::mutex> lock(mutex);
+    VehicleState& vehicle = vehicles[sysid];
+
+    // Most fixes land in the same cell as the one before
+    const uint64_t key = cellKey(toIndex(lat), toIndex(lon));
+    if (vehicle.generation != generation || vehicle.cellKey != key) {
+        auto it = cells.find(key);
+        vehicle.cell = it != cells.end() ? &it->second : nullptr;
+        vehicle.cellKey = key;
+        vehicle.generation = generation;
+    }
+    collectInside(vehicle.cell, lat, lon, scratchInside);
+
+    // Both lists are sorted; walk them together for the differences
+    const size_t before = events.size();
+    auto emit = [&](int id, bool entered) {
+        const Kind kind = fences.at(id).kind;
+        const bool breach = entered == (kind == Kind::EXCLUSION);
+        events.push_back({id, sysid, entered, breach, timestamp_ms, lat, lon, alt});
+        LOGI("Vehicle %d %s fence %d%s", sysid, entered ? "entered" : "left", id, breach ? " (breach)" : "");
+    };
+    size_t i = 0;
+    size_t j = 0;
+    while (i < vehicle.inside.size() || j < scratchInside.size()) {
+        if (j == scratchInside.size() || (i < vehicle.inside.size() && vehicle.inside[i] < scratchInside[j])) {
+            emit(vehicle.inside[i++], false);
+        } else if (i == vehicle.inside.size() || scratchInside[j] < vehicle.inside[i]) {
+            emit(scratchInside[j++], true);
+        } else {
+            i++;
+            j++;
+        }
+    }
+    vehicle.inside.swap(scratchInside);
+    return events.size() - before;
+}
+
+uint64_t Geofence::cellKey(int64_t row, int64_t col) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(row)) << 32) | static_cast<uint32_t>(col);
+}
+
+int64_t Geofence::toIndex(double degrees) const {
+    return static_cast<int64_t>(std::floor(degrees / cellDegrees));
+}
+
+int Geofence::addFence(Fence&& fence) {
+    std::lock_guard<std::mutex> lock(mutex);
+    fence.id = nextId++;
+    const Fence& stored = fences.emplace(fence.id, std::move(fence)).first->second;
+    indexFence(stored);
+    generation++;
+    LOGI("Added %s fence %d", stored.kind == Kind::EXCLUSION ? "exclusion" : "inclusion", stored.id);
+    return stored.id;
+}
+
+void Geofence::indexFence(const Fence& fence) {
+    const int64_t row0 = toIndex(fence.minLat);
+    const int64_t col0 = toIndex(fence.minLon);
+    const int64_t rows = toIndex(fence.maxLat) - row0 + 1;
+    const int64_t cols = toIndex(fence.maxLon) - col0 + 1;
+    if (static_cast<uint64_t>(rows) * static_cast<uint64_t>(cols) > MAX_FENCE_CELLS) {
+        largeFences.push_back(&fence);
+        return;
+    }
+
+    std::vector<Cover> cover(static_cast<size_t>(rows * cols), Cover::OUTSIDE);
+    auto at = [&](int64_t r, int64_t c) -> Cover& { return cover[static_cast<size_t>(r * cols + c)]; };
+    if (fence.circle) {
+        for (int64_t r = 0; r < rows; r++) {
+            for (int64_t c = 0; c < cols; c++) {
+                at(r, c) = coverCircle(fence, static_cast<double>(row0 + r) * cellDegrees,
+                                       static_cast<double>(col0 + c) * cellDegrees);
+            }
+        }
+    } else {
+        // Cells an edge passes through, then whole cells by their centers
+        const size_t count = fence.x.size();
+        for (size_t e = 0; e < count; e++) {
+            const size_t next = (e + 1) % count;
+            const double x0 = fence.x[e], y0 = fence.y[e], x1 = fence.x[next], y1 = fence.y[next];
+            const int64_t rFrom = toIndex(std::min(y0, y1) - CELL_SLACK) - row0;
+            const int64_t rTo = toIndex(std::max(y0, y1) + CELL_SLACK) - row0;
+            const int64_t cFrom = toIndex(std::min(x0, x1) - CELL_SLACK) - col0;
+            const int64_t cTo = toIndex(std::max(x0, x1) + CELL_SLACK) - col0;
+            for (int64_t r = std::max<int64_t>(rFrom, 0); r <= std::min(rTo, rows - 1); r++) {
+                const double south = static_cast<double>(row0 + r) * cellDegrees;
+                for (int64_t c = std::max<int64_t>(cFrom, 0); c <= std::min(cTo, cols - 1); c++) {
+                    const double west = static_cast<double>(col0 + c) * cellDegrees;
+                    if (segmentTouchesBox(x0, y0, x1, y1, west - CELL_SLACK, south - CELL_SLACK,
+                                          west + cellDegrees + CELL_SLACK, south + cellDegrees + CELL_SLACK)) {
+                        at(r, c) = Cover::BOUNDARY;
+                    }
+                }
+            }
+        }
+        for (int64_t r = 0; r < rows; r++) {
+            for (int64_t c = 0; c < cols; c++) {
+                if (at(r, c) == Cover::BOUNDARY) continue;
+                const double lat = (static_cast<double>(row0 + r) + 0.5) * cellDegrees;
+                const double lon = (static_cast<double>(col0 + c) + 0.5) * cellDegrees;
+                at(r, c) = contains(fence, lat, lon) ? Cover::INSIDE : Cover::OUTSIDE;
+            }
+        }
+    }
+
+    for (int64_t r = 0; r < rows; r++) {
+        for (int64_t c = 0; c < cols; c++) {
+            if (at(r, c) == Cover::OUTSIDE) continue;
+            cells[cellKey(row0 + r, col0 + c)].push_back({&fence, at(r, c) == Cover::BOUNDARY});
+        }
+    }
+}
+
+void Geofence::unindexFence(const Fence& fence) {
+    auto large = std::find(largeFences.begin(), largeFences.end(), &fence);
+    if (large != largeFences.end()) {
+        largeFences.erase(large);
+        return;
+    }
+    for (int64_t row = toIndex(fence.minLat); row <= toIndex(fence.maxLat); row++) {
+        for (int64_t col = toIndex(fence.minLon); col <= toIndex(fence.maxLon); col++) {
+            auto it = cells.find(cellKey(row, col));
+            if (it == cells.end()) continue;
+            std::vector<CellEntry>& entries = it->second;
+            entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                         [&](const CellEntry& entry) { return entry.fence == &fence; }),
+                          entries.end());
+            if (entries.empty()) cells.erase(it);
+        }
+    }
+}
+
+Geofence::Cover Geofence::coverCircle(const Fence& fence, double south, double west) const {
+    // Nearest and farthest points of the cell from the center, in meters
+    const double north = south + cellDegrees;
+    const double east = west + cellDegrees;
+    const double nearY = (std::clamp(fence.centerLat, south, north) - fence.centerLat) * fence.metersPerLat;
+    const double nearX = (std::clamp(fence.centerLon, west, east) - fence.centerLon) * fence.metersPerLon;
+    const double farY = std::max(std::fabs(south - fence.centerLat), std::fabs(north - fence.centerLat)) * fence.metersPerLat;
+    const double farX = std::max(std::fabs(west - fence.centerLon), std::fabs(east - fence.centerLon)) * fence.metersPerLon;
+    const double r2 = fence.radius * fence.radius;
+    if (nearX * nearX + nearY * nearY > r2) return Cover::OUTSIDE;
+    if (farX * farX + farY * farY <= r2) return Cover::INSIDE;
+    return Cover::BOUNDARY;
+}
+
+bool Geofence::contains(const Fence& fence, double lat, double lon) {
+    if (lat < fence.minLat || lat > fence.maxLat || lon < fence.minLon || lon > fence.maxLon) return false;
+    if (fence.circle) {
+        const double dy = (lat - fence.centerLat) * fence.metersPerLat;
+        const double dx = (lon - fence.centerLon) * fence.metersPerLon;
+        return dx * dx + dy * dy <= fence.radius * fence.radius;
+    }
+
+    // Crossings of a ray to the east, over the edges of the point's band
+    const size_t bandCount = fence.bandStart.size() - 1;
+    const double b = std::floor((lat - fence.bandOrigin) / fence.bandHeight);
+    const size_t band = static_cast<size_t>(std::clamp(b, 0.0, static_cast<double>(bandCount - 1)));
+    const size_t count = fence.x.size();
+    bool inside = false;
+    for (uint32_t k = fence.bandStart[band]; k < fence.bandStart[band + 1]; k++) {
+        const size_t i = fence.bandEdges[k];
+        const size_t j = (i + 1) % count;
+        if ((fence.y[i] > lat) != (fence.y[j] > lat) &&
+            lon < (fence.x[j] - fence.x[i]) * (lat - fence.y[i]) / (fence.y[j] - fence.y[i]) + fence.x[i]) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+void Geofence::collectInside(const std::vector<CellEntry>* cell, double lat, double lon, std::vector<int>& ids) const {
+    ids.clear();
+    if (cell) {
+        for (const CellEntry& entry : *cell) {
+            if (!entry.boundary || contains(*entry.fence, lat, lon)) ids.push_back(entry.fence->id);
+        }
+    }
+    for (const Fence* fence : largeFences) {
+        if (contains(*fence, lat, lon)) ids.push_back(fence->id);
+    }
+    std::sort(ids.begin(), ids.end());
+}
+
+} // namespace pixhawk
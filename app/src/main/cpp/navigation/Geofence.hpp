@@ -0,0 +1,127 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace pixhawk {
+
+struct GeofenceEvent {
+    int fenceId;
+    int32_t sysid;
+    bool entered;           // false when the vehicle left the fence
+    bool breach;            // entered an exclusion fence or left an inclusion one
+    int64_t timestamp_ms;
+    double lat;
+    double lon;
+    double alt;
+};
+
+// Inclusion and exclusion fences, polygons with straight edges in lat/lon
+// or circles, checked against vehicle positions. Fences are indexed on a
+// uniform lat/lon grid: each cell lists the fences that cover it entirely
+// and those whose boundary crosses it, so a position only ever tests the
+// boundary fences of its own cell. Polygon edges are further bucketed into
+// latitude bands, so a test scans the edges of one band.
+//
+// A fence spanning more than MAX_FENCE_CELLS cells is kept out of the grid
+// and tested on every query instead. Fences must not cross the antimeridian.
+class Geofence {
+public:
+    enum class Kind {
+        INCLUSION,
+        EXCLUSION
+    };
+
+    static constexpr double DEFAULT_CELL_DEGREES = 0.01;
+    static constexpr size_t MAX_FENCE_CELLS = 1 << 16;
+
+    explicit Geofence(double cellDegrees = DEFAULT_CELL_DEGREES);
+    ~Geofence();
+
+    // Return the fence's id, or 0 for fewer than three vertices, mismatched
+    // arrays or a non-positive radius
+    int addPolygon(Kind kind, const std::vector<double>& lat, const std::vector<double>& lon);
+    int addCircle(Kind kind, double lat, double lon, double radius);
+    bool remove(int id);
+    void clear();
+    size_t getFenceCount() const;
+
+    // Ids of the fences containing the point, ascending
+    void findContaining(double lat, double lon, std::vector<int>& ids) const;
+
+    // Moves the vehicle and appends an event for every fence it entered or
+    // left since its last update; returns how many were appended. A
+    // vehicle's first update reports the fences it starts in.
+    size_t update(int32_t sysid, int64_t timestamp_ms, double lat, double lon, double alt,
+                  std::vector<GeofenceEvent>& events);
+
+private:
+    struct Fence {
+        int id = 0;
+        Kind kind = Kind::INCLUSION;
+        bool circle = false;
+        // Polygon vertices, x = lon and y = lat in degrees, and its edges
+        // bucketed into bands of latitude (edge i runs from vertex i to i + 1)
+        std::vector<double> x;
+        std::vector<double> y;
+        double bandOrigin = 0.0;
+        double bandHeight = 1.0;
+        std::vector<uint32_t> bandStart;    // bandCount + 1 offsets into bandEdges
+        std::vector<uint32_t> bandEdges;
+        // Circle
+        double centerLat = 0.0;
+        double centerLon = 0.0;
+        double radius = 0.0;                // m
+        double metersPerLat = 0.0;
+        double metersPerLon = 0.0;
+        // Bounding box
+        double minLat = 0.0;
+        double maxLat = 0.0;
+        double minLon = 0.0;
+        double maxLon = 0.0;
+    };
+
+    enum class Cover {
+        OUTSIDE,
+        BOUNDARY,
+        INSIDE
+    };
+
+    struct CellEntry {
+        const Fence* fence;
+        bool boundary;          // else the fence covers the whole cell
+    };
+
+    struct VehicleState {
+        uint64_t cellKey = 0;
+        const std::vector<CellEntry>* cell = nullptr;   // null for a cell with no fences
+        uint64_t generation = 0;                        // of the index when 'cell' was looked up
+        std::vector<int> inside;                        // ascending fence ids
+    };
+
+    const double cellDegrees;
+
+    mutable std::mutex mutex;
+    std::unordered_map<int, Fence> fences;
+    std::unordered_map<uint64_t, std::vector<CellEntry>> cells;
+    std::vector<const Fence*> largeFences;
+    uint64_t generation = 1;            // bumped whenever the cells change
+    int nextId = 1;
+
+    std::unordered_map<int32_t, VehicleState> vehicles;
+    std::vector<int> scratchInside;
+
+    static uint64_t cellKey(int64_t row, int64_t col);
+    int64_t toIndex(double degrees) const;
+    int addFence(Fence&& fence);
+    void indexFence(const Fence& fence);
+    void unindexFence(const Fence& fence);
+    // How a circle covers the cell with the given south-west corner
+    Cover coverCircle(const Fence& fence, double south, double west) const;
+    static bool contains(const Fence& fence, double lat, double lon);
+    void collectInside(const std::vector<CellEntry>* cell, double lat, double lon, std::vector<int>& ids) const;
+};
+
+} // namespace pixhawk
@@ -0,0 +1,126 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pixhawk {
+
+// 4-ary min-heap of grid cells keyed by 'Key' (anything with operator<),
+// with decrease/increase-key and removal by cell. Each cell's slot in the
+// heap is kept in a flat array; a slot only counts if the entry there
+// names the cell back, so clear() is O(1) and the array is never reset.
+// Storage is kept across clear(), so a reused heap does not allocate.
+template <typename Key>
+class IndexedHeap {
+public:
+    // Cells must be < cellCount
+    void resize(size_t cellCount) {
+        if (slots.size() < cellCount) slots.resize(cellCount, 0);
+    }
+
+    void clear() { entries.clear(); }
+    bool empty() const { return entries.empty(); }
+    size_t size() const { return entries.size(); }
+
+    bool contains(uint32_t cell) const {
+        const uint32_t slot = slots[cell];
+        return slot < entries.size() && entries[slot].cell == cell;
+    }
+
+    uint32_t top() const { return entries.front().cell; }
+    const Key& topKey() const { return entries.front().key; }
+    // Requires contains(cell)
+    const Key& key(uint32_t cell) const { return entries[slots[cell]].key; }
+
+    // Requires !contains(cell)
+    void push(uint32_t cell, const Key& key) {
+        entries.push_back({key, cell});
+        siftUp(entries.size() - 1);
+    }
+
+    // Inserts the cell or moves it to its new key
+    void set(uint32_t cell, const Key& key) {
+        if (!contains(cell)) {
+            push(cell, key);
+            return;
+        }
+        const size_t slot = slots[cell];
+        const bool decreased = key < entries[slot].key;
+        entries[slot].key = key;
+        if (decreased) {
+            siftUp(slot);
+        } else {
+            siftDown(slot);
+        }
+    }
+
+    uint32_t pop() {
+        const uint32_t cell = entries.front().cell;
+        removeAt(0);
+        return cell;
+    }
+
+    void remove(uint32_t cell) {
+        if (contains(cell)) removeAt(slots[cell]);
+    }
+
+private:
+    static constexpr size_t ARITY = 4;
+
+    struct Entry {
+        Key key;
+        uint32_t cell;
+    };
+
+    std::vector<Entry> entries;
+    std::vector<uint32_t> slots;
+
+    void place(size_t slot, const Entry& entry) {
+        entries[slot] = entry;
+        slots[entry.cell] = static_cast<uint32_t>(slot);
+    }
+
+    void removeAt(size_t slot) {
+        const Entry last = entries.back();
+        entries.pop_back();
+        if (slot == entries.size()) return;
+        const bool decreased = last.key < entries[slot].key;
+        place(slot, last);
+        if (decreased) {
+            siftUp(slot);
+        } else {
+            siftDown(slot);
+        }
+    }
+
+    void siftUp(size_t slot) {
+        const Entry moving = entries[slot];
+        while (slot > 0) {
+            const size_t parent = (slot - 1) / ARITY;
+            if (!(moving.key < entries[parent].key)) break;
+            place(slot, entries[parent]);
+            slot = parent;
+        }
+        place(slot, moving);
+    }
+
+    void siftDown(size_t slot) {
+        const Entry moving = entries[slot];
+        const size_t count = entries.size();
+        for (;;) {
+            const size_t first = slot * ARITY + 1;
+            if (first >= count) break;
+            const size_t last = first + ARITY < count ? first + ARITY : count;
+            size_t best = first;
+            for (size_t child = first + 1; child < last; child++) {
+                if (entries[child].key < entries[best].key) best = child;
+            }
+            if (!(entries[best].key < moving.key)) break;
+            place(slot, entries[best]);
+            slot = best;
+        }
+        place(slot, moving);
+    }
+};
+
+} // namespace pixhawk
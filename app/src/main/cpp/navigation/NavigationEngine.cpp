@@ -1,4 +1,14 @@
 #include "NavigationEngine.hpp"
+#include <algorithm>
+#include <cmath>
+#include "Geodesy.hpp"
+
+#ifdef PIXHAWKCORE_VERBOSE
+#include <android/log.h>
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, "NavigationEngine", __VA_ARGS__)
+#else
+#define LOGI(...)
+#endif
 
 namespace pixhawk {
 
@@ -9,20 +19,309 @@ bool NavigationEngine::initialize() {
     return true;
 }
 
+void NavigationEngine::setElevationSource(const ElevationLookup* elevation) {
+    std::lock_guard<std::mutex> lock(mutex);
+    costMap.setElevationSource(elevation);
+    tripLevel = -1;
+}
+
+int NavigationEngine::addNoFlyZone(const std::vector<double>& lat, const std::vector<double>& lon) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const int id = costMap.addNoFlyZone(lat, lon);
+    double west, south, east, north;
+    if (id != 0 && costMap.getZoneBounds(id, west, south, east, north)) {
+        updateTrip(west, south, east, north);
+    }
+    return id;
+}
+
+bool NavigationEngine::removeNoFlyZone(int id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    double west, south, east, north;
+    if (!costMap.getZoneBounds(id, west, south, east, north)) return false;
+    costMap.removeNoFlyZone(id);
+    updateTrip(west, south, east, north);
+    return true;
+}
+
+void NavigationEngine::invalidateCosts() {
+    std::lock_guard<std::mutex> lock(mutex);
+    costMap.invalidate();
+    tripLevel = -1;
+}
+
 void NavigationEngine::setDestination(double lat, double lon, double alt) {
+    std::lock_guard<std::mutex> lock(mutex);
     targetLat = lat;
     targetLon = lon;
     targetAlt = alt;
 }
 
+void NavigationEngine::setCurrentPosition(double lat, double lon, double alt) {
+    std::lock_guard<std::mutex> lock(mutex);
+    currentLat = lat;
+    currentLon = lon;
+    currentAlt = alt;
+}
+
 void NavigationEngine::getCurrentPosition(double& lat, double& lon, double& alt) {
+    std::lock_guard<std::mutex> lock(mutex);
     lat = currentLat;
     lon = currentLon;
     alt = currentAlt;
 }
 
 bool NavigationEngine::calculatePath() {
+    std::lock_guard<std::mutex> lock(mutex);
+    path.clear();
+    pathCost = 0.0;
+
+    // Keep the cost map's plane near the vehicle, where its distortion is small
+    LocalFrame frame = costMap.getFrame();
+    double startEast, startNorth, goalEast, goalNorth, up;
+    frame.toLocal(currentLat, currentLon, 0.0, startEast, startNorth, up);
+    if (!originSet || std::hypot(startEast, startNorth) > REORIGIN_METERS) {
+        costMap.setOrigin(currentLat, currentLon);
+        frame = costMap.getFrame();
+        originSet = true;
+        tripLevel = -1;
+        frame.toLocal(currentLat, currentLon, 0.0, startEast, startNorth, up);
+    }
+    frame.toLocal(targetLat, targetLon, 0.0, goalEast, goalNorth, up);
+
+    const double span = std::max(std::fabs(goalEast - startEast), std::fabs(goalNorth - startNorth));
+    const double margin = std::max(MIN_MARGIN_METERS, MARGIN_FRACTION * span);
+    const double west = std::min(startEast, goalEast) - margin;
+    const double south = std::min(startNorth, goalNorth) - margin;
+    const double east = std::max(startEast, goalEast) + margin;
+    const double north = std::max(startNorth, goalNorth) + margin;
+
+    int level = 0;
+    while ((east - west) / costMap.getCellSize(level) > MAX_GRID_CELLS - 2 ||
+           (north - south) / costMap.getCellSize(level) > MAX_GRID_CELLS - 2) {
+        if (++level == CostMap::LEVEL_COUNT) {
+            LOGI("Destination %.0f m away is beyond planning range", span);
+            return false;
+        }
+    }
+    if (!planTrip(level, west, south, east, north, startEast, startNorth, goalEast, goalNorth, route)) {
+        LOGI("No path at level %d", level);
+        return false;
+    }
+    pathCost = route.back().cost;
+
+    // Replan the part of the route near the vehicle at full resolution, up
+    // to the last coarse point before the route first leaves the fine grid
+    if (level > 0) {
+        const double half = 0.5 * (FINE_GRID_CELLS - 2 * FINE_EDGE_CELLS) * costMap.getCellSize(0);
+        size_t join = 0;
+        while (join + 1 < route.size() && std::fabs(route[join + 1].east - startEast) < half &&
+               std::fabs(route[join + 1].north - startNorth) < half) {
+            join++;
+        }
+        const double fineHalf = 0.5 * FINE_GRID_CELLS * costMap.getCellSize(0);
+        if (join > 0 &&
+            planLeg(0, startEast - fineHalf, startNorth - fineHalf, startEast + fineHalf, startNorth + fineHalf,
+                    startEast, startNorth, route[join].east, route[join].north, fineRoute)) {
+            const double offset = fineRoute.back().cost - route[join].cost;
+            for (size_t i = join + 1; i < route.size(); i++) {
+                fineRoute.push_back({route[i].east, route[i].north, route[i].cost + offset});
+            }
+            pathCost = fineRoute.back().cost;
+            route.swap(fineRoute);
+        }
+    }
+
+    // Keep the points where the heading changes, with the altitude
+    // interpolated over the distance flown
+    std::vector<double> distance(route.size(), 0.0);
+    for (size_t i = 1; i < route.size(); i++) {
+        distance[i] = distance[i - 1] + std::hypot(route[i].east - route[i - 1].east, route[i].north - route[i - 1].north);
+    }
+    const double total = distance.back();
+    path.push_back({currentLat, currentLon, currentAlt});
+    for (size_t i = 1; i + 1 < route.size(); i++) {
+        const double inEast = route[i].east - route[i - 1].east;
+        const double inNorth = route[i].north - route[i - 1].north;
+        const double outEast = route[i + 1].east - route[i].east;
+        const double outNorth = route[i + 1].north - route[i].north;
+        const double cross = inEast * outNorth - inNorth * outEast;
+        const double dot = inEast * outEast + inNorth * outNorth;
+        if (dot > 0.0 && std::fabs(cross) <= 1e-9 * dot) continue;
+
+        Waypoint turn;
+        frame.fromLocal(route[i].east, route[i].north, 0.0, turn.lat, turn.lon, turn.alt);
+        turn.alt = currentAlt + (targetAlt - currentAlt) * (total > 0.0 ? distance[i] / total : 0.0);
+        path.push_back(turn);
+    }
+    if (route.size() > 1) {
+        path.push_back({targetLat, targetLon, targetAlt});
+    }
+
+    LOGI("Path of %zu waypoints, cost %.0f m, planned at level %d", path.size(), pathCost, level);
     return true;
 }
 
-} // namespace pixhawk
\ No newline at end of file
+// A* between two points on the cost map cells of 'level' covering the
+// given box
+bool NavigationEngine::planLeg(int level, double west, double south, double east, double north,
+                               double fromEast, double fromNorth, double toEast, double toNorth,
+                               std::vector<RoutePoint>& out) {
+    out.clear();
+    const GridCell origin = costMap.toCell(level, west, south);
+    const GridCell corner = costMap.toCell(level, east, north);
+    const int width = corner.x - origin.x + 1;
+    const int height = corner.y - origin.y + 1;
+    gridCosts.resize(static_cast<size_t>(width) * static_cast<size_t>(height));
+    costMap.rasterize(level, origin.x, origin.y, width, height, gridCosts.data());
+
+    // The vehicle is already in its cell
+    const GridCell from = costMap.toCell(level, fromEast, fromNorth);
+    const GridCell to = costMap.toCell(level, toEast, toNorth);
+    const GridCell start{from.x - origin.x, from.y - origin.y};
+    const GridCell goal{to.x - origin.x, to.y - origin.y};
+    float& startCost = gridCosts[static_cast<size_t>(start.y) * static_cast<size_t>(width) + static_cast<size_t>(start.x)];
+    if (!isPassable(startCost)) startCost = 1.0f;
+
+    const CostGrid grid{gridCosts.data(), width, height, 1.0f};
+    if (!planner.findPath(grid, start, goal, cellPath)) return false;
+    toRoute(level, origin, gridCosts.data(), width, fromEast, fromNorth, toEast, toNorth, out);
+    return true;
+}
+
+// D* Lite over the trip window. The search carries over while the level
+// and destination cell are unchanged and the vehicle is still inside the
+// window, so a replan only repairs what moved or changed; otherwise the
+// window is rasterized and searched from scratch.
+bool NavigationEngine::planTrip(int level, double west, double south, double east, double north,
+                                double fromEast, double fromNorth, double toEast, double toNorth,
+                                std::vector<RoutePoint>& out) {
+    out.clear();
+    const GridCell from = costMap.toCell(level, fromEast, fromNorth);
+    const GridCell to = costMap.toCell(level, toEast, toNorth);
+    GridCell start{from.x - tripOrigin.x, from.y - tripOrigin.y};
+    const bool reuse = level == tripLevel &&
+                       to.x - tripOrigin.x == tripGoal.x && to.y - tripOrigin.y == tripGoal.y &&
+                       start.x >= 0 && start.y >= 0 &&
+                       start.x < tripPlanner.getWidth() && start.y < tripPlanner.getHeight();
+
+    if (reuse) {
+        if (start.x != tripStart.x || start.y != tripStart.y) {
+            tripPlanner.moveStart(start);
+            // Only the vehicle's own cell is forced open
+            cellChanges.clear();
+            if (tripStartOpened && (tripStart.x != tripGoal.x || tripStart.y != tripGoal.y)) {
+                cellChanges.push_back({tripStart, costMap.getCost(level, tripStart.x + tripOrigin.x, tripStart.y + tripOrigin.y)});
+            }
+            const size_t at = static_cast<size_t>(start.y) * static_cast<size_t>(tripPlanner.getWidth()) + static_cast<size_t>(start.x);
+            tripStartOpened = !isPassable(tripPlanner.getCosts()[at]);
+            if (tripStartOpened) cellChanges.push_back({start, 1.0f});
+            tripPlanner.updateCells(cellChanges);
+            tripStart = start;
+        }
+    } else {
+        tripOrigin = costMap.toCell(level, west, south);
+        const GridCell corner = costMap.toCell(level, east, north);
+        const int width = corner.x - tripOrigin.x + 1;
+        const int height = corner.y - tripOrigin.y + 1;
+        gridCosts.resize(static_cast<size_t>(width) * static_cast<size_t>(height));
+        costMap.rasterize(level, tripOrigin.x, tripOrigin.y, width, height, gridCosts.data());
+
+        // The vehicle is already in its cell, and a coarse cell can be
+        // blocked by a zone that only grazes it
+        start = {from.x - tripOrigin.x, from.y - tripOrigin.y};
+        const GridCell goal{to.x - tripOrigin.x, to.y - tripOrigin.y};
+        float& startCost = gridCosts[static_cast<size_t>(start.y) * static_cast<size_t>(width) + static_cast<size_t>(start.x)];
+        float& goalCost = gridCosts[static_cast<size_t>(goal.y) * static_cast<size_t>(width) + static_cast<size_t>(goal.x)];
+        tripStartOpened = !isPassable(startCost);
+        if (tripStartOpened) startCost = 1.0f;
+        if (level > 0 && !isPassable(goalCost)) goalCost = 1.0f;
+
+        tripPlanner.initialize({gridCosts.data(), width, height, 1.0f}, start, goal);
+        tripLevel = level;
+        tripStart = start;
+        tripGoal = goal;
+    }
+
+    if (!tripPlanner.findPath(cellPath)) return false;
+    LOGI("Trip search expanded %zu cells%s", tripPlanner.getExpandedCount(), reuse ? " repairing" : "");
+    toRoute(level, tripOrigin, tripPlanner.getCosts().data(), tripPlanner.getWidth(),
+            fromEast, fromNorth, toEast, toNorth, out);
+    return true;
+}
+
+// Hands the trip search the cells of its window inside a changed box of
+// the plane, keeping its endpoints open as they were set up
+void NavigationEngine::updateTrip(double west, double south, double east, double north) {
+    if (tripLevel < 0) return;
+    const GridCell from = costMap.toCell(tripLevel, west, south);
+    const GridCell to = costMap.toCell(tripLevel, east, north);
+    const int x0 = std::max(from.x - tripOrigin.x, 0);
+    const int y0 = std::max(from.y - tripOrigin.y, 0);
+    const int x1 = std::min(to.x - tripOrigin.x, tripPlanner.getWidth() - 1);
+    const int y1 = std::min(to.y - tripOrigin.y, tripPlanner.getHeight() - 1);
+    if (x1 < x0 || y1 < y0) return;
+
+    const int width = x1 - x0 + 1;
+    const int height = y1 - y0 + 1;
+    gridCosts.resize(static_cast<size_t>(width) * static_cast<size_t>(height));
+    costMap.rasterize(tripLevel, tripOrigin.x + x0, tripOrigin.y + y0, width, height, gridCosts.data());
+
+    const std::vector<float>& costs = tripPlanner.getCosts();
+    const size_t stride = static_cast<size_t>(tripPlanner.getWidth());
+    cellChanges.clear();
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            const GridCell cell{x0 + x, y0 + y};
+            const float cost = gridCosts[static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x)];
+            if (cell.x == tripStart.x && cell.y == tripStart.y) {
+                tripStartOpened = !isPassable(cost);
+                if (tripStartOpened) continue;
+            } else if (tripLevel > 0 && cell.x == tripGoal.x && cell.y == tripGoal.y && !isPassable(cost)) {
+                continue;
+            }
+            if (cost != costs[static_cast<size_t>(cell.y) * stride + static_cast<size_t>(cell.x)]) {
+                cellChanges.push_back({cell, cost});
+            }
+        }
+    }
+    tripPlanner.updateCells(cellChanges);
+    LOGI("Trip search given %zu changed cells", cellChanges.size());
+}
+
+// Route along cellPath, from cell center to cell center, with the exact
+// endpoints as its first and last points
+void NavigationEngine::toRoute(int level, GridCell origin, const float* costs, int width,
+                               double fromEast, double fromNorth, double toEast, double toNorth,
+                               std::vector<RoutePoint>& out) const {
+    const double size = costMap.getCellSize(level);
+    double cost = 0.0;
+    out.push_back({fromEast, fromNorth, 0.0});
+    for (size_t i = 1; i < cellPath.size(); i++) {
+        const GridCell& prev = cellPath[i - 1];
+        const GridCell& cell = cellPath[i];
+        const double step = (prev.x != cell.x && prev.y != cell.y) ? M_SQRT2 : 1.0;
+        cost += step * size * costs[static_cast<size_t>(cell.y) * static_cast<size_t>(width) + static_cast<size_t>(cell.x)];
+        double e, n;
+        costMap.cellCenter(level, {cell.x + origin.x, cell.y + origin.y}, e, n);
+        out.push_back({e, n, cost});
+    }
+    if (cellPath.size() > 1) {
+        out.back().east = toEast;
+        out.back().north = toNorth;
+    } else {
+        out.push_back({toEast, toNorth, 0.0});
+    }
+}
+
+std::vector<Waypoint> NavigationEngine::getPath() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return path;
+}
+
+double NavigationEngine::getPathCost() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return pathCost;
+}
+
+} // namespace pixhawk
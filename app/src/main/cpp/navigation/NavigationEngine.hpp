@@ -1,24 +1,104 @@
 #pragma once
+#include <mutex>
+#include <vector>
+#include "AStar.hpp"
+#include "CostMap.hpp"
+#include "DStarLite.hpp"
 
 namespace pixhawk {
 
+struct Waypoint {
+    double lat;
+    double lon;
+    double alt;
+};
+
 class NavigationEngine {
 public:
     NavigationEngine();
     ~NavigationEngine();
-    
+
     bool initialize();
+    // Terrain for the cost map; may be null
+    void setElevationSource(const ElevationLookup* elevation);
+    CostMap& getCostMap() { return costMap; }
+    // No-fly zones on the cost map; the trip search kept from the last
+    // plan is repaired over the cells a zone covers instead of redone
+    int addNoFlyZone(const std::vector<double>& lat, const std::vector<double>& lon);
+    bool removeNoFlyZone(int id);
+    // Drops cached costs and search state, e.g. after the terrain changed
+    void invalidateCosts();
     void setDestination(double lat, double lon, double alt);
+    void setCurrentPosition(double lat, double lon, double alt);
     void getCurrentPosition(double& lat, double& lon, double& alt);
+
+    // Plans from the current position to the destination and replaces the
+    // path: over the whole trip on the finest cost map level that fits one
+    // grid, then again at full resolution near the vehicle. The trip search
+    // carries over to the next call while the destination and grid stay the
+    // same. Returns false, leaving the path empty, if there is no route.
     bool calculatePath();
-    
+    // Turn points of the last path, start and destination included
+    std::vector<Waypoint> getPath() const;
+    // Cost-weighted length of the last path in meters
+    double getPathCost() const;
+
 private:
+    struct RoutePoint {
+        double east;
+        double north;
+        double cost;        // cost-weighted distance from the start of its leg
+    };
+
+    // The trip's grid spans the start/destination box plus a margin, at
+    // most MAX_GRID_CELLS per side; the refined leg uses a FINE_GRID_CELLS
+    // grid around the vehicle
+    static constexpr int MAX_GRID_CELLS = 1024;
+    static constexpr int FINE_GRID_CELLS = 512;
+    static constexpr int FINE_EDGE_CELLS = 16;
+    static constexpr double MARGIN_FRACTION = 0.25;
+    static constexpr double MIN_MARGIN_METERS = 200.0;
+    // The cost map's plane is moved to the vehicle beyond this distance
+    static constexpr double REORIGIN_METERS = 20000.0;
+
+    mutable std::mutex mutex;
     double currentLat = 0.0;
-    double currentLon = 0.0; 
+    double currentLon = 0.0;
     double currentAlt = 0.0;
     double targetLat = 0.0;
     double targetLon = 0.0;
     double targetAlt = 0.0;
+
+    // Planner state, reused between calls
+    CostMap costMap;
+    bool originSet = false;
+    AStar planner;
+    // Incremental trip search over the window of cells from tripOrigin;
+    // tripLevel is -1 while there is none
+    DStarLite tripPlanner;
+    int tripLevel = -1;
+    GridCell tripOrigin{0, 0};
+    GridCell tripStart{0, 0};       // window cells
+    GridCell tripGoal{0, 0};
+    bool tripStartOpened = false;
+    std::vector<float> gridCosts;
+    std::vector<CellChange> cellChanges;
+    std::vector<GridCell> cellPath;
+    std::vector<RoutePoint> route;
+    std::vector<RoutePoint> fineRoute;
+    std::vector<Waypoint> path;
+    double pathCost = 0.0;
+
+    bool planLeg(int level, double west, double south, double east, double north,
+                 double fromEast, double fromNorth, double toEast, double toNorth,
+                 std::vector<RoutePoint>& out);
+    bool planTrip(int level, double west, double south, double east, double north,
+                  double fromEast, double fromNorth, double toEast, double toNorth,
+                  std::vector<RoutePoint>& out);
+    void updateTrip(double west, double south, double east, double north);
+    void toRoute(int level, GridCell origin, const float* costs, int width,
+                 double fromEast, double fromNorth, double toEast, double toNorth,
+                 std::vector<RoutePoint>& out) const;
 };
 
-} // namespace pixhawk
\ No newline at end of file
+} // namespace pixhawk
@@ -0,0 +1,368 @@
+#include "RouteOptimizer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include "Geodesy.hpp"
+#include "Philox.hpp"
+
+#ifdef PIXHAWKCORE_VERBOSE
+#include <android/log.h>
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, "RouteOptimizer", __VA_ARGS__)
+#else
+#define LOGI(...)
+#endif
+
+namespace pixhawk {
+
+namespace {
+
+// Counter word 3 for the restarts' draws
+constexpr uint32_t RESTART_STREAM = 0x20000u;
+// A move has to save more than this (meters), so float rounding in the
+// distance matrix cannot make the search cycle
+constexpr double MIN_GAIN = 1e-3;
+// Randomized seeds pick among this many nearest unvisited points
+constexpr size_t SEED_CHOICES = 3;
+constexpr size_t MAX_SEGMENT = 3;
+
+// Sequential uniform draws from the Philox stream of one restart
+class RandomStream {
+public:
+    RandomStream(uint64_t seed, size_t restart)
+        : key(Philox4x32::makeKey(seed)), restart(static_cast<uint32_t>(restart)) {}
+
+    // Uniform in [0, n)
+    size_t below(size_t n) {
+        if (used == block.size()) {
+            block = Philox4x32::generate({static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32),
+                                          restart, RESTART_STREAM}, key);
+            counter++;
+            used = 0;
+        }
+        const size_t value = static_cast<size_t>(Philox4x32::toUniform(block[used++]) * static_cast<double>(n));
+        return std::min(value, n - 1);
+    }
+
+private:
+    Philox4x32::Key key;
+    uint32_t restart;
+    uint64_t counter = 0;
+    Philox4x32::Block block{};
+    size_t used = 4;
+};
+
+// One restart's tour. Positions below 'fixed' never move: the first
+// waypoint of a closed route, or the free end point of an open one,
+// followed by the first waypoint if that is where it starts. Moves scan
+// each point's nearest neighbors only, as in most 2-opt codes.
+class LocalSearch {
+public:
+    LocalSearch(const float* distances, const uint32_t* neighbors, size_t neighborCount, size_t nodeCount, size_t waypointCount)
+        : distances(distances), neighbors(neighbors), neighborCount(neighborCount), nodeCount(nodeCount),
+          waypointCount(waypointCount), tour(nodeCount), position(nodeCount) {}
+
+    const std::vector<uint32_t>& getTour() const { return tour; }
+
+    void seed(const std::vector<uint32_t>& prefix, RandomStream* random) {
+        fixed = prefix.size();
+        std::vector<bool> visited(nodeCount, false);
+        for (size_t i = 0; i < fixed; i++) {
+            tour[i] = prefix[i];
+            visited[prefix[i]] = true;
+        }
+        for (size_t i = fixed; i < nodeCount; i++) {
+            // The nearest few unvisited points, nearest first
+            const uint32_t from = tour[i - 1];
+            uint32_t choice[SEED_CHOICES];
+            size_t found = 0;
+            for (uint32_t c = 0; c < nodeCount; c++) {
+                if (visited[c]) continue;
+                size_t k = std::min(found, SEED_CHOICES - 1);
+                if (found == SEED_CHOICES && distance(from, c) >= distance(from, choice[k])) continue;
+                while (k > 0 && distance(from, c) < distance(from, choice[k - 1])) {
+                    choice[k] = choice[k - 1];
+                    k--;
+                }
+                choice[k] = c;
+                found = std::min(found + 1, SEED_CHOICES);
+            }
+            tour[i] = choice[random ? random->below(found) : 0];
+            visited[tour[i]] = true;
+        }
+        updatePositions(0, nodeCount);
+    }
+
+    void assign(const std::vector<uint32_t>& other) {
+        tour = other;
+        updatePositions(0, nodeCount);
+    }
+
+    double cost() const {
+        double sum = 0.0;
+        for (size_t i = 0; i < nodeCount; i++) {
+            sum += distance(tour[i], tour[(i + 1) % nodeCount]);
+        }
+        return sum;
+    }
+
+    void improve() {
+        for (;;) {
+            const bool reversed = twoOpt();
+            const bool moved = orOpt();
+            if (!reversed && !moved) break;
+        }
+    }
+
+    // Double bridge: cuts the movable part into A B C D and joins it as
+    // A C B D, a change 2-opt and Or-opt cannot undo in one move
+    void kick(RandomStream& random) {
+        const size_t movable = nodeCount - fixed;
+        if (movable < 4) return;
+        size_t cut[3];
+        do {
+            for (size_t& c : cut) c = fixed + 1 + random.below(movable - 1);
+            std::sort(cut, cut + 3);
+        } while (cut[0] == cut[1] || cut[1] == cut[2]);
+        std::rotate(tour.begin() + static_cast<std::ptrdiff_t>(cut[0]), tour.begin() + static_cast<std::ptrdiff_t>(cut[1]),
+                    tour.begin() + static_cast<std::ptrdiff_t>(cut[2]));
+        updatePositions(cut[0], cut[2]);
+    }
+
+private:
+    const float* distances;
+    const uint32_t* neighbors;
+    const size_t neighborCount;
+    const size_t nodeCount;
+    const size_t waypointCount;
+    size_t fixed = 1;
+    std::vector<uint32_t> tour;
+    std::vector<uint32_t> position;
+
+    double distance(uint32_t a, uint32_t b) const {
+        return distances[static_cast<size_t>(a) * nodeCount + b];
+    }
+    uint32_t at(size_t i) const { return tour[i % nodeCount]; }
+
+    void updatePositions(size_t from, size_t to) {
+        for (size_t i = from; i < to; i++) position[tour[i]] = static_cast<uint32_t>(i);
+    }
+
+    // Replaces edges (x, x + 1) and (y, y + 1) with (x, y) and (x + 1, y + 1)
+    // by reversing x + 1 .. y, if that saves enough
+    bool tryTwoOpt(size_t x, size_t y) {
+        if (x + 1 < fixed || x + 1 >= y || y >= nodeCount) return false;
+        const double delta = distance(at(x), at(y)) + distance(at(x + 1), at(y + 1)) -
+                             distance(at(x), at(x + 1)) - distance(at(y), at(y + 1));
+        if (delta > -MIN_GAIN) return false;
+        std::reverse(tour.begin() + static_cast<std::ptrdiff_t>(x + 1), tour.begin() + static_cast<std::ptrdiff_t>(y + 1));
+        updatePositions(x + 1, y + 1);
+        return true;
+    }
+
+    // New edges from each point to a nearer neighbor, replacing the edge to
+    // its successor or to its predecessor
+    bool twoOpt() {
+        bool improved = false;
+        for (size_t i = 0; i < nodeCount; i++) {
+            const uint32_t a = tour[i];
+            if (a >= waypointCount) continue;
+            const double toNext = distance(a, at(i + 1));
+            const double toPrev = distance(at(i + nodeCount - 1), a);
+            const uint32_t* near = neighbors + static_cast<size_t>(a) * neighborCount;
+            for (size_t k = 0; k < neighborCount; k++) {
+                const double toNear = distance(a, near[k]);
+                if (toNear >= toNext && toNear >= toPrev) break;
+                const size_t j = position[near[k]];
+                const size_t lo = std::min(i, j);
+                const size_t hi = std::max(i, j);
+                if ((toNear < toNext && tryTwoOpt(lo, hi)) || (toNear < toPrev && lo > 0 && tryTwoOpt(lo - 1, hi - 1))) {
+                    improved = true;
+                    break;
+                }
+            }
+        }
+        return improved;
+    }
+
+    // Moves segment [i, i + length) between positions e and e + 1, reversed
+    // or not
+    void moveSegment(size_t i, size_t length, size_t e, bool reversed) {
+        auto begin = tour.begin();
+        if (reversed) {
+            std::reverse(begin + static_cast<std::ptrdiff_t>(i), begin + static_cast<std::ptrdiff_t>(i + length));
+        }
+        if (e >= i + length) {
+            std::rotate(begin + static_cast<std::ptrdiff_t>(i), begin + static_cast<std::ptrdiff_t>(i + length),
+                        begin + static_cast<std::ptrdiff_t>(e + 1));
+            updatePositions(i, e + 1);
+        } else {
+            std::rotate(begin + static_cast<std::ptrdiff_t>(e + 1), begin + static_cast<std::ptrdiff_t>(i),
+                        begin + static_cast<std::ptrdiff_t>(i + length));
+            updatePositions(e + 1, i + length);
+        }
+    }
+
+    // Segments of up to MAX_SEGMENT points moved next to a neighbor of one
+    // of their ends
+    bool orOpt() {
+        bool improved = false;
+        for (size_t length = 1; length <= MAX_SEGMENT; length++) {
+            for (size_t i = fixed; i + length <= nodeCount; i++) {
+                const uint32_t first = tour[i];
+                const uint32_t last = tour[i + length - 1];
+                const uint32_t prev = tour[i - 1];
+                const uint32_t next = at(i + length);
+                const double removed = distance(prev, first) + distance(last, next) - distance(prev, next);
+                if (removed <= MIN_GAIN) continue;
+
+                bool moved = false;
+                for (const uint32_t end : {first, last}) {
+                    const uint32_t* near = neighbors + static_cast<size_t>(end) * neighborCount;
+                    for (size_t k = 0; k < neighborCount && !moved; k++) {
+                        if (distance(end, near[k]) >= removed) break;
+                        const size_t p = position[near[k]];
+                        if (p >= i && p < i + length) continue;
+                        for (const size_t e : {p, p - 1}) {
+                            // p - 1 wraps past zero to an invalid position
+                            if (e + 1 < fixed || e >= nodeCount || (e + 1 >= i && e < i + length)) continue;
+                            const uint32_t u = tour[e];
+                            const uint32_t v = at(e + 1);
+                            const double forward = distance(u, first) + distance(last, v);
+                            const double backward = distance(u, last) + distance(first, v);
+                            const double delta = std::min(forward, backward) - distance(u, v) - removed;
+                            if (delta < -MIN_GAIN) {
+                                moveSegment(i, length, e, backward < forward);
+                                moved = true;
+                                break;
+                            }
+                        }
+                    }
+                    if (moved) break;
+                }
+                improved |= moved;
+            }
+        }
+        return improved;
+    }
+};
+
+struct RestartResult {
+    std::vector<uint32_t> tour;
+    double cost = 0.0;
+};
+
+} // namespace
+
+RouteOptimizer::RouteOptimizer(ThreadPool& pool) : pool(pool) {}
+
+RouteOptimizer::~RouteOptimizer() = default;
+
+bool RouteOptimizer::optimize(const std::vector<Waypoint>& waypoints, const RouteOptions& options, RouteResult& result) {
+    const size_t count = waypoints.size();
+    if (count == 0 || count > MAX_WAYPOINTS) return false;
+
+    result.order.assign(1, 0);
+    result.cost = 0.0;
+    result.initialCost = 0.0;
+    if (count == 1) return true;
+
+    const bool open = !options.closed;
+    buildMatrix(waypoints, open, options.climbWeight);
+
+    // The free end point of an open route is node 'count'
+    std::vector<uint32_t> prefix;
+    if (open) prefix.push_back(static_cast<uint32_t>(count));
+    if (!open || options.fixedStart) prefix.push_back(0);
+
+    const size_t restarts = std::max<size_t>(options.restarts, 1);
+    std::vector<RestartResult> restartResults(restarts);
+    std::vector<uint32_t> seedTour;
+    pool.parallelFor(restarts, [&](size_t r) {
+        LocalSearch search(distances.data(), neighbors.data(), neighborCount, nodeCount, count);
+        RandomStream random(options.seed, r);
+        // The first restart starts from the plain nearest-neighbor order
+        search.seed(prefix, r == 0 ? nullptr : &random);
+        if (r == 0) seedTour = search.getTour();
+        search.improve();
+
+        RestartResult& best = restartResults[r];
+        best.tour = search.getTour();
+        best.cost = search.cost();
+        for (size_t k = 0; k < options.perturbations; k++) {
+            search.assign(best.tour);
+            search.kick(random);
+            search.improve();
+            const double cost = search.cost();
+            if (cost < best.cost - MIN_GAIN) {
+                best.tour = search.getTour();
+                best.cost = cost;
+            }
+        }
+    });
+
+    size_t chosen = 0;
+    for (size_t r = 1; r < restarts; r++) {
+        if (restartResults[r].cost < restartResults[chosen].cost) chosen = r;
+    }
+
+    // Costs are summed again from the coordinates, not the float matrix
+    auto toOrder = [&](const std::vector<uint32_t>& tour, std::vector<size_t>& order) {
+        order.clear();
+        for (const uint32_t node : tour) {
+            if (node < count) order.push_back(node);
+        }
+        double cost = 0.0;
+        for (size_t i = 1; i < order.size(); i++) {
+            cost += legCost(order[i - 1], order[i], waypoints, options.climbWeight);
+        }
+        if (options.closed) cost += legCost(order.back(), order.front(), waypoints, options.climbWeight);
+        return cost;
+    };
+    std::vector<size_t> seedOrder;
+    result.initialCost = toOrder(seedTour, seedOrder);
+    result.cost = toOrder(restartResults[chosen].tour, result.order);
+
+    LOGI("Ordered %zu waypoints: %.0f m, %.0f m nearest-neighbor", count, result.cost, result.initialCost);
+    return true;
+}
+
+double RouteOptimizer::legCost(size_t a, size_t b, const std::vector<Waypoint>& waypoints, double climbWeight) const {
+    const double de = east[b] - east[a];
+    const double dn = north[b] - north[a];
+    const double du = up[b] - up[a];
+    return std::sqrt(de * de + dn * dn + du * du) + climbWeight * std::fabs(waypoints[b].alt - waypoints[a].alt);
+}
+
+void RouteOptimizer::buildMatrix(const std::vector<Waypoint>& waypoints, bool open, double climbWeight) {
+    const size_t count = waypoints.size();
+    nodeCount = count + (open ? 1 : 0);
+    neighborCount = std::min(NEIGHBOR_COUNT, count - 1);
+
+    const LocalFrame frame(waypoints[0].lat, waypoints[0].lon, waypoints[0].alt);
+    east.resize(count);
+    north.resize(count);
+    up.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        frame.toLocal(waypoints[i].lat, waypoints[i].lon, waypoints[i].alt, east[i], north[i], up[i]);
+    }
+
+    // The free end point's row and column stay zero
+    distances.assign(nodeCount * nodeCount, 0.0f);
+    neighbors.resize(count * neighborCount);
+    pool.parallelFor(count, [&](size_t i) {
+        float* row = distances.data() + i * nodeCount;
+        for (size_t j = 0; j < count; j++) {
+            row[j] = static_cast<float>(legCost(i, j, waypoints, climbWeight));
+        }
+
+        std::vector<uint32_t> order(count);
+        std::iota(order.begin(), order.end(), 0u);
+        std::swap(order[i], order.back());
+        const auto nearest = order.begin() + static_cast<std::ptrdiff_t>(neighborCount);
+        std::partial_sort(order.begin(), nearest, order.end() - 1,
+                          [row](uint32_t a, uint32_t b) { return row[a] < row[b]; });
+        std::copy(order.begin(), nearest, neighbors.begin() + static_cast<std::ptrdiff_t>(i * neighborCount));
+    });
+}
+
+} // namespace pixhawk
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "NavigationEngine.hpp"
+#include "ThreadPool.hpp"
+
+namespace pixhawk {
+
+struct RouteOptions {
+    bool closed = false;            // return to the first waypoint at the end
+    bool fixedStart = true;         // an open route begins at the first waypoint
+    double climbWeight = 0.0;       // extra cost per meter of altitude change, in meters flown
+    size_t restarts = 8;
+    size_t perturbations = 200;     // random kicks tried per restart
+    uint64_t seed = 1;
+};
+
+struct RouteResult {
+    std::vector<size_t> order;      // waypoint indices in visiting order
+    double cost = 0.0;              // meters, the closing leg included on a closed route
+    double initialCost = 0.0;       // of the nearest-neighbor order
+};
+
+// Orders mission waypoints for the least total flight cost: straight-line
+// distance between them, plus climbWeight per meter climbed or descended.
+// Each restart builds a nearest-neighbor order, improves it with 2-opt and
+// Or-opt moves over each point's nearest neighbors until neither helps,
+// then keeps trying random double-bridge kicks followed by the same local
+// search. Restarts run across the pool from their own random streams, so
+// the result does not depend on the thread count.
+class RouteOptimizer {
+public:
+    static constexpr size_t MAX_WAYPOINTS = 4096;
+
+    explicit RouteOptimizer(ThreadPool& pool);
+    ~RouteOptimizer();
+
+    // False if there are no waypoints or more than MAX_WAYPOINTS
+    bool optimize(const std::vector<Waypoint>& waypoints, const RouteOptions& options, RouteResult& result);
+
+private:
+    static constexpr size_t NEIGHBOR_COUNT = 10;
+
+    ThreadPool& pool;
+
+    // Over the waypoints plus, on an open route, a free end point whose
+    // legs cost nothing; reused between calls
+    size_t nodeCount = 0;
+    std::vector<double> east;
+    std::vector<double> north;
+    std::vector<double> up;
+    std::vector<float> distances;           // nodeCount x nodeCount, row-major
+    std::vector<uint32_t> neighbors;        // nearest waypoints of each waypoint
+    size_t neighborCount = 0;               // per waypoint, at most NEIGHBOR_COUNT
+
+    double legCost(size_t a, size_t b, const std::vector<Waypoint>& waypoints, double climbWeight) const;
+    void buildMatrix(const std::vector<Waypoint>& waypoints, bool open, double climbWeight);
+};
+
+} // namespace pixhawk
@@ -0,0 +1,210 @@
+#include "AttitudeMonteCarlo.hpp"
+#include <algorithm>
+#include <cmath>
+#include "EkfAttitude.hpp"
+#include "Philox.hpp"
+
+namespace pixhawk {
+
+namespace {
+
+constexpr double GRAVITY = 9.80665;
+constexpr double TWO_PI = 6.283185307179586;
+constexpr double MIN_RATE_FREQ = 0.02;  // Hz
+constexpr double MAX_RATE_FREQ = 0.5;   // Hz
+
+// World-frame field used for the simulated magnetometer (x along the
+// horizontal field, z up, roughly 60 degrees inclination)
+constexpr double MAG_WORLD_X = 0.25;
+constexpr double MAG_WORLD_Z = -0.43;
+
+// Counter word 2 for the campaign's own draws, distinct from SensorSim's
+constexpr uint32_t TRAJECTORY_STREAM = 0x10000u;
+
+struct Trajectory {
+    double amplitude[3];
+    double omega[3];        // rad/s
+    double phase[3];
+    double roll0, pitch0, yaw0;
+    uint64_t sensorSeed;
+
+    void rates(double t, double (&w)[3]) const {
+        for (int axis = 0; axis < 3; axis++) {
+            w[axis] = amplitude[axis] * std::sin(omega[axis] * t + phase[axis]);
+        }
+    }
+};
+
+Philox4x32::Block runBits(const MonteCarloConfig& config, size_t index, uint32_t block) {
+    const uint64_t run = index;
+    return Philox4x32::generate({static_cast<uint32_t>(run), static_cast<uint32_t>(run >> 32), TRAJECTORY_STREAM, block},
+                                Philox4x32::makeKey(config.seed));
+}
+
+Trajectory makeTrajectory(const MonteCarloConfig& config, size_t index) {
+    double u[12];
+    for (uint32_t block = 0; block < 3; block++) {
+        const Philox4x32::Block bits = runBits(config, index, block);
+        for (size_t i = 0; i < 4; i++) {
+            u[4 * block + i] = Philox4x32::toUniform(bits[i]);
+        }
+    }
+
+    Trajectory traj;
+    for (int axis = 0; axis < 3; axis++) {
+        traj.amplitude[axis] = config.maxRate * u[axis];
+        traj.omega[axis] = TWO_PI * (MIN_RATE_FREQ + (MAX_RATE_FREQ - MIN_RATE_FREQ) * u[3 + axis]);
+        traj.phase[axis] = TWO_PI * u[6 + axis];
+    }
+    traj.roll0 = config.initialAttitudeRange * (2.0 * u[9] - 1.0);
+    traj.pitch0 = config.initialAttitudeRange * (2.0 * u[10] - 1.0);
+    traj.yaw0 = config.initialAttitudeRange * (2.0 * u[11] - 1.0);
+
+    const Philox4x32::Block seedBits = runBits(config, index, 3);
+    traj.sensorSeed = (static_cast<uint64_t>(seedBits[0]) << 32) | seedBits[1];
+    return traj;
+}
+
+// Angle of the rotation between two attitudes
+double attitudeError(const MathQuat& estimate, const MathQuat& truth) {
+    const MathQuat d = estimate.conjugate() * truth;
+    const double v = std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+    return 2.0 * std::atan2(v, std::abs(d.w));
+}
+
+// Nearest-rank percentile of sorted values
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    const double rank = std::ceil(p * static_cast<double>(sorted.size()));
+    const size_t index = static_cast<size_t>(std::max(rank, 1.0)) - 1;
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+} // namespace
+
+AttitudeMonteCarlo::AttitudeMonteCarlo(ThreadPool& pool) : pool(pool) {}
+
+AttitudeMonteCarlo::~AttitudeMonteCarlo() = default;
+
+MonteCarloResult AttitudeMonteCarlo::run(const MonteCarloConfig& config) {
+    MonteCarloResult result;
+    result.runs = config.runs;
+    result.perRun.resize(config.runs);
+
+    pool.parallelFor(config.runs, [&](size_t i) {
+        result.perRun[i] = runSingle(config, i);
+    });
+
+    std::vector<double> rms;
+    rms.reserve(config.runs);
+    double sumSquares = 0.0;
+    for (const MonteCarloRun& r : result.perRun) {
+        if (r.diverged) {
+            result.divergedRuns++;
+            continue;
+        }
+        rms.push_back(r.rmsError);
+        sumSquares += r.rmsError * r.rmsError;
+        result.maxError = std::max(result.maxError, r.maxError);
+    }
+
+    if (!rms.empty()) {
+        std::sort(rms.begin(), rms.end());
+        result.rmsError = std::sqrt(sumSquares / static_cast<double>(rms.size()));
+        result.p50 = percentile(rms, 0.50);
+        result.p90 = percentile(rms, 0.90);
+        result.p95 = percentile(rms, 0.95);
+        result.p99 = percentile(rms, 0.99);
+    }
+    return result;
+}
+
+MonteCarloRun AttitudeMonteCarlo::runSingle(const MonteCarloConfig& config, size_t index) {
+    const Trajectory traj = makeTrajectory(config, index);
+
+    SensorSimConfig simConfig;
+    simConfig.sampleRate = config.sampleRate;
+    simConfig.seed = traj.sensorSeed;
+    simConfig.accel = config.accel;
+    simConfig.gyro = config.gyro;
+    simConfig.mag = config.mag;
+    const SensorSim sim(simConfig);
+
+    EkfAttitude ekf;
+    ekf.setNoise(config.gyroNoise, config.accelNoise, config.magNoise);
+    ekf.setGyroBiasNoise(config.gyroBiasNoise);
+
+    const double dt = 1.0 / config.sampleRate;
+    const uint64_t totalSamples = static_cast<uint64_t>(config.duration * config.sampleRate);
+    const uint64_t settleSamples = static_cast<uint64_t>(config.settleTime * config.sampleRate);
+    const uint64_t magDivider = static_cast<uint64_t>(std::max(config.magDivider, 1));
+
+    // Ten sensor columns plus the truth quaternion
+    std::vector<double> storage(14 * BLOCK_SAMPLES);
+    auto column = [&](size_t c) { return storage.data() + c * BLOCK_SAMPLES; };
+    const ImuSampleBuffers buffers{column(0), column(1), column(2), column(3), column(4),
+                                   column(5), column(6), column(7), column(8), column(9)};
+    double* const qw = column(10);
+    double* const qx = column(11);
+    double* const qy = column(12);
+    double* const qz = column(13);
+
+    MathQuat truth = MathQuat::fromEuler(traj.roll0, traj.pitch0, traj.yaw0);
+    MonteCarloRun run{0.0, 0.0, 0.0, false};
+    double sumSquares = 0.0;
+    uint64_t scored = 0;
+
+    for (uint64_t first = 0; first < totalSamples && !run.diverged; first += BLOCK_SAMPLES) {
+        const size_t n = static_cast<size_t>(std::min<uint64_t>(BLOCK_SAMPLES, totalSamples - first));
+
+        // Ideal readings along the truth trajectory
+        for (size_t i = 0; i < n; i++) {
+            const double t = static_cast<double>(first + i + 1) * dt;
+            double w[3];
+            traj.rates(t, w);
+            truth = truth * MathQuat::fromRotationVector(w[0] * dt, w[1] * dt, w[2] * dt);
+            truth.normalize();
+
+            const MathQuat toBody = truth.conjugate();
+            buffers.time[i] = t;
+            buffers.gx[i] = w[0];
+            buffers.gy[i] = w[1];
+            buffers.gz[i] = w[2];
+            toBody.rotate(0.0, 0.0, GRAVITY, buffers.ax[i], buffers.ay[i], buffers.az[i]);
+            toBody.rotate(MAG_WORLD_X, 0.0, MAG_WORLD_Z, buffers.mx[i], buffers.my[i], buffers.mz[i]);
+            qw[i] = truth.w;
+            qx[i] = truth.x;
+            qy[i] = truth.y;
+            qz[i] = truth.z;
+        }
+        sim.applyErrors(first, n, buffers);
+
+        for (size_t i = 0; i < n; i++) {
+            const uint64_t sample = first + i;
+            ekf.predict(dt, buffers.gx[i], buffers.gy[i], buffers.gz[i]);
+            ekf.updateAccel(buffers.ax[i], buffers.ay[i], buffers.az[i]);
+            if (sample % magDivider == 0) {
+                ekf.updateMag(buffers.mx[i], buffers.my[i], buffers.mz[i]);
+            }
+
+            const double error = attitudeError(ekf.getQuaternion(), MathQuat(qw[i], qx[i], qy[i], qz[i]));
+            run.finalError = error;
+            if (sample < settleSamples) continue;
+
+            if (!std::isfinite(error) || error > config.divergenceThreshold) {
+                run.diverged = true;
+                break;
+            }
+            sumSquares += error * error;
+            run.maxError = std::max(run.maxError, error);
+            scored++;
+        }
+    }
+
+    if (scored > 0) {
+        run.rmsError = std::sqrt(sumSquares / static_cast<double>(scored));
+    }
+    return run;
+}
+
+} // namespace pixhawk
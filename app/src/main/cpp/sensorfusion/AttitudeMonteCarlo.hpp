@@ -0,0 +1,77 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "SensorSim.hpp"
+#include "ThreadPool.hpp"
+
+namespace pixhawk {
+
+struct MonteCarloConfig {
+    size_t runs = 1000;
+    double duration = 60.0;         // s per run
+    double sampleRate = 400.0;      // Hz
+    uint64_t seed = 1;
+
+    // Randomized trajectory: per-axis sinusoidal body rates with amplitude
+    // up to maxRate, and an initial attitude within +-initialAttitudeRange
+    // on each Euler angle
+    double maxRate = 1.0;               // rad/s
+    double initialAttitudeRange = 0.5;  // rad
+
+    // Sensor errors; SensorSim draws fresh constants for every run
+    SensorErrorModel accel{0.05, 0.05, 1e-3, 1e-3, 0.0};
+    SensorErrorModel gyro{0.003, 0.01, 1e-4, 1e-3, 0.0};
+    SensorErrorModel mag{0.005, 0.0, 0.0, 0.0, 0.0};
+    int magDivider = 10;                // mag fused every Nth sample
+
+    // Filter tuning under test
+    double gyroNoise = 0.01;
+    double accelNoise = 0.1;
+    double magNoise = 0.05;
+    double gyroBiasNoise = 1e-4;
+
+    // Errors before settleTime are not scored. A run counts as diverged if
+    // its error exceeds divergenceThreshold after that or becomes non-finite.
+    double settleTime = 5.0;            // s
+    double divergenceThreshold = 0.35;  // rad
+};
+
+struct MonteCarloRun {
+    double rmsError;        // rad, total attitude error angle
+    double maxError;        // rad
+    double finalError;      // rad
+    bool diverged;
+};
+
+struct MonteCarloResult {
+    size_t runs = 0;
+    size_t divergedRuns = 0;
+    double rmsError = 0.0;  // over all scored samples of converged runs
+    double p50 = 0.0;       // percentiles of per-run RMS error, converged runs
+    double p90 = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+    double maxError = 0.0;
+    std::vector<MonteCarloRun> perRun;
+};
+
+// Runs many independent SensorSim -> EkfAttitude simulations in parallel and
+// aggregates the attitude error. Every run is seeded from the campaign seed
+// and its index, so results do not depend on the thread count.
+class AttitudeMonteCarlo {
+public:
+    explicit AttitudeMonteCarlo(ThreadPool& pool);
+    ~AttitudeMonteCarlo();
+
+    MonteCarloResult run(const MonteCarloConfig& config);
+
+    static MonteCarloRun runSingle(const MonteCarloConfig& config, size_t index);
+
+private:
+    ThreadPool& pool;
+
+    static constexpr size_t BLOCK_SAMPLES = 1024;
+};
+
+} // namespace pixhawk
@@ -0,0 +1,173 @@
+#include "AttitudeSmoother.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace pixhawk {
+
+namespace {
+
+using StateMatrix = EkfAttitude::StateMatrix;
+using StateVector = Vector<EkfAttitude::STATE_DIM>;
+
+// Filter state saved by the forward pass for one sample
+struct StepRecord {
+    MathQuat priorQ;        // after predict, before measurement updates
+    MathQuat posteriorQ;
+    Vector3 posteriorBias;
+    StateMatrix priorP;
+    StateMatrix posteriorP;
+};
+
+Vector3 readBias(const EkfAttitude& ekf) {
+    Vector3 b;
+    ekf.getGyroBias(b[0], b[1], b[2]);
+    return b;
+}
+
+void writeTrack(AttitudeTrack& track, size_t i, const MathQuat& q, const Vector3& bias, const StateMatrix& p) {
+    track.w[i] = q.w;
+    track.x[i] = q.x;
+    track.y[i] = q.y;
+    track.z[i] = q.z;
+    q.toEuler(track.roll[i], track.pitch[i], track.yaw[i]);
+    track.biasX[i] = bias[0];
+    track.biasY[i] = bias[1];
+    track.biasZ[i] = bias[2];
+    track.attitudeSigma[i] = std::sqrt(std::max(0.0, p(0, 0) + p(1, 1) + p(2, 2)));
+}
+
+bool hasMag(const ImuLog& log, size_t k) {
+    return log.mx && log.my && log.mz &&
+           std::isfinite(log.mx[k]) && std::isfinite(log.my[k]) && std::isfinite(log.mz[k]);
+}
+
+} // namespace
+
+void AttitudeTrack::resize(size_t count) {
+    for (auto* v : {&w, &x, &y, &z, &roll, &pitch, &yaw, &biasX, &biasY, &biasZ, &attitudeSigma}) {
+        v->assign(count, 0.0);
+    }
+}
+
+AttitudeSmoother::AttitudeSmoother(ThreadPool& pool) : pool(pool) {}
+
+AttitudeSmoother::~AttitudeSmoother() = default;
+
+bool AttitudeSmoother::process(const ImuLog& log, const SmootherConfig& config,
+                               AttitudeTrack& filtered, AttitudeTrack& smoothed) {
+    if (log.count == 0 || !log.time || !log.gx || !log.gy || !log.gz ||
+        !log.ax || !log.ay || !log.az) {
+        return false;
+    }
+
+    filtered.resize(log.count);
+    smoothed.resize(log.count);
+
+    const size_t segmentLength = std::max<size_t>(config.segmentLength, 1);
+    const size_t segments = (log.count + segmentLength - 1) / segmentLength;
+
+    pool.parallelFor(segments, [&](size_t s) {
+        const size_t begin = s * segmentLength;
+        const size_t end = std::min(log.count, begin + segmentLength);
+        processSegment(log, config, begin, end, filtered, smoothed);
+    });
+    return true;
+}
+
+void AttitudeSmoother::processSegment(const ImuLog& log, const SmootherConfig& config,
+                                      size_t begin, size_t end,
+                                      AttitudeTrack& filtered, AttitudeTrack& smoothed) const {
+    const size_t runStart = begin > config.overlap ? begin - config.overlap : 0;
+    const size_t runEnd = std::min(log.count, end + config.overlap);
+    const size_t n = runEnd - runStart;
+
+    EkfAttitude ekf;
+    ekf.setNoise(config.gyroNoise, config.accelNoise, config.magNoise);
+    ekf.setGyroBiasNoise(config.gyroBiasNoise);
+
+    std::vector<StepRecord> steps(n);
+
+    // Forward pass
+    for (size_t j = 0; j < n; j++) {
+        const size_t k = runStart + j;
+        if (j > 0) {
+            ekf.predict(log.time[k] - log.time[k - 1], log.gx[k], log.gy[k], log.gz[k]);
+        }
+        steps[j].priorQ = ekf.getQuaternion();
+        steps[j].priorP = ekf.getCovariance();
+
+        ekf.updateAccel(log.ax[k], log.ay[k], log.az[k]);
+        if (hasMag(log, k)) {
+            ekf.updateMag(log.mx[k], log.my[k], log.mz[k]);
+        }
+
+        steps[j].posteriorQ = ekf.getQuaternion();
+        steps[j].posteriorBias = readBias(ekf);
+        steps[j].posteriorP = ekf.getCovariance();
+
+        if (k >= begin && k < end) {
+            writeTrack(filtered, k, steps[j].posteriorQ, steps[j].posteriorBias, steps[j].posteriorP);
+        }
+    }
+
+    // Backward RTS pass over the error state
+    MathQuat smoothQ = steps[n - 1].posteriorQ;
+    Vector3 smoothBias = steps[n - 1].posteriorBias;
+    StateMatrix smoothP = steps[n - 1].posteriorP;
+    if (runEnd - 1 < end) {
+        writeTrack(smoothed, runEnd - 1, smoothQ, smoothBias, smoothP);
+    }
+
+    for (size_t j = n - 1; j-- > 0;) {
+        const size_t k = runStart + j;
+        if (k < begin) break;
+
+        const StepRecord& cur = steps[j];
+        const StepRecord& next = steps[j + 1];
+
+        StateMatrix priorInv;
+        const double dt = log.time[k + 1] - log.time[k];
+        if (dt > 0.0 && choleskyInverse(next.priorP, priorInv)) {
+            // Rebuild the transition used by the forward predict
+            Vector3 angle;
+            angle[0] = (log.gx[k + 1] - cur.posteriorBias[0]) * dt;
+            angle[1] = (log.gy[k + 1] - cur.posteriorBias[1]) * dt;
+            angle[2] = (log.gz[k + 1] - cur.posteriorBias[2]) * dt;
+            const StateMatrix f = EkfAttitude::transition(dt, angle);
+
+            const StateMatrix gain = cur.posteriorP * f.transpose() * priorInv;
+
+            // Error between the smoothed and predicted state at k+1
+            MathQuat dq = next.priorQ.conjugate() * smoothQ;
+            const double sign = dq.w < 0.0 ? -1.0 : 1.0;
+            StateVector delta;
+            delta[0] = 2.0 * sign * dq.x;
+            delta[1] = 2.0 * sign * dq.y;
+            delta[2] = 2.0 * sign * dq.z;
+            delta[3] = smoothBias[0] - cur.posteriorBias[0];
+            delta[4] = smoothBias[1] - cur.posteriorBias[1];
+            delta[5] = smoothBias[2] - cur.posteriorBias[2];
+
+            const StateVector correction = gain * delta;
+            smoothQ = cur.posteriorQ * MathQuat(1.0, 0.5 * correction[0], 0.5 * correction[1], 0.5 * correction[2]);
+            smoothQ.normalize();
+            smoothBias[0] = cur.posteriorBias[0] + correction[3];
+            smoothBias[1] = cur.posteriorBias[1] + correction[4];
+            smoothBias[2] = cur.posteriorBias[2] + correction[5];
+
+            smoothP = cur.posteriorP + sandwich(gain, smoothP - next.priorP);
+        } else {
+            // No propagation between the samples (or a degenerate prior):
+            // fall back to the filtered estimate
+            smoothQ = cur.posteriorQ;
+            smoothBias = cur.posteriorBias;
+            smoothP = cur.posteriorP;
+        }
+
+        if (k < end) {
+            writeTrack(smoothed, k, smoothQ, smoothBias, smoothP);
+        }
+    }
+}
+
+} // namespace pixhawk
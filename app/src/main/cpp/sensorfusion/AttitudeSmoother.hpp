@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "EkfAttitude.hpp"
+#include "ThreadPool.hpp"
+
+namespace pixhawk {
+
+// Recorded IMU stream in structure-of-arrays form. The mag pointers may be
+// null, and samples whose mag components are NaN skip the mag update.
+struct ImuLog {
+    const double* time;             // seconds, non-decreasing
+    const double* gx;               // rad/s
+    const double* gy;
+    const double* gz;
+    const double* ax;               // m/s^2
+    const double* ay;
+    const double* az;
+    const double* mx = nullptr;     // any consistent unit
+    const double* my = nullptr;
+    const double* mz = nullptr;
+    size_t count;
+};
+
+struct SmootherConfig {
+    double gyroNoise = 0.01;
+    double accelNoise = 0.1;
+    double magNoise = 0.05;
+    double gyroBiasNoise = 1e-4;
+
+    // Samples per parallel work item, and extra samples processed on each
+    // side of it so the filter converges before the segment starts and the
+    // smoother sees data past its end
+    size_t segmentLength = 8000;
+    size_t overlap = 2000;
+};
+
+// Per-sample attitude estimates, one entry per log sample
+struct AttitudeTrack {
+    std::vector<double> w, x, y, z;
+    std::vector<double> roll, pitch, yaw;
+    std::vector<double> biasX, biasY, biasZ;
+    std::vector<double> attitudeSigma;  // rad, sqrt of the attitude covariance trace
+
+    void resize(size_t count);
+};
+
+// Offline attitude re-estimation: runs EkfAttitude forward over a recorded
+// flight and a Rauch-Tung-Striebel pass backward over the error state. The
+// flight is cut into overlapping segments that are processed independently
+// on the thread pool.
+class AttitudeSmoother {
+public:
+    explicit AttitudeSmoother(ThreadPool& pool);
+    ~AttitudeSmoother();
+
+    // Returns false if the log is empty or missing required channels
+    bool process(const ImuLog& log, const SmootherConfig& config,
+                 AttitudeTrack& filtered, AttitudeTrack& smoothed);
+
+private:
+    ThreadPool& pool;
+
+    void processSegment(const ImuLog& log, const SmootherConfig& config,
+                        size_t begin, size_t end,
+                        AttitudeTrack& filtered, AttitudeTrack& smoothed) const;
+};
+
+} // namespace pixhawk
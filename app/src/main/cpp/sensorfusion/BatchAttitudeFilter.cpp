@@ -0,0 +1,368 @@
+#include "BatchAttitudeFilter.hpp"
+#include "SimdPack.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace pixhawk {
+
+namespace {
+
+using simd::NativePack;
+using simd::ScalarPack;
+
+// Index of element (i, j) of a packed symmetric 3x3 block
+constexpr int SYM[3][3] = {{0, 1, 2}, {1, 3, 4}, {2, 4, 5}};
+
+// One pack worth of filter state loaded from the SoA arrays
+template <typename P>
+struct LaneState {
+    P q[4];
+    P b[3];
+    P a[6];     // attitude covariance, packed symmetric
+    P c[3][3];  // attitude/bias cross covariance
+    P bb[6];    // bias covariance, packed symmetric
+
+    void load(float* const* f, int i) {
+        for (int k = 0; k < 4; k++) q[k] = P::load(f[BatchAttitudeFilter::QW + k] + i);
+        for (int k = 0; k < 3; k++) b[k] = P::load(f[BatchAttitudeFilter::BX + k] + i);
+        for (int k = 0; k < 6; k++) a[k] = P::load(f[BatchAttitudeFilter::A00 + k] + i);
+        for (int r = 0; r < 3; r++)
+            for (int k = 0; k < 3; k++) c[r][k] = P::load(f[BatchAttitudeFilter::C00 + r * 3 + k] + i);
+        for (int k = 0; k < 6; k++) bb[k] = P::load(f[BatchAttitudeFilter::B00 + k] + i);
+    }
+
+    void store(float* const* f, int i) const {
+        for (int k = 0; k < 4; k++) q[k].store(f[BatchAttitudeFilter::QW + k] + i);
+        for (int k = 0; k < 3; k++) b[k].store(f[BatchAttitudeFilter::BX + k] + i);
+        for (int k = 0; k < 6; k++) a[k].store(f[BatchAttitudeFilter::A00 + k] + i);
+        for (int r = 0; r < 3; r++)
+            for (int k = 0; k < 3; k++) c[r][k].store(f[BatchAttitudeFilter::C00 + r * 3 + k] + i);
+        for (int k = 0; k < 6; k++) bb[k].store(f[BatchAttitudeFilter::B00 + k] + i);
+    }
+
+    // q = q * exp(v), using the same series as MathQuat::fromRotationVector
+    // truncated after the second-order term, then renormalized
+    void rotateBy(const P v[3]) {
+        const P angle2 = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+        const P half = P(0.5f) - angle2 * P(1.0f / 48.0f);
+        const P hx = v[0] * half;
+        const P hy = v[1] * half;
+        const P hz = v[2] * half;
+        const P hw = P(1.0f) - angle2 * P(1.0f / 8.0f);
+
+        const P w = q[0] * hw - q[1] * hx - q[2] * hy - q[3] * hz;
+        const P x = q[0] * hx + q[1] * hw + q[2] * hz - q[3] * hy;
+        const P y = q[0] * hy - q[1] * hz + q[2] * hw + q[3] * hx;
+        const P z = q[0] * hz + q[1] * hy - q[2] * hx + q[3] * hw;
+
+        const P inv = P(1.0f) / sqrt(w * w + x * x + y * y + z * z);
+        q[0] = w * inv;
+        q[1] = x * inv;
+        q[2] = y * inv;
+        q[3] = z * inv;
+    }
+
+    // Body-to-world rotation matrix row 'r'
+    void rotationRow(int r, P out[3]) const {
+        const P w = q[0], x = q[1], y = q[2], z = q[3];
+        if (r == 0) {
+            out[0] = P(1.0f) - P(2.0f) * (y * y + z * z);
+            out[1] = P(2.0f) * (x * y - w * z);
+            out[2] = P(2.0f) * (x * z + w * y);
+        } else if (r == 1) {
+            out[0] = P(2.0f) * (x * y + w * z);
+            out[1] = P(1.0f) - P(2.0f) * (x * x + z * z);
+            out[2] = P(2.0f) * (y * z - w * x);
+        } else {
+            out[0] = P(2.0f) * (x * z - w * y);
+            out[1] = P(2.0f) * (y * z + w * x);
+            out[2] = P(1.0f) - P(2.0f) * (x * x + y * y);
+        }
+    }
+
+    // Scalar measurement update with h = [h0 h1 h2 0 0 0]. The innovation is
+    // corrected by the error already accumulated in dx so a sequence of scalar
+    // updates equals one joint update with a diagonal noise matrix.
+    void scalarUpdate(const P h[3], P innovation, P variance, typename P::Mask valid, P dx[6]) {
+        P u[3], v[3];
+        for (int i = 0; i < 3; i++) {
+            u[i] = a[SYM[i][0]] * h[0] + a[SYM[i][1]] * h[1] + a[SYM[i][2]] * h[2];
+            v[i] = c[0][i] * h[0] + c[1][i] * h[1] + c[2][i] * h[2];
+        }
+        const P s = h[0] * u[0] + h[1] * u[1] + h[2] * u[2] + variance;
+        const P invS = select(valid, P(1.0f) / s, P(0.0f));
+        const P y = innovation - (h[0] * dx[0] + h[1] * dx[1] + h[2] * dx[2]);
+        const P gain = y * invS;
+
+        for (int i = 0; i < 3; i++) {
+            dx[i] = dx[i] + u[i] * gain;
+            dx[i + 3] = dx[i + 3] + v[i] * gain;
+        }
+
+        // P -= (P h^T)(P h^T)^T / s
+        for (int i = 0; i < 3; i++) {
+            const P ui = u[i] * invS;
+            const P vi = v[i] * invS;
+            for (int j = i; j < 3; j++) {
+                a[SYM[i][j]] = a[SYM[i][j]] - ui * u[j];
+                bb[SYM[i][j]] = bb[SYM[i][j]] - vi * v[j];
+            }
+            for (int j = 0; j < 3; j++) {
+                c[i][j] = c[i][j] - ui * v[j];
+            }
+        }
+    }
+
+    void applyCorrection(const P dx[6]) {
+        rotateBy(dx);
+        for (int i = 0; i < 3; i++) {
+            b[i] = b[i] + dx[i + 3];
+        }
+    }
+};
+
+template <typename P>
+void predictLanes(float* const* f, int begin, int end, float dt, float attitudeVar, float biasVar,
+                  const float* gx, const float* gy, const float* gz) {
+    const P dtp(dt);
+    for (int i = begin; i + P::WIDTH <= end; i += P::WIDTH) {
+        LaneState<P> s;
+        s.load(f, i);
+
+        P theta[3];
+        theta[0] = (P::load(gx + i) - s.b[0]) * dtp;
+        theta[1] = (P::load(gy + i) - s.b[1]) * dtp;
+        theta[2] = (P::load(gz + i) - s.b[2]) * dtp;
+        s.rotateBy(theta);
+
+        // Phi = I - [theta x]
+        P phi[3][3];
+        phi[0][0] = P(1.0f); phi[0][1] = theta[2];  phi[0][2] = -theta[1];
+        phi[1][0] = -theta[2]; phi[1][1] = P(1.0f); phi[1][2] = theta[0];
+        phi[2][0] = theta[1];  phi[2][1] = -theta[0]; phi[2][2] = P(1.0f);
+
+        // M = Phi * C, T = Phi * A
+        P m[3][3], t[3][3];
+        for (int r = 0; r < 3; r++) {
+            for (int k = 0; k < 3; k++) {
+                m[r][k] = phi[r][0] * s.c[0][k] + phi[r][1] * s.c[1][k] + phi[r][2] * s.c[2][k];
+                t[r][k] = phi[r][0] * s.a[SYM[0][k]] + phi[r][1] * s.a[SYM[1][k]] + phi[r][2] * s.a[SYM[2][k]];
+            }
+        }
+
+        // A' = Phi A Phi^T - dt (M + M^T) + dt^2 B + Qa
+        const P dt2 = dtp * dtp;
+        for (int r = 0; r < 3; r++) {
+            for (int k = r; k < 3; k++) {
+                P value = t[r][0] * phi[k][0] + t[r][1] * phi[k][1] + t[r][2] * phi[k][2];
+                value = value - dtp * (m[r][k] + m[k][r]) + dt2 * s.bb[SYM[r][k]];
+                if (r == k) value = value + P(attitudeVar);
+                s.a[SYM[r][k]] = value;
+            }
+        }
+
+        // C' = M - dt B
+        for (int r = 0; r < 3; r++) {
+            for (int k = 0; k < 3; k++) {
+                s.c[r][k] = m[r][k] - dtp * s.bb[SYM[r][k]];
+            }
+        }
+
+        // B' = B + Qb
+        s.bb[SYM[0][0]] = s.bb[SYM[0][0]] + P(biasVar);
+        s.bb[SYM[1][1]] = s.bb[SYM[1][1]] + P(biasVar);
+        s.bb[SYM[2][2]] = s.bb[SYM[2][2]] + P(biasVar);
+
+        s.store(f, i);
+    }
+}
+
+template <typename P>
+void updateAccelLanes(float* const* f, int begin, int end, float accelNoise, float gravity,
+                      const float* ax, const float* ay, const float* az) {
+    const P sigma(accelNoise / gravity);
+    const P invGravity(1.0f / gravity);
+    for (int i = begin; i + P::WIDTH <= end; i += P::WIDTH) {
+        LaneState<P> s;
+        s.load(f, i);
+
+        const P x = P::load(ax + i);
+        const P y = P::load(ay + i);
+        const P z = P::load(az + i);
+        const P norm = sqrt(x * x + y * y + z * z);
+        const auto valid = norm > P(0.1f);
+        const P inv = P(1.0f) / max(norm, P(0.1f));
+
+        // Predicted gravity direction in the body frame
+        P g[3];
+        s.rotationRow(2, g);
+
+        const P dynamic = (norm - P(gravity)) * invGravity;
+        const P variance = sigma * sigma + dynamic * dynamic;
+
+        const P measured[3] = {x * inv, y * inv, z * inv};
+
+        // Rows of [g x]
+        const P h0[3] = {P(0.0f), -g[2], g[1]};
+        const P h1[3] = {g[2], P(0.0f), -g[0]};
+        const P h2[3] = {-g[1], g[0], P(0.0f)};
+
+        P dx[6] = {P(0.0f), P(0.0f), P(0.0f), P(0.0f), P(0.0f), P(0.0f)};
+        s.scalarUpdate(h0, measured[0] - g[0], variance, valid, dx);
+        s.scalarUpdate(h1, measured[1] - g[1], variance, valid, dx);
+        s.scalarUpdate(h2, measured[2] - g[2], variance, valid, dx);
+        s.applyCorrection(dx);
+
+        s.store(f, i);
+    }
+}
+
+template <typename P>
+void updateMagLanes(float* const* f, int begin, int end, float magNoise,
+                    const float* mx, const float* my, const float* mz) {
+    for (int i = begin; i + P::WIDTH <= end; i += P::WIDTH) {
+        LaneState<P> s;
+        s.load(f, i);
+
+        const P x = P::load(mx + i);
+        const P y = P::load(my + i);
+        const P z = P::load(mz + i);
+        const P norm = sqrt(x * x + y * y + z * z);
+        const P inv = P(1.0f) / max(norm, P(0.01f));
+
+        P r0[3], r1[3], r2[3];
+        s.rotationRow(0, r0);
+        s.rotationRow(1, r1);
+        s.rotationRow(2, r2);
+
+        // Measured field in the world frame; only its heading is used
+        const P wx = (r0[0] * x + r0[1] * y + r0[2] * z) * inv;
+        const P wy = (r1[0] * x + r1[1] * y + r1[2] * z) * inv;
+        const P horizontal = sqrt(wx * wx + wy * wy);
+        const auto valid = maskAnd(norm > P(0.01f), horizontal > P(0.1f));
+
+        const P sigma = P(magNoise) / max(horizontal, P(0.1f));
+        const P h[3] = {-r2[0], -r2[1], -r2[2]};
+
+        P dx[6] = {P(0.0f), P(0.0f), P(0.0f), P(0.0f), P(0.0f), P(0.0f)};
+        s.scalarUpdate(h, simd::atan2(wy, wx), sigma * sigma, valid, dx);
+        s.applyCorrection(dx);
+
+        s.store(f, i);
+    }
+}
+
+// Runs the native-pack kernel over whole packs and finishes the tail with
+// the scalar instantiation
+template <typename NativeFn, typename ScalarFn>
+void forEachLane(int count, NativeFn native, ScalarFn scalar) {
+    const int vectorEnd = count - count % NativePack::WIDTH;
+    native(0, vectorEnd);
+    scalar(vectorEnd, count);
+}
+
+} // namespace
+
+BatchAttitudeFilter::BatchAttitudeFilter(int count)
+    : count(count > 0 ? count : 0) {
+    // Pad each field to a multiple of the widest pack for aligned starts
+    stride = (this->count + 7) & ~7;
+    storage.resize(static_cast<size_t>(stride) * FIELD_COUNT);
+    reset();
+}
+
+BatchAttitudeFilter::~BatchAttitudeFilter() = default;
+
+int BatchAttitudeFilter::size() const {
+    return count;
+}
+
+void BatchAttitudeFilter::reset() {
+    std::fill(storage.begin(), storage.end(), 0.0f);
+
+    const float attitudeVar = INITIAL_ATTITUDE_SIGMA * INITIAL_ATTITUDE_SIGMA;
+    const float biasVar = INITIAL_BIAS_SIGMA * INITIAL_BIAS_SIGMA;
+    for (int i = 0; i < count; i++) {
+        fieldPtr(QW)[i] = 1.0f; // Identity quaternion
+        fieldPtr(A00)[i] = attitudeVar;
+        fieldPtr(A11)[i] = attitudeVar;
+        fieldPtr(A22)[i] = attitudeVar;
+        fieldPtr(B00)[i] = biasVar;
+        fieldPtr(B11)[i] = biasVar;
+        fieldPtr(B22)[i] = biasVar;
+    }
+}
+
+void BatchAttitudeFilter::setNoise(float gyro, float accel, float mag) {
+    gyroNoise = gyro;
+    accelNoise = accel;
+    magNoise = mag;
+}
+
+void BatchAttitudeFilter::setGyroBiasNoise(float biasNoise) {
+    gyroBiasNoise = biasNoise;
+}
+
+void BatchAttitudeFilter::predict(float dt, const float* gx, const float* gy, const float* gz) {
+    if (dt <= 0.0f) return;
+
+    float* fields[FIELD_COUNT];
+    for (int k = 0; k < FIELD_COUNT; k++) fields[k] = fieldPtr(static_cast<Field>(k));
+
+    const float attitudeVar = gyroNoise * gyroNoise * dt;
+    const float biasVar = gyroBiasNoise * gyroBiasNoise * dt;
+    forEachLane(count,
+        [&](int b, int e) { predictLanes<NativePack>(fields, b, e, dt, attitudeVar, biasVar, gx, gy, gz); },
+        [&](int b, int e) { predictLanes<ScalarPack>(fields, b, e, dt, attitudeVar, biasVar, gx, gy, gz); });
+}
+
+void BatchAttitudeFilter::updateAccel(const float* ax, const float* ay, const float* az) {
+    float* fields[FIELD_COUNT];
+    for (int k = 0; k < FIELD_COUNT; k++) fields[k] = fieldPtr(static_cast<Field>(k));
+
+    forEachLane(count,
+        [&](int b, int e) { updateAccelLanes<NativePack>(fields, b, e, accelNoise, GRAVITY, ax, ay, az); },
+        [&](int b, int e) { updateAccelLanes<ScalarPack>(fields, b, e, accelNoise, GRAVITY, ax, ay, az); });
+}
+
+void BatchAttitudeFilter::updateMag(const float* mx, const float* my, const float* mz) {
+    float* fields[FIELD_COUNT];
+    for (int k = 0; k < FIELD_COUNT; k++) fields[k] = fieldPtr(static_cast<Field>(k));
+
+    forEachLane(count,
+        [&](int b, int e) { updateMagLanes<NativePack>(fields, b, e, magNoise, mx, my, mz); },
+        [&](int b, int e) { updateMagLanes<ScalarPack>(fields, b, e, magNoise, mx, my, mz); });
+}
+
+void BatchAttitudeFilter::getQuaternion(int index, float& w, float& x, float& y, float& z) const {
+    w = field(QW)[index];
+    x = field(QX)[index];
+    y = field(QY)[index];
+    z = field(QZ)[index];
+}
+
+void BatchAttitudeFilter::getEulerAngles(int index, float& roll, float& pitch, float& yaw) const {
+    float w, x, y, z;
+    getQuaternion(index, w, x, y, z);
+
+    roll = std::atan2(2 * (w * x + y * z), 1 - 2 * (x * x + y * y));
+    float sinp = 2 * (w * y - z * x);
+    pitch = std::fabs(sinp) >= 1 ? std::copysign(static_cast<float>(M_PI / 2), sinp) : std::asin(sinp);
+    yaw = std::atan2(2 * (w * z + x * y), 1 - 2 * (y * y + z * z));
+}
+
+void BatchAttitudeFilter::getGyroBias(int index, float& bx, float& by, float& bz) const {
+    bx = field(BX)[index];
+    by = field(BY)[index];
+    bz = field(BZ)[index];
+}
+
+const float* BatchAttitudeFilter::field(Field f) const {
+    return storage.data() + static_cast<size_t>(f) * static_cast<size_t>(stride);
+}
+
+float* BatchAttitudeFilter::fieldPtr(Field f) {
+    return storage.data() + static_cast<size_t>(f) * static_cast<size_t>(stride);
+}
+
+} // namespace pixhawk
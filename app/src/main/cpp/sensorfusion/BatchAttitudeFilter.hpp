@@ -0,0 +1,64 @@
+#pragma once
+#include <vector>
+
+namespace pixhawk {
+
+// Runs many independent attitude filters side by side. The model is the same
+// 6-state error-state EKF as EkfAttitude, but every state and covariance
+// element is stored structure-of-arrays in single precision so one step of
+// all filters maps onto SIMD lanes (AVX2/SSE2/NEON, scalar otherwise).
+//
+// All input arrays hold one sample per filter, i.e. size() elements each.
+class BatchAttitudeFilter {
+public:
+    explicit BatchAttitudeFilter(int count);
+    ~BatchAttitudeFilter();
+
+    int size() const;
+    void reset();
+
+    // gyro: rad/s/sqrt(Hz), accel: m/s^2, mag: normalized field units
+    void setNoise(float gyro, float accel, float mag);
+    void setGyroBiasNoise(float biasNoise);
+
+    void predict(float dt, const float* gx, const float* gy, const float* gz);
+    void updateAccel(const float* ax, const float* ay, const float* az);
+    void updateMag(const float* mx, const float* my, const float* mz);
+
+    void getQuaternion(int index, float& w, float& x, float& y, float& z) const;
+    void getEulerAngles(int index, float& roll, float& pitch, float& yaw) const;
+    void getGyroBias(int index, float& bx, float& by, float& bz) const;
+
+    // Each field is one contiguous array of size() floats
+    enum Field {
+        QW, QX, QY, QZ,
+        BX, BY, BZ,
+        // Attitude covariance block (symmetric, upper triangle)
+        A00, A01, A02, A11, A12, A22,
+        // Attitude/bias cross-covariance block (full 3x3, row-major)
+        C00, C01, C02, C10, C11, C12, C20, C21, C22,
+        // Bias covariance block (symmetric, upper triangle)
+        B00, B01, B02, B11, B12, B22,
+        FIELD_COUNT
+    };
+
+    const float* field(Field f) const;
+
+private:
+    int count;
+    int stride;
+    std::vector<float> storage;
+
+    float gyroNoise = 0.01f;
+    float accelNoise = 0.1f;
+    float magNoise = 0.05f;
+    float gyroBiasNoise = 1e-4f;
+
+    static constexpr float GRAVITY = 9.80665f;
+    static constexpr float INITIAL_ATTITUDE_SIGMA = 0.5f;   // rad
+    static constexpr float INITIAL_BIAS_SIGMA = 0.05f;      // rad/s
+
+    float* fieldPtr(Field f);
+};
+
+} // namespace pixhawk
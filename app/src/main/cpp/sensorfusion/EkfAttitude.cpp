@@ -3,64 +3,178 @@
 
 namespace pixhawk {
 
+namespace {
+
+// Body-to-world rotation matrix for a unit quaternion
+Matrix3 rotationMatrix(const MathQuat& q) {
+    Matrix3 r;
+    r(0, 0) = 1 - 2 * (q.y * q.y + q.z * q.z);
+    r(0, 1) = 2 * (q.x * q.y - q.w * q.z);
+    r(0, 2) = 2 * (q.x * q.z + q.w * q.y);
+    r(1, 0) = 2 * (q.x * q.y + q.w * q.z);
+    r(1, 1) = 1 - 2 * (q.x * q.x + q.z * q.z);
+    r(1, 2) = 2 * (q.y * q.z - q.w * q.x);
+    r(2, 0) = 2 * (q.x * q.z - q.w * q.y);
+    r(2, 1) = 2 * (q.y * q.z + q.w * q.x);
+    r(2, 2) = 1 - 2 * (q.x * q.x + q.y * q.y);
+    return r;
+}
+
+// Standard EKF measurement update for an M-dimensional measurement with
+// diagonal noise. Writes the error-state correction to dx and updates p.
+template <int M>
+bool kalmanUpdate(EkfAttitude::StateMatrix& p,
+                  const Matrix<M, EkfAttitude::STATE_DIM>& h,
+                  const Vector<M>& innovation,
+                  double noiseVariance,
+                  Vector<EkfAttitude::STATE_DIM>& dx) {
+    const Matrix<EkfAttitude::STATE_DIM, M> pht = p * h.transpose();
+
+    Matrix<M, M> s = h * pht;
+    for (int i = 0; i < M; i++) {
+        s(i, i) += noiseVariance;
+    }
+
+    Matrix<M, M> sInv;
+    if (!choleskyInverse(s, sInv)) {
+        return false;
+    }
+
+    const Matrix<EkfAttitude::STATE_DIM, M> k = pht * sInv;
+    dx = k * innovation;
+
+    // P = P - K S K^T, which is symmetric by construction
+    p -= sandwich(k, s);
+    p.symmetrize();
+    return true;
+}
+
+} // namespace
+
 EkfAttitude::EkfAttitude() {
-    orientation = MathQuat(1.0, 0.0, 0.0, 0.0); // Identity quaternion
+    reset();
 }
 
 EkfAttitude::~EkfAttitude() = default;
 
+void EkfAttitude::reset() {
+    orientation = MathQuat(1.0, 0.0, 0.0, 0.0); // Identity quaternion
+    gyroBias = Vector3();
+    covariance = StateMatrix();
+    for (int i = 0; i < 3; i++) {
+        covariance(i, i) = INITIAL_ATTITUDE_SIGMA * INITIAL_ATTITUDE_SIGMA;
+        covariance(i + 3, i + 3) = INITIAL_BIAS_SIGMA * INITIAL_BIAS_SIGMA;
+    }
+}
+
 void EkfAttitude::predict(double dt, double gx, double gy, double gz) {
-    // Simple integration of angular velocity
-    MathQuat deltaQ = MathQuat::fromEuler(gx * dt, gy * dt, gz * dt);
+    predictDeltaAngle(dt, gx * dt, gy * dt, gz * dt);
+}
+
+void EkfAttitude::predictDeltaAngle(double dt, double dax, double day, double daz) {
+    if (dt <= 0.0) return;
+
+    // Bias-corrected rotation over the interval
+    Vector3 angle;
+    angle[0] = dax - gyroBias[0] * dt;
+    angle[1] = day - gyroBias[1] * dt;
+    angle[2] = daz - gyroBias[2] * dt;
+
+    MathQuat deltaQ = MathQuat::fromRotationVector(angle[0], angle[1], angle[2]);
     orientation = orientation * deltaQ;
     orientation.normalize();
+
+    covariance = sandwich(transition(dt, angle), covariance);
+
+    const double attitudeVar = gyroNoise * gyroNoise * dt;
+    const double biasVar = gyroBiasNoise * gyroBiasNoise * dt;
+    for (int i = 0; i < 3; i++) {
+        covariance(i, i) += attitudeVar;
+        covariance(i + 3, i + 3) += biasVar;
+    }
+}
+
+EkfAttitude::StateMatrix EkfAttitude::transition(double dt, const Vector3& angle) {
+    // d(dtheta)/dt = -[w x] dtheta - dbias
+    StateMatrix f = StateMatrix::identity();
+    f.setBlock(0, 0, Matrix3::identity() - skew(angle));
+    f.setBlock(0, 3, Matrix3::identity() * -dt);
+    return f;
 }
 
 void EkfAttitude::updateAccel(double ax, double ay, double az) {
-    // Simplified accelerometer update - just normalize the measurement
     double norm = std::sqrt(ax*ax + ay*ay + az*az);
-    if (norm > 0.1) { // Avoid division by very small numbers
-        ax /= norm;
-        ay /= norm;
-        az /= norm;
-        
-        // This is a very simplified update - in reality would use proper EKF equations
-        // Just doing a small correction towards gravity vector alignment
-        const double alpha = 0.05; // Small correction factor
-        
-        // Expected gravity vector from current orientation
-        double gx_expected = 2 * (orientation.x * orientation.z - orientation.w * orientation.y);
-        double gy_expected = 2 * (orientation.w * orientation.x + orientation.y * orientation.z);
-        double gz_expected = orientation.w*orientation.w - orientation.x*orientation.x - orientation.y*orientation.y + orientation.z*orientation.z;
-        
-        // Error between measured and expected gravity
-        double error_x = az - gx_expected; // Note: assuming accelerometer z is down
-        double error_y = ay - gy_expected;
-        double error_z = ax - gz_expected;
-        
-        // Apply small correction (simplified)
-        orientation.x += alpha * error_x;
-        orientation.y += alpha * error_y; 
-        orientation.z += alpha * error_z;
-        orientation.normalize();
+    if (norm < 0.1) return; // Free fall or bad sample, nothing to align with
+
+    // Gravity direction in body frame predicted by the current estimate
+    const Matrix3 r = rotationMatrix(orientation);
+    Vector3 expected;
+    expected[0] = r(2, 0);
+    expected[1] = r(2, 1);
+    expected[2] = r(2, 2);
+
+    Vector3 innovation;
+    innovation[0] = ax / norm - expected[0];
+    innovation[1] = ay / norm - expected[1];
+    innovation[2] = az / norm - expected[2];
+
+    Matrix<3, STATE_DIM> h;
+    h.setBlock(0, 0, skew(expected));
+
+    // De-weight the measurement when the vehicle is accelerating
+    const double sigma = accelNoise / GRAVITY;
+    const double dynamic = (norm - GRAVITY) / GRAVITY;
+    const double variance = sigma * sigma + dynamic * dynamic;
+
+    Vector<STATE_DIM> dx;
+    if (kalmanUpdate(covariance, h, innovation, variance, dx)) {
+        applyCorrection(dx);
     }
 }
 
 void EkfAttitude::updateMag(double mx, double my, double mz) {
-    // Simplified magnetometer update
     double norm = std::sqrt(mx*mx + my*my + mz*mz);
-    if (norm > 0.01) {
-        mx /= norm;
-        my /= norm;
-        mz /= norm;
-        
-        // Very simple heading correction - would be much more complex in reality
-        const double beta = 0.02;
-        orientation.z += beta * mx; // Simplified
-        orientation.normalize();
+    if (norm < 0.01) return;
+
+    // Rotate the measured field into the world frame and use only its
+    // horizontal heading, so magnetic disturbances cannot tilt roll/pitch
+    const Matrix3 r = rotationMatrix(orientation);
+    Vector3 body;
+    body[0] = mx / norm;
+    body[1] = my / norm;
+    body[2] = mz / norm;
+    const Vector3 world = r * body;
+
+    double horizontal = std::sqrt(world[0] * world[0] + world[1] * world[1]);
+    if (horizontal < 0.1) return; // Near the magnetic poles heading is unobservable
+
+    Vector<1> innovation;
+    innovation[0] = std::atan2(world[1], world[0]);
+
+    // Heading error is the world-z component of the body-frame attitude error
+    Matrix<1, STATE_DIM> h;
+    h(0, 0) = -r(2, 0);
+    h(0, 1) = -r(2, 1);
+    h(0, 2) = -r(2, 2);
+
+    const double sigma = magNoise / horizontal;
+
+    Vector<STATE_DIM> dx;
+    if (kalmanUpdate(covariance, h, innovation, sigma * sigma, dx)) {
+        applyCorrection(dx);
     }
 }
 
+void EkfAttitude::applyCorrection(const Vector<STATE_DIM>& dx) {
+    MathQuat errorQ(1.0, 0.5 * dx[0], 0.5 * dx[1], 0.5 * dx[2]);
+    orientation = orientation * errorQ;
+    orientation.normalize();
+
+    gyroBias[0] += dx[3];
+    gyroBias[1] += dx[4];
+    gyroBias[2] += dx[5];
+}
+
 MathQuat EkfAttitude::getQuaternion() const {
     return orientation;
 }
@@ -69,4 +183,24 @@ void EkfAttitude::getEulerAngles(double& roll, double& pitch, double& yaw) const
     orientation.toEuler(roll, pitch, yaw);
 }
 
-} // namespace pixhawk
\ No newline at end of file
+void EkfAttitude::getGyroBias(double& bx, double& by, double& bz) const {
+    bx = gyroBias[0];
+    by = gyroBias[1];
+    bz = gyroBias[2];
+}
+
+const EkfAttitude::StateMatrix& EkfAttitude::getCovariance() const {
+    return covariance;
+}
+
+void EkfAttitude::setNoise(double gyro, double accel, double mag) {
+    gyroNoise = gyro;
+    accelNoise = accel;
+    magNoise = mag;
+}
+
+void EkfAttitude::setGyroBiasNoise(double biasNoise) {
+    gyroBiasNoise = biasNoise;
+}
+
+} // namespace pixhawk
@@ -1,25 +1,55 @@
 #pragma once
 #include "MathQuat.hpp"
+#include "Matrix.hpp"
 
 namespace pixhawk {
 
+// Error-state (multiplicative) EKF estimating body-to-world attitude and gyro
+// bias. The world frame is z-up with x along the horizontal magnetic field.
+// Error state: [attitude error (body frame, rad); gyro bias error (rad/s)].
 class EkfAttitude {
 public:
+    static constexpr int STATE_DIM = 6;
+    using StateMatrix = Matrix<STATE_DIM, STATE_DIM>;
+
     EkfAttitude();
     ~EkfAttitude();
-    
+
     void predict(double dt, double gx, double gy, double gz);
+    // Propagate with a (coning-compensated) delta-angle accumulated over dt
+    void predictDeltaAngle(double dt, double dax, double day, double daz);
     void updateAccel(double ax, double ay, double az);
     void updateMag(double mx, double my, double mz);
-    
+
     MathQuat getQuaternion() const;
     void getEulerAngles(double& roll, double& pitch, double& yaw) const;
-    
+    void getGyroBias(double& bx, double& by, double& bz) const;
+    const StateMatrix& getCovariance() const;
+
+    // gyro: rad/s/sqrt(Hz), accel: m/s^2, mag: normalized field units
+    void setNoise(double gyro, double accel, double mag);
+    void setGyroBiasNoise(double biasNoise);
+    void reset();
+
+    // Error-state transition matrix for a bias-corrected rotation 'angle'
+    // (rad) over dt, as used by predictDeltaAngle
+    static StateMatrix transition(double dt, const Vector3& angle);
+
 private:
     MathQuat orientation;
+    Vector3 gyroBias;
+    StateMatrix covariance;
+
     double gyroNoise = 0.01;
     double accelNoise = 0.1;
     double magNoise = 0.05;
+    double gyroBiasNoise = 1e-4;
+
+    static constexpr double GRAVITY = 9.80665;
+    static constexpr double INITIAL_ATTITUDE_SIGMA = 0.5;   // rad
+    static constexpr double INITIAL_BIAS_SIGMA = 0.05;      // rad/s
+
+    void applyCorrection(const Vector<STATE_DIM>& dx);
 };
 
-} // namespace pixhawk
\ No newline at end of file
+} // namespace pixhawk
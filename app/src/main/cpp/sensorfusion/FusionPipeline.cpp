@@ -0,0 +1,137 @@
+#include "FusionPipeline.hpp"
+#include <algorithm>
+#include <chrono>
+
+#ifdef PIXHAWKCORE_VERBOSE
+#include <android/log.h>
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, "FusionPipeline", __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, "FusionPipeline", __VA_ARGS__)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#endif
+
+namespace pixhawk {
+
+namespace {
+
+int64_t nowMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+FusionPipeline::FusionPipeline(SensorSim& sensors, EkfAttitude& filter)
+    : sensors(sensors), filter(filter) {
+    publish(0);
+}
+
+FusionPipeline::~FusionPipeline() {
+    stop();
+}
+
+bool FusionPipeline::start(int requestedRateHz) {
+    if (running.load()) {
+        return true;
+    }
+
+    rateHz = std::max(1, std::min(requestedRateHz, MAX_RATE_HZ));
+    running.store(true);
+
+    try {
+        workerThread = std::thread(&FusionPipeline::workerLoop, this);
+        LOGI("Fusion thread started at %d Hz", rateHz);
+        return true;
+    } catch (const std::exception& e) {
+        LOGE("Failed to start fusion thread: %s", e.what());
+        running.store(false);
+        return false;
+    }
+}
+
+void FusionPipeline::stop() {
+    if (!running.load()) {
+        return;
+    }
+
+    running.store(false);
+    if (workerThread.joinable()) {
+        workerThread.join();
+    }
+}
+
+bool FusionPipeline::isRunning() const {
+    return running.load();
+}
+
+AttitudeSnapshot FusionPipeline::latest() const {
+    return snapshot.load();
+}
+
+void FusionPipeline::workerLoop() {
+    using clock = std::chrono::steady_clock;
+
+    const auto period = std::chrono::microseconds(1000000 / rateHz);
+    const double dt = 1.0 / rateHz;
+    auto nextTick = clock::now() + period;
+    uint64_t sampleCount = 0;
+    uint64_t stepCount = 0;
+    integrator.reset();
+
+    while (running.load(std::memory_order_relaxed)) {
+        double ax, ay, az, gx, gy, gz;
+        sensors.generateAccelData(ax, ay, az);
+        sensors.generateGyroData(gx, gy, gz);
+        integrator.addSample(dt, gx, gy, gz, ax, ay, az);
+        sampleCount++;
+
+        if (integrator.getSampleCount() >= FILTER_DIVIDER) {
+            const double interval = integrator.getIntegratedTime();
+            double dax, day, daz, dvx, dvy, dvz;
+            integrator.getDeltaAngle(dax, day, daz);
+            integrator.getDeltaVelocity(dvx, dvy, dvz);
+            integrator.reset();
+
+            // Mean specific force over the interval as the gravity reference
+            filter.predictDeltaAngle(interval, dax, day, daz);
+            filter.updateAccel(dvx / interval, dvy / interval, dvz / interval);
+
+            if (stepCount % MAG_DIVIDER == 0) {
+                double mx, my, mz;
+                sensors.generateMagData(mx, my, mz);
+                filter.updateMag(mx, my, mz);
+            }
+
+            stepCount++;
+            publish(sampleCount);
+        }
+
+        std::this_thread::sleep_until(nextTick);
+        nextTick += period;
+
+        // After a long stall (debugger, suspended process) resync instead of
+        // bursting through the backlog
+        auto now = clock::now();
+        if (now > nextTick + 10 * period) {
+            nextTick = now + period;
+        }
+    }
+
+    LOGI("Fusion thread ended after %llu samples", static_cast<unsigned long long>(sampleCount));
+}
+
+void FusionPipeline::publish(uint64_t sampleCount) {
+    AttitudeSnapshot s{};
+    const MathQuat q = filter.getQuaternion();
+    s.w = q.w;
+    s.x = q.x;
+    s.y = q.y;
+    s.z = q.z;
+    q.toEuler(s.roll, s.pitch, s.yaw);
+    s.timestamp_us = nowMicros();
+    s.sampleCount = sampleCount;
+    snapshot.store(s);
+}
+
+} // namespace pixhawk
@@ -0,0 +1,59 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include "EkfAttitude.hpp"
+#include "InertialIntegrator.hpp"
+#include "SensorSim.hpp"
+#include "SeqLock.hpp"
+
+namespace pixhawk {
+
+// Latest attitude estimate published by the fusion thread
+struct AttitudeSnapshot {
+    double w, x, y, z;          // body-to-world quaternion
+    double roll, pitch, yaw;    // radians
+    int64_t timestamp_us;       // steady clock time of the estimate
+    uint64_t sampleCount;       // IMU samples integrated so far
+};
+
+// Samples SensorSim on a dedicated thread at IMU rate, accumulating the
+// gyro and accel into coning and sculling compensated increments, and
+// steps an EkfAttitude with them once every FILTER_DIVIDER samples. Every
+// new estimate is published through a seqlock, so readers on other threads
+// get the freshest attitude without taking a lock.
+//
+// The pipeline does not own the sensor or the filter; while it is running
+// it must be the only user of both.
+class FusionPipeline {
+public:
+    FusionPipeline(SensorSim& sensors, EkfAttitude& filter);
+    ~FusionPipeline();
+
+    bool start(int rateHz = DEFAULT_RATE_HZ);
+    void stop();
+    bool isRunning() const;
+
+    AttitudeSnapshot latest() const;
+
+private:
+    static constexpr int DEFAULT_RATE_HZ = 1000;
+    static constexpr int MAX_RATE_HZ = 1000;
+    static constexpr int FILTER_DIVIDER = 5;    // filter steps at 1/5 of the IMU rate
+    static constexpr int MAG_DIVIDER = 2;       // mag fused every other filter step
+
+    SensorSim& sensors;
+    EkfAttitude& filter;
+    InertialIntegrator integrator;  // worker thread only
+
+    std::atomic<bool> running{false};
+    std::thread workerThread;
+    int rateHz = DEFAULT_RATE_HZ;
+
+    SeqLock<AttitudeSnapshot> snapshot;
+
+    void workerLoop();
+    void publish(uint64_t sampleCount);
+};
+
+} // namespace pixhawk
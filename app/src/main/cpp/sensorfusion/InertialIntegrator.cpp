@@ -0,0 +1,71 @@
+#include "InertialIntegrator.hpp"
+
+namespace pixhawk {
+
+InertialIntegrator::InertialIntegrator() = default;
+InertialIntegrator::~InertialIntegrator() = default;
+
+void InertialIntegrator::reset() {
+    alpha = Vector3();
+    beta = Vector3();
+    velocity = Vector3();
+    sculling = Vector3();
+    lastDeltaAngle = Vector3();
+    lastDeltaVelocity = Vector3();
+    integratedTime = 0.0;
+    sampleCount = 0;
+}
+
+void InertialIntegrator::addSample(double dt, double gx, double gy, double gz,
+                                   double ax, double ay, double az) {
+    if (dt <= 0.0) return;
+
+    Vector3 deltaAngle;
+    deltaAngle[0] = gx * dt;
+    deltaAngle[1] = gy * dt;
+    deltaAngle[2] = gz * dt;
+
+    Vector3 deltaVelocity;
+    deltaVelocity[0] = ax * dt;
+    deltaVelocity[1] = ay * dt;
+    deltaVelocity[2] = az * dt;
+
+    // Coning: 1/2 (alpha + dTheta_prev / 6) x dTheta
+    const Vector3 coningArm = alpha + lastDeltaAngle * (1.0 / 6.0);
+    beta += cross(coningArm, deltaAngle) * 0.5;
+
+    // Sculling: 1/2 [(alpha + dTheta_prev / 6) x dV + (v + dV_prev / 6) x dTheta]
+    const Vector3 scullingArm = velocity + lastDeltaVelocity * (1.0 / 6.0);
+    sculling += (cross(coningArm, deltaVelocity) + cross(scullingArm, deltaAngle)) * 0.5;
+
+    alpha += deltaAngle;
+    velocity += deltaVelocity;
+    lastDeltaAngle = deltaAngle;
+    lastDeltaVelocity = deltaVelocity;
+    integratedTime += dt;
+    sampleCount++;
+}
+
+int InertialIntegrator::getSampleCount() const {
+    return sampleCount;
+}
+
+double InertialIntegrator::getIntegratedTime() const {
+    return integratedTime;
+}
+
+void InertialIntegrator::getDeltaAngle(double& x, double& y, double& z) const {
+    x = alpha[0] + beta[0];
+    y = alpha[1] + beta[1];
+    z = alpha[2] + beta[2];
+}
+
+void InertialIntegrator::getDeltaVelocity(double& x, double& y, double& z) const {
+    // Rotation compensation 1/2 alpha x v plus the accumulated sculling term
+    const Vector3 result = velocity + cross(alpha, velocity) * 0.5 + sculling;
+    x = result[0];
+    y = result[1];
+    z = result[2];
+}
+
+} // namespace pixhawk
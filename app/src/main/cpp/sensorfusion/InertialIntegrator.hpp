@@ -0,0 +1,39 @@
+#pragma once
+#include "Matrix.hpp"
+
+namespace pixhawk {
+
+// Accumulates high-rate gyro and accel samples into one delta-angle and
+// delta-velocity per filter step. The delta-angle includes the coning
+// correction and the delta-velocity the rotation and sculling corrections
+// (Savage recursive form), so a filter running at a fraction of the IMU
+// rate keeps the accuracy of integrating every sample.
+//
+// Outputs are expressed in the body frame at the start of the interval.
+class InertialIntegrator {
+public:
+    InertialIntegrator();
+    ~InertialIntegrator();
+
+    void reset();
+
+    // Rates in rad/s, specific force in m/s^2, dt in seconds
+    void addSample(double dt, double gx, double gy, double gz, double ax, double ay, double az);
+
+    int getSampleCount() const;
+    double getIntegratedTime() const;
+    void getDeltaAngle(double& x, double& y, double& z) const;
+    void getDeltaVelocity(double& x, double& y, double& z) const;
+
+private:
+    Vector3 alpha;          // sum of delta-angles
+    Vector3 beta;           // coning correction
+    Vector3 velocity;       // sum of delta-velocities
+    Vector3 sculling;       // sculling correction
+    Vector3 lastDeltaAngle;
+    Vector3 lastDeltaVelocity;
+    double integratedTime = 0.0;
+    int sampleCount = 0;
+};
+
+} // namespace pixhawk
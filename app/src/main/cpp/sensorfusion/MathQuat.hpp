@@ -1,20 +1,117 @@
 #pragma once
+#include <cmath>
 
 namespace pixhawk {
 
-class MathQuat {
+// Header-only quaternion usable in single or double precision. Everything
+// that does not need a square root or trig is constexpr so small helpers
+// fold away at the call site.
+template <typename T>
+class MathQuatT {
 public:
-    double w, x, y, z;
-    
-    MathQuat();
-    MathQuat(double w, double x, double y, double z);
-    
-    MathQuat operator*(const MathQuat& other) const;
-    MathQuat conjugate() const;
-    void normalize();
-    void toEuler(double& roll, double& pitch, double& yaw) const;
-    
-    static MathQuat fromEuler(double roll, double pitch, double yaw);
+    T w, x, y, z;
+
+    constexpr MathQuatT() : w(T(1)), x(T(0)), y(T(0)), z(T(0)) {}
+    constexpr MathQuatT(T w, T x, T y, T z) : w(w), x(x), y(y), z(z) {}
+
+    constexpr MathQuatT operator*(const MathQuatT& other) const {
+        return MathQuatT(
+            w * other.w - x * other.x - y * other.y - z * other.z,
+            w * other.x + x * other.w + y * other.z - z * other.y,
+            w * other.y - x * other.z + y * other.w + z * other.x,
+            w * other.z + x * other.y - y * other.x + z * other.w
+        );
+    }
+
+    constexpr MathQuatT conjugate() const {
+        return MathQuatT(w, -x, -y, -z);
+    }
+
+    constexpr T normSquared() const {
+        return w*w + x*x + y*y + z*z;
+    }
+
+    void normalize() {
+        T norm = std::sqrt(normSquared());
+        if (norm > T(0)) {
+            T inv = T(1) / norm;
+            w *= inv;
+            x *= inv;
+            y *= inv;
+            z *= inv;
+        }
+    }
+
+    // Rotate vector v by this (unit) quaternion: v' = q v q*
+    constexpr void rotate(T vx, T vy, T vz, T& ox, T& oy, T& oz) const {
+        // t = 2 (q_v x v); v' = v + w t + q_v x t
+        const T tx = T(2) * (y * vz - z * vy);
+        const T ty = T(2) * (z * vx - x * vz);
+        const T tz = T(2) * (x * vy - y * vx);
+        ox = vx + w * tx + (y * tz - z * ty);
+        oy = vy + w * ty + (z * tx - x * tz);
+        oz = vz + w * tz + (x * ty - y * tx);
+    }
+
+    void toEuler(T& roll, T& pitch, T& yaw) const {
+        // Roll (x-axis rotation)
+        T sinr_cosp = 2 * (w * x + y * z);
+        T cosr_cosp = 1 - 2 * (x * x + y * y);
+        roll = std::atan2(sinr_cosp, cosr_cosp);
+
+        // Pitch (y-axis rotation)
+        T sinp = 2 * (w * y - z * x);
+        if (std::abs(sinp) >= 1) {
+            pitch = std::copysign(static_cast<T>(M_PI / 2), sinp); // use 90 degrees if out of range
+        } else {
+            pitch = std::asin(sinp);
+        }
+
+        // Yaw (z-axis rotation)
+        T siny_cosp = 2 * (w * z + x * y);
+        T cosy_cosp = 1 - 2 * (y * y + z * z);
+        yaw = std::atan2(siny_cosp, cosy_cosp);
+    }
+
+    static MathQuatT fromEuler(T roll, T pitch, T yaw) {
+        T cr = std::cos(roll * T(0.5));
+        T sr = std::sin(roll * T(0.5));
+        T cp = std::cos(pitch * T(0.5));
+        T sp = std::sin(pitch * T(0.5));
+        T cy = std::cos(yaw * T(0.5));
+        T sy = std::sin(yaw * T(0.5));
+
+        MathQuatT q;
+        q.w = cr * cp * cy + sr * sp * sy;
+        q.x = sr * cp * cy - cr * sp * sy;
+        q.y = cr * sp * cy + sr * cp * sy;
+        q.z = cr * cp * sy - sr * sp * cy;
+
+        return q;
+    }
+
+    // Exponential map of a rotation vector (axis * angle, radians)
+    static MathQuatT fromRotationVector(T rx, T ry, T rz) {
+        T angle2 = rx * rx + ry * ry + rz * rz;
+
+        // Per-sample gyro increments are small, so use the Taylor series of
+        // cos(a/2) and sin(a/2)/a; the truncation error is below 1e-9 for
+        // angles under 0.5 rad
+        T c, s;
+        if (angle2 < T(0.25)) {
+            c = T(1) + angle2 * (T(-1.0 / 8.0) + angle2 * (T(1.0 / 384.0) + angle2 * T(-1.0 / 46080.0)));
+            s = T(0.5) + angle2 * (T(-1.0 / 48.0) + angle2 * (T(1.0 / 3840.0) + angle2 * T(-1.0 / 645120.0)));
+        } else {
+            T angle = std::sqrt(angle2);
+            c = std::cos(angle * T(0.5));
+            s = std::sin(angle * T(0.5)) / angle;
+        }
+
+        return MathQuatT(c, s * rx, s * ry, s * rz);
+    }
 };
 
-} // namespace pixhawk
\ No newline at end of file
+using MathQuat = MathQuatT<double>;
+using MathQuatf = MathQuatT<float>;
+
+} // namespace pixhawk
@@ -0,0 +1,233 @@
+#pragma once
+#include <cmath>
+
+namespace pixhawk {
+
+// Fixed-size, row-major matrix with compile-time dimensions. Storage lives
+// inline so filters built on it never touch the heap.
+template <int N, int M, typename T = double>
+class Matrix {
+public:
+    static_assert(N > 0 && M > 0, "Matrix dimensions must be positive");
+
+    static constexpr int ROWS = N;
+    static constexpr int COLS = M;
+
+    T data[N * M];
+
+    constexpr Matrix() : data{} {}
+
+    static constexpr Matrix zero() {
+        return Matrix();
+    }
+
+    static constexpr Matrix identity() {
+        static_assert(N == M, "identity() requires a square matrix");
+        Matrix result;
+        for (int i = 0; i < N; i++) {
+            result(i, i) = T(1);
+        }
+        return result;
+    }
+
+    constexpr T& operator()(int r, int c) { return data[r * M + c]; }
+    constexpr const T& operator()(int r, int c) const { return data[r * M + c]; }
+
+    // Vector-style access for single-column matrices
+    constexpr T& operator[](int i) { return data[i]; }
+    constexpr const T& operator[](int i) const { return data[i]; }
+
+    constexpr Matrix operator+(const Matrix& other) const {
+        Matrix result;
+        for (int i = 0; i < N * M; i++) {
+            result.data[i] = data[i] + other.data[i];
+        }
+        return result;
+    }
+
+    constexpr Matrix operator-(const Matrix& other) const {
+        Matrix result;
+        for (int i = 0; i < N * M; i++) {
+            result.data[i] = data[i] - other.data[i];
+        }
+        return result;
+    }
+
+    constexpr Matrix operator*(T scalar) const {
+        Matrix result;
+        for (int i = 0; i < N * M; i++) {
+            result.data[i] = data[i] * scalar;
+        }
+        return result;
+    }
+
+    constexpr Matrix& operator+=(const Matrix& other) {
+        for (int i = 0; i < N * M; i++) {
+            data[i] += other.data[i];
+        }
+        return *this;
+    }
+
+    constexpr Matrix& operator-=(const Matrix& other) {
+        for (int i = 0; i < N * M; i++) {
+            data[i] -= other.data[i];
+        }
+        return *this;
+    }
+
+    template <int K>
+    constexpr Matrix<N, K, T> operator*(const Matrix<M, K, T>& other) const {
+        Matrix<N, K, T> result;
+        for (int i = 0; i < N; i++) {
+            for (int k = 0; k < M; k++) {
+                const T a = (*this)(i, k);
+                for (int j = 0; j < K; j++) {
+                    result(i, j) += a * other(k, j);
+                }
+            }
+        }
+        return result;
+    }
+
+    constexpr Matrix<M, N, T> transpose() const {
+        Matrix<M, N, T> result;
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < M; j++) {
+                result(j, i) = (*this)(i, j);
+            }
+        }
+        return result;
+    }
+
+    template <int R, int C>
+    constexpr Matrix<R, C, T> block(int row, int col) const {
+        Matrix<R, C, T> result;
+        for (int i = 0; i < R; i++) {
+            for (int j = 0; j < C; j++) {
+                result(i, j) = (*this)(row + i, col + j);
+            }
+        }
+        return result;
+    }
+
+    template <int R, int C>
+    constexpr void setBlock(int row, int col, const Matrix<R, C, T>& src) {
+        for (int i = 0; i < R; i++) {
+            for (int j = 0; j < C; j++) {
+                (*this)(row + i, col + j) = src(i, j);
+            }
+        }
+    }
+
+    // Average with the transpose to remove round-off asymmetry
+    constexpr void symmetrize() {
+        static_assert(N == M, "symmetrize() requires a square matrix");
+        for (int i = 0; i < N; i++) {
+            for (int j = i + 1; j < N; j++) {
+                const T avg = T(0.5) * ((*this)(i, j) + (*this)(j, i));
+                (*this)(i, j) = avg;
+                (*this)(j, i) = avg;
+            }
+        }
+    }
+};
+
+template <int N, typename T = double>
+using Vector = Matrix<N, 1, T>;
+
+using Matrix3 = Matrix<3, 3>;
+using Vector3 = Vector<3>;
+
+// A * P * A^T for symmetric P. Only the upper triangle is computed and then
+// mirrored, which roughly halves the work of the second product.
+template <int N, int M, typename T>
+constexpr Matrix<N, N, T> sandwich(const Matrix<N, M, T>& a, const Matrix<M, M, T>& p) {
+    const Matrix<N, M, T> ap = a * p;
+    Matrix<N, N, T> result;
+    for (int i = 0; i < N; i++) {
+        for (int j = i; j < N; j++) {
+            T sum = T(0);
+            for (int k = 0; k < M; k++) {
+                sum += ap(i, k) * a(j, k);
+            }
+            result(i, j) = sum;
+            result(j, i) = sum;
+        }
+    }
+    return result;
+}
+
+// Skew-symmetric cross-product matrix: skew(v) * w == v x w
+template <typename T>
+constexpr Matrix<3, 3, T> skew(const Vector<3, T>& v) {
+    Matrix<3, 3, T> result;
+    result(0, 1) = -v[2];
+    result(0, 2) = v[1];
+    result(1, 0) = v[2];
+    result(1, 2) = -v[0];
+    result(2, 0) = -v[1];
+    result(2, 1) = v[0];
+    return result;
+}
+
+template <typename T>
+constexpr Vector<3, T> cross(const Vector<3, T>& a, const Vector<3, T>& b) {
+    Vector<3, T> result;
+    result[0] = a[1] * b[2] - a[2] * b[1];
+    result[1] = a[2] * b[0] - a[0] * b[2];
+    result[2] = a[0] * b[1] - a[1] * b[0];
+    return result;
+}
+
+// Inverse of a symmetric positive-definite matrix via Cholesky decomposition.
+// Returns false (leaving out untouched) if the matrix is not positive definite.
+template <int N, typename T>
+bool choleskyInverse(const Matrix<N, N, T>& a, Matrix<N, N, T>& out) {
+    Matrix<N, N, T> l;
+    for (int j = 0; j < N; j++) {
+        T diag = a(j, j);
+        for (int k = 0; k < j; k++) {
+            diag -= l(j, k) * l(j, k);
+        }
+        if (!(diag > T(0))) {
+            return false;
+        }
+        l(j, j) = std::sqrt(diag);
+        const T invDiag = T(1) / l(j, j);
+        for (int i = j + 1; i < N; i++) {
+            T sum = a(i, j);
+            for (int k = 0; k < j; k++) {
+                sum -= l(i, k) * l(j, k);
+            }
+            l(i, j) = sum * invDiag;
+        }
+    }
+
+    // Invert the lower-triangular factor
+    Matrix<N, N, T> linv;
+    for (int i = 0; i < N; i++) {
+        linv(i, i) = T(1) / l(i, i);
+        for (int j = 0; j < i; j++) {
+            T sum = T(0);
+            for (int k = j; k < i; k++) {
+                sum -= l(i, k) * linv(k, j);
+            }
+            linv(i, j) = sum * linv(i, i);
+        }
+    }
+
+    // A^-1 = L^-T * L^-1
+    for (int i = 0; i < N; i++) {
+        for (int j = i; j < N; j++) {
+            T sum = T(0);
+            for (int k = j; k < N; k++) {
+                sum += linv(k, i) * linv(k, j);
+            }
+            out(i, j) = sum;
+            out(j, i) = sum;
+        }
+    }
+    return true;
+}
+
+} // namespace pixhawk
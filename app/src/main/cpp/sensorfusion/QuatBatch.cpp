@@ -0,0 +1,125 @@
+#include "QuatBatch.hpp"
+#include "SimdPack.hpp"
+
+namespace pixhawk {
+namespace quatbatch {
+
+namespace {
+
+template <typename T> struct Packs;
+
+template <> struct Packs<float> {
+    using Wide = simd::NativePack;
+    using Narrow = simd::ScalarPack;
+
+    template <typename P> static P atan2(P y, P x) { return simd::atan2(y, x); }
+    template <typename P> static P asin(P s) { return simd::asin(s); }
+};
+
+// Double lanes take the double-precision trig kernels, so the wide and the
+// single-lane tail agree with each other to a few ulp
+template <> struct Packs<double> {
+    using Wide = simd::NativePackD;
+    using Narrow = simd::ScalarPackT<double>;
+
+    template <typename P> static P atan2(P y, P x) { return simd::preciseAtan2(y, x); }
+    template <typename P> static P asin(P s) {
+        s = min(max(s, P(-1.0)), P(1.0));
+        return simd::preciseAtan2(s, sqrt((P(1.0) - s) * (P(1.0) + s)));
+    }
+};
+
+template <typename P>
+struct PackTag {
+    using type = P;
+};
+
+// Runs 'body' over whole wide packs, then over the remaining elements with
+// single lanes
+template <typename T, typename Body>
+void forEachPack(size_t count, Body body) {
+    using Wide = typename Packs<T>::Wide;
+    using Narrow = typename Packs<T>::Narrow;
+    const size_t width = static_cast<size_t>(Wide::WIDTH);
+    size_t i = 0;
+    for (; i + width <= count; i += width) {
+        body(PackTag<Wide>(), i);
+    }
+    for (; i < count; i++) {
+        body(PackTag<Narrow>(), i);
+    }
+}
+
+} // namespace
+
+template <typename T>
+void rotateVectors(QuatArrays<const T> q, Vec3Arrays<const T> v, Vec3Arrays<T> out, size_t count) {
+    forEachPack<T>(count, [&](auto tag, size_t i) {
+        using P = typename decltype(tag)::type;
+        const P w = P::load(q.w + i), x = P::load(q.x + i), y = P::load(q.y + i), z = P::load(q.z + i);
+        const P vx = P::load(v.x + i), vy = P::load(v.y + i), vz = P::load(v.z + i);
+
+        // t = 2 (q_v x v); v' = v + w t + q_v x t
+        const P tx = P(T(2)) * (y * vz - z * vy);
+        const P ty = P(T(2)) * (z * vx - x * vz);
+        const P tz = P(T(2)) * (x * vy - y * vx);
+        (vx + w * tx + (y * tz - z * ty)).store(out.x + i);
+        (vy + w * ty + (z * tx - x * tz)).store(out.y + i);
+        (vz + w * tz + (x * ty - y * tx)).store(out.z + i);
+    });
+}
+
+template <typename T>
+void multiply(QuatArrays<const T> a, QuatArrays<const T> b, QuatArrays<T> out, size_t count) {
+    forEachPack<T>(count, [&](auto tag, size_t i) {
+        using P = typename decltype(tag)::type;
+        const P aw = P::load(a.w + i), ax = P::load(a.x + i), ay = P::load(a.y + i), az = P::load(a.z + i);
+        const P bw = P::load(b.w + i), bx = P::load(b.x + i), by = P::load(b.y + i), bz = P::load(b.z + i);
+
+        (aw * bw - ax * bx - ay * by - az * bz).store(out.w + i);
+        (aw * bx + ax * bw + ay * bz - az * by).store(out.x + i);
+        (aw * by - ax * bz + ay * bw + az * bx).store(out.y + i);
+        (aw * bz + ax * by - ay * bx + az * bw).store(out.z + i);
+    });
+}
+
+template <typename T>
+void normalize(QuatArrays<T> q, size_t count) {
+    forEachPack<T>(count, [&](auto tag, size_t i) {
+        using P = typename decltype(tag)::type;
+        const P w = P::load(q.w + i), x = P::load(q.x + i), y = P::load(q.y + i), z = P::load(q.z + i);
+
+        // Zero quaternions are left untouched, matching MathQuatT::normalize
+        const P norm = sqrt(w * w + x * x + y * y + z * z);
+        const P inv = select(norm > P(T(0)), P(T(1)) / max(norm, P(T(1e-30f))), P(T(1)));
+        (w * inv).store(q.w + i);
+        (x * inv).store(q.x + i);
+        (y * inv).store(q.y + i);
+        (z * inv).store(q.z + i);
+    });
+}
+
+template <typename T>
+void toEuler(QuatArrays<const T> q, T* roll, T* pitch, T* yaw, size_t count) {
+    forEachPack<T>(count, [&](auto tag, size_t i) {
+        using P = typename decltype(tag)::type;
+        const P w = P::load(q.w + i), x = P::load(q.x + i), y = P::load(q.y + i), z = P::load(q.z + i);
+        const P one(T(1)), two(T(2));
+
+        Packs<T>::atan2(two * (w * x + y * z), one - two * (x * x + y * y)).store(roll + i);
+        Packs<T>::asin(two * (w * y - z * x)).store(pitch + i);
+        Packs<T>::atan2(two * (w * z + x * y), one - two * (y * y + z * z)).store(yaw + i);
+    });
+}
+
+template void rotateVectors<float>(QuatArrays<const float>, Vec3Arrays<const float>, Vec3Arrays<float>, size_t);
+template void rotateVectors<double>(QuatArrays<const double>, Vec3Arrays<const double>, Vec3Arrays<double>, size_t);
+template void multiply<float>(QuatArrays<const float>, QuatArrays<const float>, QuatArrays<float>, size_t);
+template void multiply<double>(QuatArrays<const double>, QuatArrays<const double>, QuatArrays<double>, size_t);
+template void normalize<float>(QuatArrays<float>, size_t);
+template void normalize<double>(QuatArrays<double>, size_t);
+template void toEuler<float>(QuatArrays<const float>, float*, float*, float*, size_t);
+template void toEuler<double>(QuatArrays<const double>, double*, double*, double*, size_t);
+
+} // namespace quatbatch
+} // namespace pixhawk
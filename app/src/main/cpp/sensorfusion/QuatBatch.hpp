@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+
+namespace pixhawk {
+
+// Structure-of-arrays views over quaternion and vector streams, e.g. a whole
+// flight of attitude samples. Use a const element type for inputs.
+template <typename T>
+struct QuatArrays {
+    T* w;
+    T* x;
+    T* y;
+    T* z;
+};
+
+template <typename T>
+struct Vec3Arrays {
+    T* x;
+    T* y;
+    T* z;
+};
+
+// Bulk quaternion kernels, instantiated for float and double, on SIMD lanes
+// (AVX2/SSE2/NEON; double lanes need AArch64 on ARM). The float versions use
+// a polynomial atan2 good to ~1e-5 rad, the double versions trig kernels
+// within a few ulp of libm. Outputs may alias inputs.
+namespace quatbatch {
+
+// out[i] = q[i] * v[i] * q[i]^-1 for unit quaternions
+template <typename T>
+void rotateVectors(QuatArrays<const T> q, Vec3Arrays<const T> v, Vec3Arrays<T> out, size_t count);
+
+// out[i] = a[i] * b[i]
+template <typename T>
+void multiply(QuatArrays<const T> a, QuatArrays<const T> b, QuatArrays<T> out, size_t count);
+
+template <typename T>
+void normalize(QuatArrays<T> q, size_t count);
+
+// Roll/pitch/yaw in radians, same convention as MathQuatT::toEuler
+template <typename T>
+void toEuler(QuatArrays<const T> q, T* roll, T* pitch, T* yaw, size_t count);
+
+} // namespace quatbatch
+
+} // namespace pixhawk
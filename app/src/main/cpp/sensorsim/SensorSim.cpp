@@ -1,28 +1,226 @@
 #include "SensorSim.hpp"
+#include <algorithm>
 #include <cmath>
+#include "Philox.hpp"
+#include "ThreadPool.hpp"
 
 namespace pixhawk {
 
-SensorSim::SensorSim() = default;
+namespace {
+
+// Top 16 bits of counter word 2 select which random stream a draw belongs
+// to, so the streams never share a counter
+enum Stream : uint32_t {
+    STREAM_WHITE = 1,
+    STREAM_WALK = 2,
+    STREAM_CONSTANT = 3
+};
+
+Philox4x32::Block counterFor(uint64_t index, Stream stream, uint32_t lane, uint32_t level) {
+    return Philox4x32::Block{static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32),
+                             (static_cast<uint32_t>(stream) << 16) | lane, level};
+}
+
+void accelSignal(double t, double& x, double& y, double& z) {
+    x = 0.1 * std::sin(t);
+    y = 0.1 * std::cos(t * 1.1);
+    z = 9.81 + 0.05 * std::sin(t * 2.0);
+}
+
+void gyroSignal(double t, double& x, double& y, double& z) {
+    x = 0.01 * std::sin(t * 0.5);
+    y = 0.02 * std::cos(t * 0.7);
+    z = 0.005 * std::sin(t * 1.3);
+}
+
+void magSignal(double t, double& x, double& y, double& z) {
+    x = 0.2 + 0.01 * std::sin(t * 0.2);
+    y = 0.1 + 0.01 * std::cos(t * 0.3);
+    z = 0.4 + 0.005 * std::sin(t * 0.1);
+}
+
+const SensorErrorModel& errorModel(const SensorSimConfig& config, int sensor) {
+    switch (sensor) {
+        case 0: return config.accel;
+        case 1: return config.gyro;
+        default: return config.mag;
+    }
+}
+
+ImuSampleBuffers offsetBuffers(const ImuSampleBuffers& b, size_t offset) {
+    return ImuSampleBuffers{b.time + offset, b.ax + offset, b.ay + offset, b.az + offset,
+                            b.gx + offset, b.gy + offset, b.gz + offset,
+                            b.mx + offset, b.my + offset, b.mz + offset};
+}
+
+} // namespace
+
+SensorSim::SensorSim() {
+    setConfig(SensorSimConfig());
+}
+
+SensorSim::SensorSim(const SensorSimConfig& config) {
+    setConfig(config);
+}
+
 SensorSim::~SensorSim() = default;
 
 void SensorSim::generateAccelData(double& x, double& y, double& z) {
     time += 0.01;
-    x = 0.1 * std::sin(time);
-    y = 0.1 * std::cos(time * 1.1);
-    z = 9.81 + 0.05 * std::sin(time * 2.0);
+    accelSignal(time, x, y, z);
 }
 
 void SensorSim::generateGyroData(double& x, double& y, double& z) {
-    x = 0.01 * std::sin(time * 0.5);
-    y = 0.02 * std::cos(time * 0.7);
-    z = 0.005 * std::sin(time * 1.3);
+    gyroSignal(time, x, y, z);
 }
 
 void SensorSim::generateMagData(double& x, double& y, double& z) {
-    x = 0.2 + 0.01 * std::sin(time * 0.2);
-    y = 0.1 + 0.01 * std::cos(time * 0.3);
-    z = 0.4 + 0.005 * std::sin(time * 0.1);
+    magSignal(time, x, y, z);
+}
+
+void SensorSim::setConfig(const SensorSimConfig& newConfig) {
+    config = newConfig;
+
+    // Per-run constants are drawn from the seed like everything else
+    const Philox4x32::Key key = Philox4x32::makeKey(config.seed);
+    for (int sensor = 0; sensor < 3; sensor++) {
+        const SensorErrorModel& model = errorModel(config, sensor);
+        const auto biasDraw = Philox4x32::gaussian(counterFor(0, STREAM_CONSTANT, static_cast<uint32_t>(sensor), 0), key);
+        const auto scaleDraw = Philox4x32::gaussian(counterFor(1, STREAM_CONSTANT, static_cast<uint32_t>(sensor), 0), key);
+        for (int axis = 0; axis < 3; axis++) {
+            turnOnBias[3 * sensor + axis] = model.biasSigma * biasDraw[axis];
+            scale[3 * sensor + axis] = 1.0 + model.scaleFactorSigma * scaleDraw[axis];
+        }
+    }
+}
+
+// Bias random walk in units of one knot spacing, built top-down as a
+// Brownian bridge over [0, 2^WALK_LEVELS] knots: each midpoint is drawn
+// from the two interval ends, so reaching any knot costs WALK_LEVELS draws
+// no matter where it sits in the stream.
+void SensorSim::walkAtKnot(uint64_t knot, int sensor, double (&value)[3]) const {
+    const Philox4x32::Key key = Philox4x32::makeKey(config.seed);
+    const uint32_t lane = static_cast<uint32_t>(sensor);
+
+    uint64_t lo = 0;
+    uint64_t hi = uint64_t(1) << WALK_LEVELS;
+    double walkLo[3] = {0.0, 0.0, 0.0};
+    double walkHi[3];
+    const auto root = Philox4x32::gaussian(counterFor(0, STREAM_WALK, lane, 0), key);
+    const double rootSigma = std::sqrt(static_cast<double>(hi));
+    for (int axis = 0; axis < 3; axis++) {
+        walkHi[axis] = rootSigma * root[axis];
+    }
+
+    for (uint32_t level = 1; knot != lo && knot != hi; level++) {
+        const uint64_t mid = lo + (hi - lo) / 2;
+        const auto draw = Philox4x32::gaussian(counterFor(mid, STREAM_WALK, lane, level), key);
+        const double sigma = 0.5 * std::sqrt(static_cast<double>(hi - lo));
+
+        double walkMid[3];
+        for (int axis = 0; axis < 3; axis++) {
+            walkMid[axis] = 0.5 * (walkLo[axis] + walkHi[axis]) + sigma * draw[axis];
+        }
+        if (knot < mid) {
+            hi = mid;
+            std::copy(walkMid, walkMid + 3, walkHi);
+        } else {
+            lo = mid;
+            std::copy(walkMid, walkMid + 3, walkLo);
+        }
+    }
+
+    const double* result = knot == lo ? walkLo : walkHi;
+    std::copy(result, result + 3, value);
+}
+
+void SensorSim::generateBulk(uint64_t firstSample, size_t count, const ImuSampleBuffers& out) const {
+    const double dt = 1.0 / config.sampleRate;
+    for (size_t i = 0; i < count; i++) {
+        const double t = static_cast<double>(firstSample + i + 1) * dt;
+        out.time[i] = t;
+        accelSignal(t, out.ax[i], out.ay[i], out.az[i]);
+        gyroSignal(t, out.gx[i], out.gy[i], out.gz[i]);
+        magSignal(t, out.mx[i], out.my[i], out.mz[i]);
+    }
+    applyErrors(firstSample, count, out);
+}
+
+void SensorSim::applyErrors(uint64_t firstSample, size_t count, const ImuSampleBuffers& out) const {
+    const double dt = 1.0 / config.sampleRate;
+    const Philox4x32::Key key = Philox4x32::makeKey(config.seed);
+    double* const channels[AXES] = {out.ax, out.ay, out.az, out.gx, out.gy, out.gz, out.mx, out.my, out.mz};
+
+    // Scale factor and turn-on bias, one flat pass per channel
+    for (int axis = 0; axis < AXES; axis++) {
+        double* const c = channels[axis];
+        const double s = scale[axis];
+        const double b = turnOnBias[axis];
+        for (size_t i = 0; i < count; i++) {
+            c[i] = c[i] * s + b;
+        }
+    }
+
+    for (int sensor = 0; sensor < 3; sensor++) {
+        const SensorErrorModel& model = errorModel(config, sensor);
+        const uint32_t lane = static_cast<uint32_t>(sensor);
+        double* const x = channels[3 * sensor];
+        double* const y = channels[3 * sensor + 1];
+        double* const z = channels[3 * sensor + 2];
+
+        if (model.noise > 0.0) {
+            for (size_t i = 0; i < count; i++) {
+                const auto n = Philox4x32::gaussian(counterFor(firstSample + i, STREAM_WHITE, lane, 0), key);
+                x[i] += model.noise * n[0];
+                y[i] += model.noise * n[1];
+                z[i] += model.noise * n[2];
+            }
+        }
+
+        // The walk is exact at the knots and linearly interpolated between
+        // them; the variance lost inside one knot spacing is far below the
+        // white noise at any realistic sample rate
+        if (model.randomWalk > 0.0) {
+            const double knotSigma = model.randomWalk * std::sqrt(static_cast<double>(WALK_KNOT_SPACING) * dt);
+            const double invSpacing = 1.0 / static_cast<double>(WALK_KNOT_SPACING);
+            uint64_t knot = firstSample / WALK_KNOT_SPACING;
+            double walkLo[3], walkHi[3];
+            walkAtKnot(knot, sensor, walkLo);
+            walkAtKnot(knot + 1, sensor, walkHi);
+
+            for (size_t i = 0; i < count; i++) {
+                const uint64_t sample = firstSample + i;
+                if (sample / WALK_KNOT_SPACING != knot) {
+                    knot++;
+                    std::copy(walkHi, walkHi + 3, walkLo);
+                    walkAtKnot(knot + 1, sensor, walkHi);
+                }
+                const double frac = static_cast<double>(sample - knot * WALK_KNOT_SPACING) * invSpacing;
+                x[i] += knotSigma * (walkLo[0] + frac * (walkHi[0] - walkLo[0]));
+                y[i] += knotSigma * (walkLo[1] + frac * (walkHi[1] - walkLo[1]));
+                z[i] += knotSigma * (walkLo[2] + frac * (walkHi[2] - walkLo[2]));
+            }
+        }
+
+        if (model.quantization > 0.0) {
+            const double q = model.quantization;
+            const double invQ = 1.0 / q;
+            for (double* c : {x, y, z}) {
+                for (size_t i = 0; i < count; i++) {
+                    c[i] = q * std::nearbyint(c[i] * invQ);
+                }
+            }
+        }
+    }
+}
+
+void SensorSim::generateBulk(ThreadPool& pool, uint64_t firstSample, size_t count, const ImuSampleBuffers& out) const {
+    const size_t chunks = (count + PARALLEL_CHUNK - 1) / PARALLEL_CHUNK;
+    pool.parallelFor(chunks, [&](size_t c) {
+        const size_t offset = c * PARALLEL_CHUNK;
+        const size_t n = std::min(PARALLEL_CHUNK, count - offset);
+        generateBulk(firstSample + offset, n, offsetBuffers(out, offset));
+    });
 }
 
-} // namespace pixhawk
\ No newline at end of file
+} // namespace pixhawk
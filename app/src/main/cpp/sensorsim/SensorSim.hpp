@@ -1,18 +1,83 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 
 namespace pixhawk {
 
+class ThreadPool;
+
+// Error model for one three-axis sensor; every term is applied per axis
+struct SensorErrorModel {
+    double noise = 0.0;             // white noise sigma per sample
+    double biasSigma = 0.0;         // turn-on bias sigma
+    double randomWalk = 0.0;        // bias random walk, units per sqrt(s)
+    double scaleFactorSigma = 0.0;  // relative scale error sigma (1e-3 = 0.1 %)
+    double quantization = 0.0;      // output LSB, 0 disables rounding
+};
+
+struct SensorSimConfig {
+    double sampleRate = 100.0;      // Hz
+    uint64_t seed = 1;
+    SensorErrorModel accel;
+    SensorErrorModel gyro;
+    SensorErrorModel mag;
+};
+
+// Caller-owned output arrays for bulk generation, each holding 'count' values
+struct ImuSampleBuffers {
+    double* time;
+    double* ax;
+    double* ay;
+    double* az;
+    double* gx;
+    double* gy;
+    double* gz;
+    double* mx;
+    double* my;
+    double* mz;
+};
+
 class SensorSim {
 public:
     SensorSim();
+    explicit SensorSim(const SensorSimConfig& config);
     ~SensorSim();
-    
+
     void generateAccelData(double& x, double& y, double& z);
     void generateGyroData(double& x, double& y, double& z);
     void generateMagData(double& x, double& y, double& z);
-    
+
+    void setConfig(const SensorSimConfig& config);
+    const SensorSimConfig& getConfig() const { return config; }
+
+    // Fills samples [firstSample, firstSample + count) of the stream. Sample
+    // k is taken at t = (k + 1) / sampleRate, so with the default error-free
+    // config it matches the (k + 1)th legacy generateAccelData call. Every
+    // sample depends only on the seed and its index, so any range can be
+    // generated on its own and from several threads at once.
+    void generateBulk(uint64_t firstSample, size_t count, const ImuSampleBuffers& out) const;
+
+    // Same as above, with the range split across the pool
+    void generateBulk(ThreadPool& pool, uint64_t firstSample, size_t count, const ImuSampleBuffers& out) const;
+
+    // Adds the configured sensor errors for samples [firstSample,
+    // firstSample + count) to ideal readings already in 'out', for callers
+    // that supply their own trajectory. The time array is not touched.
+    void applyErrors(uint64_t firstSample, size_t count, const ImuSampleBuffers& out) const;
+
 private:
+    static constexpr int AXES = 9;              // accel xyz, gyro xyz, mag xyz
+    static constexpr uint64_t WALK_KNOT_SPACING = 256;
+    static constexpr uint32_t WALK_LEVELS = 40;
+    static constexpr size_t PARALLEL_CHUNK = 65536;
+
     double time = 0.0;
+
+    SensorSimConfig config;
+    double turnOnBias[AXES] = {};
+    double scale[AXES] = {};
+
+    void walkAtKnot(uint64_t knot, int sensor, double (&value)[3]) const;
 };
 
-} // namespace pixhawk
\ No newline at end of file
+} // namespace pixhawk
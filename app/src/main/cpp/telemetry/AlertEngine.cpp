@@ -0,0 +1,538 @@
+#include "AlertEngine.hpp"
+#include "TelemetryEngine.hpp"
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace pixhawk {
+
+namespace {
+
+using Op = AlertProgram::Op;
+
+constexpr int64_t NEVER = INT64_MIN;
+constexpr double NOT_RECEIVED = std::numeric_limits<double>::quiet_NaN();
+
+struct FieldInfo {
+    const char* name;
+    MessageType type;
+};
+
+// Index is the field's slot in the per-vehicle tables
+constexpr FieldInfo FIELDS[] = {
+    {"heartbeat.armed", MessageType::HEARTBEAT},
+    {"attitude.yaw", MessageType::ATTITUDE},
+    {"attitude.pitch", MessageType::ATTITUDE},
+    {"attitude.roll", MessageType::ATTITUDE},
+    {"gps.lat", MessageType::GPS},
+    {"gps.lon", MessageType::GPS},
+    {"gps.alt", MessageType::GPS},
+    {"battery.voltage", MessageType::BATTERY},
+    {"battery.current", MessageType::BATTERY},
+    {"battery.remaining", MessageType::BATTERY},
+};
+
+constexpr const char* TYPE_NAMES[] = {"heartbeat", "attitude", "gps", "battery"};
+
+constexpr size_t FIELD_TABLE_SIZE = sizeof(FIELDS) / sizeof(FIELDS[0]);
+constexpr size_t TYPE_TABLE_SIZE = sizeof(TYPE_NAMES) / sizeof(TYPE_NAMES[0]);
+
+uint32_t typeBit(MessageType type) {
+    return 1u << static_cast<int>(type);
+}
+
+bool truth(double value) {
+    return value != 0.0 && !std::isnan(value);
+}
+
+// Recursive descent over the source, emitting postfix code as it goes:
+//   or      := and (("||" | "or") and)*
+//   and     := compare (("&&" | "and") compare)*
+//   compare := sum (("<" | "<=" | ">" | ">=" | "==" | "!=") sum)?
+//   sum     := product (("+" | "-") product)*
+//   product := unary (("*" | "/") unary)*
+//   unary   := ("-" | "!" | "not") unary | primary
+//   primary := number | field | name "(" arguments ")" | "(" or ")"
+class Compiler {
+public:
+    Compiler(const std::string& source, AlertProgram& program) : source(source), program(program) {}
+
+    bool compile(std::string& error) {
+        program = AlertProgram{};
+        bool ok = parseOr();
+        skipSpaces();
+        if (ok && position < source.size()) {
+            fail("unexpected character");
+            ok = false;
+        }
+        if (!ok) {
+            error = message + " at " + std::to_string(failedAt);
+            program = AlertProgram{};
+        }
+        return ok;
+    }
+
+private:
+    const std::string& source;
+    AlertProgram& program;
+    size_t position = 0;
+    size_t depth = 0;
+    std::string message;
+    size_t failedAt = 0;
+
+    bool fail(const std::string& text) {
+        if (message.empty()) {
+            message = text;
+            failedAt = position;
+        }
+        return false;
+    }
+
+    void skipSpaces() {
+        while (position < source.size() && std::isspace(static_cast<unsigned char>(source[position]))) {
+            position++;
+        }
+    }
+
+    // Consumes the operator if it comes next
+    bool accept(const char* token) {
+        skipSpaces();
+        const size_t length = std::strlen(token);
+        if (source.compare(position, length, token) != 0) return false;
+        // Word operators must not be the start of a longer name
+        if (std::isalpha(static_cast<unsigned char>(token[0])) && position + length < source.size()) {
+            const char next = source[position + length];
+            if (std::isalnum(static_cast<unsigned char>(next)) || next == '_' || next == '.') return false;
+        }
+        position += length;
+        return true;
+    }
+
+    bool emit(Op op, int stackEffect, uint16_t arg = 0, double value = 0.0) {
+        if (stackEffect > 0) {
+            depth += static_cast<size_t>(stackEffect);
+            if (depth > AlertProgram::MAX_STACK) return fail("expression too deep");
+        } else {
+            depth -= static_cast<size_t>(-stackEffect);
+        }
+        program.code.push_back({op, arg, value});
+        return true;
+    }
+
+    bool parseOr() {
+        if (!parseAnd()) return false;
+        while (accept("||") || accept("or")) {
+            if (!parseAnd() || !emit(Op::OR, -1)) return false;
+        }
+        return true;
+    }
+
+    bool parseAnd() {
+        if (!parseCompare()) return false;
+        while (accept("&&") || accept("and")) {
+            if (!parseCompare() || !emit(Op::AND, -1)) return false;
+        }
+        return true;
+    }
+
+    bool parseCompare() {
+        if (!parseSum()) return false;
+        // Two-character operators first
+        static const struct { const char* token; Op op; } COMPARISONS[] = {
+            {"<=", Op::LE}, {">=", Op::GE}, {"==", Op::EQ}, {"!=", Op::NE}, {"<", Op::LT}, {">", Op::GT},
+        };
+        for (const auto& comparison : COMPARISONS) {
+            if (accept(comparison.token)) {
+                return parseSum() && emit(comparison.op, -1);
+            }
+        }
+        return true;
+    }
+
+    bool parseSum() {
+        if (!parseProduct()) return false;
+        for (;;) {
+            if (accept("+")) {
+                if (!parseProduct() || !emit(Op::ADD, -1)) return false;
+            } else if (accept("-")) {
+                if (!parseProduct() || !emit(Op::SUB, -1)) return false;
+            } else {
+                return true;
+            }
+        }
+    }
+
+    bool parseProduct() {
+        if (!parseUnary()) return false;
+        for (;;) {
+            if (accept("*")) {
+                if (!parseUnary() || !emit(Op::MUL, -1)) return false;
+            } else if (accept("/")) {
+                if (!parseUnary() || !emit(Op::DIV, -1)) return false;
+            } else {
+                return true;
+            }
+        }
+    }
+
+    bool parseUnary() {
+        if (accept("-")) {
+            return parseUnary() && emit(Op::NEG, 0);
+        }
+        // "!" but not "!="
+        skipSpaces();
+        if (source.compare(position, 2, "!=") != 0 && (accept("!") || accept("not"))) {
+            return parseUnary() && emit(Op::NOT, 0);
+        }
+        return parsePrimary();
+    }
+
+    bool parsePrimary() {
+        skipSpaces();
+        if (position >= source.size()) return fail("unexpected end");
+
+        const char c = source[position];
+        if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+            const char* begin = source.c_str() + position;
+            char* end = nullptr;
+            const double value = std::strtod(begin, &end);
+            if (end == begin) return fail("bad number");
+            position += static_cast<size_t>(end - begin);
+            return emit(Op::CONST, 1, 0, value);
+        }
+        if (accept("(")) {
+            if (!parseOr()) return false;
+            return accept(")") || fail("expected ')'");
+        }
+        if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            const std::string name = parseName();
+            if (accept("(")) {
+                return parseCall(name);
+            }
+            uint16_t field;
+            if (!findField(name, field)) return fail("unknown field '" + name + "'");
+            program.typeMask |= typeBit(FIELDS[field].type);
+            return emit(Op::FIELD, 1, field);
+        }
+        return fail("unexpected character");
+    }
+
+    // Identifier, with dots for type.field
+    std::string parseName() {
+        const size_t begin = position;
+        while (position < source.size()) {
+            const char c = source[position];
+            if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_' && c != '.') break;
+            position++;
+        }
+        return source.substr(begin, position - begin);
+    }
+
+    bool parseCall(const std::string& name) {
+        if (name == "abs") {
+            return parseOr() && expect(")") && emit(Op::ABS, 0);
+        }
+        if (name == "min" || name == "max") {
+            return parseOr() && expect(",") && parseOr() && expect(")") &&
+                   emit(name == "min" ? Op::MIN : Op::MAX, -1);
+        }
+        skipSpaces();
+        const std::string argument = parseName();
+        if (name == "rate") {
+            uint16_t field;
+            if (!findField(argument, field)) return fail("rate() takes a field");
+            program.typeMask |= typeBit(FIELDS[field].type);
+            return expect(")") && emit(Op::RATE, 1, field);
+        }
+        if (name == "age") {
+            for (size_t type = 0; type < TYPE_TABLE_SIZE; type++) {
+                if (argument == TYPE_NAMES[type]) {
+                    program.usesAge = true;
+                    return expect(")") && emit(Op::AGE, 1, static_cast<uint16_t>(type));
+                }
+            }
+            return fail("age() takes a message type");
+        }
+        return fail("unknown function '" + name + "'");
+    }
+
+    bool expect(const char* token) {
+        return accept(token) || fail(std::string("expected '") + token + "'");
+    }
+
+    static bool findField(const std::string& name, uint16_t& field) {
+        for (size_t i = 0; i < FIELD_TABLE_SIZE; i++) {
+            if (name == FIELDS[i].name) {
+                field = static_cast<uint16_t>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+} // namespace
+
+bool compileAlertExpression(const std::string& source, AlertProgram& program, std::string& error) {
+    return Compiler(source, program).compile(error);
+}
+
+AlertEngine::AlertEngine() {
+    static_assert(FIELD_TABLE_SIZE == FIELD_COUNT, "field table size");
+    static_assert(TYPE_TABLE_SIZE == TYPE_COUNT, "message type table size");
+}
+
+AlertEngine::~AlertEngine() = default;
+
+int AlertEngine::addRule(const RuleSpec& spec, std::string& error) {
+    Rule rule;
+    rule.spec = spec;
+    rule.spec.forMs = std::max<int64_t>(spec.forMs, 0);
+    if (!compileAlertExpression(spec.condition, rule.condition, error)) {
+        error = "condition: " + error;
+        return 0;
+    }
+    rule.hasClear = !spec.clearCondition.empty();
+    if (rule.hasClear && !compileAlertExpression(spec.clearCondition, rule.clearCondition, error)) {
+        error = "clear condition: " + error;
+        return 0;
+    }
+    if (rule.condition.typeMask == 0 && !rule.condition.usesAge) {
+        error = "condition reads no telemetry";
+        return 0;
+    }
+    rule.timed = rule.spec.forMs > 0 || rule.condition.usesAge || (rule.hasClear && rule.clearCondition.usesAge);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (rules.size() >= MAX_RULES) {
+        error = "too many rules";
+        return 0;
+    }
+    rule.id = nextId++;
+    rules.push_back(std::move(rule));
+    for (Vehicle& vehicle : vehicles) {
+        if (vehicle.sysid != NO_VEHICLE) {
+            vehicle.rules.emplace_back();
+        }
+    }
+    rebuildSubscriptions();
+    return rules.back().id;
+}
+
+bool AlertEngine::removeRule(int id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t i = 0; i < rules.size(); i++) {
+        if (rules[i].id != id) continue;
+        rules.erase(rules.begin() + static_cast<std::ptrdiff_t>(i));
+        for (Vehicle& vehicle : vehicles) {
+            if (vehicle.sysid != NO_VEHICLE) {
+                vehicle.rules.erase(vehicle.rules.begin() + static_cast<std::ptrdiff_t>(i));
+            }
+        }
+        rebuildSubscriptions();
+        return true;
+    }
+    return false;
+}
+
+void AlertEngine::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    rules.clear();
+    for (Vehicle& vehicle : vehicles) {
+        vehicle.rules.clear();
+    }
+    rebuildSubscriptions();
+}
+
+size_t AlertEngine::getRuleCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return rules.size();
+}
+
+size_t AlertEngine::evaluate(const TelemetryMessage& msg, int64_t nowMs, std::vector<AlertEvent>& events) {
+    const auto type = static_cast<size_t>(msg.type);
+    if (type >= TYPE_COUNT) return 0;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    Vehicle* vehicle = findVehicle(msg.sysid);
+    if (!vehicle) return 0;
+
+    // Take in every field of the type, so rules added later see them too
+    for (size_t i = 0; i < FIELD_COUNT; i++) {
+        if (FIELDS[i].type == msg.type) {
+            vehicle->previous[i] = vehicle->fields[i];
+        }
+    }
+    switch (msg.type) {
+        case MessageType::HEARTBEAT:
+            vehicle->fields[0] = msg.data.armed ? 1.0 : 0.0;
+            break;
+        case MessageType::ATTITUDE:
+            vehicle->fields[1] = msg.data.yaw;
+            vehicle->fields[2] = msg.data.pitch;
+            vehicle->fields[3] = msg.data.roll;
+            break;
+        case MessageType::GPS:
+            vehicle->fields[4] = msg.data.lat;
+            vehicle->fields[5] = msg.data.lon;
+            vehicle->fields[6] = msg.data.alt;
+            break;
+        case MessageType::BATTERY:
+            vehicle->fields[7] = msg.data.voltage;
+            vehicle->fields[8] = msg.data.current;
+            vehicle->fields[9] = msg.data.remaining;
+            break;
+    }
+    vehicle->previousSentMs[type] = vehicle->sentMs[type];
+    vehicle->sentMs[type] = msg.timestamp_ms;
+    vehicle->arrivalMs[type] = nowMs;
+
+    size_t count = 0;
+    for (size_t index : subscribers[type]) {
+        if (step(index, *vehicle, nowMs, events)) count++;
+    }
+    return count;
+}
+
+size_t AlertEngine::evaluateTimers(int64_t nowMs, std::vector<AlertEvent>& events) {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t count = 0;
+    for (Vehicle& vehicle : vehicles) {
+        if (vehicle.sysid == NO_VEHICLE) break;
+        for (size_t index : timedRules) {
+            if (step(index, vehicle, nowMs, events)) count++;
+        }
+    }
+    return count;
+}
+
+// Caller holds mutex
+void AlertEngine::rebuildSubscriptions() {
+    for (auto& list : subscribers) {
+        list.clear();
+    }
+    timedRules.clear();
+    for (size_t i = 0; i < rules.size(); i++) {
+        const Rule& rule = rules[i];
+        // An age() term changes on any message from the vehicle
+        uint32_t mask = rule.condition.typeMask | (rule.hasClear ? rule.clearCondition.typeMask : 0u);
+        if (rule.condition.usesAge || (rule.hasClear && rule.clearCondition.usesAge)) {
+            mask = (1u << TYPE_COUNT) - 1u;
+        }
+        for (size_t type = 0; type < TYPE_COUNT; type++) {
+            if (mask & (1u << type)) subscribers[type].push_back(i);
+        }
+        if (rule.timed) timedRules.push_back(i);
+    }
+}
+
+// Caller holds mutex
+AlertEngine::Vehicle* AlertEngine::findVehicle(int32_t sysid) {
+    for (Vehicle& vehicle : vehicles) {
+        if (vehicle.sysid == sysid) return &vehicle;
+        if (vehicle.sysid == NO_VEHICLE) {
+            vehicle.sysid = sysid;
+            std::fill(std::begin(vehicle.fields), std::end(vehicle.fields), NOT_RECEIVED);
+            std::fill(std::begin(vehicle.previous), std::end(vehicle.previous), NOT_RECEIVED);
+            std::fill(std::begin(vehicle.sentMs), std::end(vehicle.sentMs), NEVER);
+            std::fill(std::begin(vehicle.previousSentMs), std::end(vehicle.previousSentMs), NEVER);
+            std::fill(std::begin(vehicle.arrivalMs), std::end(vehicle.arrivalMs), NEVER);
+            vehicle.rules.assign(rules.size(), RuleState{});
+            return &vehicle;
+        }
+    }
+    // More vehicles than slots: the newcomers are not checked
+    return nullptr;
+}
+
+double AlertEngine::run(const AlertProgram& program, const Vehicle& vehicle, int64_t nowMs) {
+    double stack[AlertProgram::MAX_STACK];
+    size_t top = 0;
+    for (const AlertProgram::Instruction& instruction : program.code) {
+        switch (instruction.op) {
+            case Op::CONST:
+                stack[top++] = instruction.value;
+                break;
+            case Op::FIELD:
+                stack[top++] = vehicle.fields[instruction.arg];
+                break;
+            case Op::RATE: {
+                const auto type = static_cast<size_t>(FIELDS[instruction.arg].type);
+                const int64_t previousMs = vehicle.previousSentMs[type];
+                const int64_t elapsedMs = vehicle.sentMs[type] - previousMs;
+                stack[top++] = previousMs == NEVER || elapsedMs <= 0
+                    ? NOT_RECEIVED
+                    : (vehicle.fields[instruction.arg] - vehicle.previous[instruction.arg]) * 1000.0 /
+                      static_cast<double>(elapsedMs);
+                break;
+            }
+            case Op::AGE: {
+                const int64_t arrivalMs = vehicle.arrivalMs[instruction.arg];
+                stack[top++] = arrivalMs == NEVER ? NOT_RECEIVED : static_cast<double>(nowMs - arrivalMs) / 1000.0;
+                break;
+            }
+            case Op::NEG: stack[top - 1] = -stack[top - 1]; break;
+            case Op::NOT: stack[top - 1] = truth(stack[top - 1]) ? 0.0 : 1.0; break;
+            case Op::ABS: stack[top - 1] = std::fabs(stack[top - 1]); break;
+            default: {
+                const double b = stack[--top];
+                double& a = stack[top - 1];
+                switch (instruction.op) {
+                    case Op::MIN: a = std::fmin(a, b); break;
+                    case Op::MAX: a = std::fmax(a, b); break;
+                    case Op::ADD: a = a + b; break;
+                    case Op::SUB: a = a - b; break;
+                    case Op::MUL: a = a * b; break;
+                    case Op::DIV: a = a / b; break;
+                    case Op::LT: a = a < b ? 1.0 : 0.0; break;
+                    case Op::LE: a = a <= b ? 1.0 : 0.0; break;
+                    case Op::GT: a = a > b ? 1.0 : 0.0; break;
+                    case Op::GE: a = a >= b ? 1.0 : 0.0; break;
+                    case Op::EQ: a = a == b ? 1.0 : 0.0; break;
+                    case Op::NE: a = a != b ? 1.0 : 0.0; break;
+                    case Op::AND: a = truth(a) && truth(b) ? 1.0 : 0.0; break;
+                    case Op::OR: a = truth(a) || truth(b) ? 1.0 : 0.0; break;
+                    default: break;
+                }
+                break;
+            }
+        }
+    }
+    return top == 1 ? stack[0] : NOT_RECEIVED;
+}
+
+// Caller holds mutex. True if the rule raised or cleared.
+bool AlertEngine::step(size_t index, Vehicle& vehicle, int64_t nowMs, std::vector<AlertEvent>& events) {
+    const Rule& rule = rules[index];
+    RuleState& state = vehicle.rules[index];
+
+    if (state.active) {
+        const bool cleared = rule.hasClear ? truth(run(rule.clearCondition, vehicle, nowMs))
+                                           : !truth(run(rule.condition, vehicle, nowMs));
+        if (!cleared) return false;
+        state.active = false;
+        state.pendingSince = -1;
+        events.push_back({rule.id, rule.spec.name, rule.spec.severity, vehicle.sysid, false, nowMs});
+        return true;
+    }
+
+    if (!truth(run(rule.condition, vehicle, nowMs))) {
+        state.pendingSince = -1;
+        return false;
+    }
+    if (state.pendingSince < 0) {
+        state.pendingSince = nowMs;
+    }
+    if (nowMs - state.pendingSince < rule.spec.forMs) {
+        return false;
+    }
+    state.active = true;
+    events.push_back({rule.id, rule.spec.name, rule.spec.severity, vehicle.sysid, true, nowMs});
+    return true;
+}
+
+} // namespace pixhawk
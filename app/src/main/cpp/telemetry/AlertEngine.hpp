@@ -0,0 +1,134 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace pixhawk {
+
+struct TelemetryMessage;
+
+struct AlertEvent {
+    int ruleId;
+    std::string name;
+    int severity;
+    int32_t sysid;
+    bool raised;                // false when the alert cleared
+    int64_t timestamp_ms;       // local steady clock
+};
+
+// Alert expression compiled to postfix code for a small stack machine.
+//
+// Expressions combine telemetry fields, numbers and operators:
+//   fields     heartbeat.armed, attitude.yaw/pitch/roll (degrees),
+//              gps.lat/lon/alt, battery.voltage/current/remaining
+//   functions  abs(x), min(a, b), max(a, b),
+//              rate(field)   change per second between its last two messages
+//              age(type)     seconds since the vehicle last sent that type
+//   operators  + - * /, < <= > >= == !=, && || ! (or and, or, not)
+// e.g. "battery.voltage < 10.5", "abs(attitude.roll) > 45 || abs(attitude.pitch) > 45",
+// "rate(gps.alt) < -5", "age(heartbeat) > 3". A field, rate or age of a
+// type not received yet reads as NaN, so comparisons against it are false.
+struct AlertProgram {
+    enum class Op : uint8_t {
+        CONST, FIELD, RATE, AGE,
+        NEG, NOT, ABS, MIN, MAX,
+        ADD, SUB, MUL, DIV,
+        LT, LE, GT, GE, EQ, NE, AND, OR
+    };
+
+    struct Instruction {
+        Op op;
+        uint16_t arg;           // field or message type index
+        double value;           // CONST
+    };
+
+    static constexpr size_t MAX_STACK = 32;
+
+    std::vector<Instruction> code;
+    uint32_t typeMask = 0;      // message types whose fields it reads
+    bool usesAge = false;       // changes with time alone
+};
+
+// False with a message in 'error' if the source does not parse
+bool compileAlertExpression(const std::string& source, AlertProgram& program, std::string& error);
+
+// Alert rules evaluated inline as telemetry is ingested. Each rule is
+// compiled once; a message only runs the rules that read its type, against
+// the sending vehicle's latest fields. A rule raises once its condition has
+// held for forMs and clears when its clear condition holds (hysteresis), or
+// when the condition turns false if it has none.
+class AlertEngine {
+public:
+    static constexpr size_t MAX_RULES = 1024;
+    static constexpr size_t MAX_VEHICLES = 16;
+
+    struct RuleSpec {
+        std::string name;
+        std::string condition;
+        std::string clearCondition;     // empty: clears when 'condition' is false
+        int64_t forMs = 0;
+        int severity = 0;
+    };
+
+    AlertEngine();
+    ~AlertEngine();
+
+    // Returns the rule's id, or 0 with a message in 'error'
+    int addRule(const RuleSpec& spec, std::string& error);
+    bool removeRule(int id);
+    void clear();
+    size_t getRuleCount() const;
+
+    // Takes in the message's fields and runs the rules subscribed to its
+    // type for its vehicle; appends an event per alert raised or cleared and
+    // returns how many were appended
+    size_t evaluate(const TelemetryMessage& msg, int64_t nowMs, std::vector<AlertEvent>& events);
+    // Runs the rules that can change without new messages: those with a
+    // duration or an age() term
+    size_t evaluateTimers(int64_t nowMs, std::vector<AlertEvent>& events);
+
+private:
+    static constexpr size_t TYPE_COUNT = 4;
+    static constexpr size_t FIELD_COUNT = 10;
+    static constexpr int32_t NO_VEHICLE = -1;
+
+    struct Rule {
+        int id;
+        RuleSpec spec;
+        AlertProgram condition;
+        AlertProgram clearCondition;
+        bool hasClear;
+        bool timed;             // needs evaluateTimers
+    };
+
+    struct RuleState {
+        bool active = false;
+        int64_t pendingSince = -1;      // condition true since, while not active
+    };
+
+    struct Vehicle {
+        int32_t sysid = NO_VEHICLE;
+        double fields[FIELD_COUNT];
+        double previous[FIELD_COUNT];
+        int64_t sentMs[TYPE_COUNT];
+        int64_t previousSentMs[TYPE_COUNT];
+        int64_t arrivalMs[TYPE_COUNT];
+        std::vector<RuleState> rules;   // parallel to AlertEngine::rules
+    };
+
+    mutable std::mutex mutex;
+    std::vector<Rule> rules;
+    std::vector<size_t> subscribers[TYPE_COUNT];    // rule indices per message type
+    std::vector<size_t> timedRules;
+    Vehicle vehicles[MAX_VEHICLES];
+    int nextId = 1;
+
+    void rebuildSubscriptions();
+    Vehicle* findVehicle(int32_t sysid);
+    static double run(const AlertProgram& program, const Vehicle& vehicle, int64_t nowMs);
+    bool step(size_t index, Vehicle& vehicle, int64_t nowMs, std::vector<AlertEvent>& events);
+};
+
+} // namespace pixhawk
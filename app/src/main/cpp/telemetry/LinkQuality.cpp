@@ -0,0 +1,265 @@
+#include "LinkQuality.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+namespace pixhawk {
+
+namespace {
+
+constexpr double JITTER_GAIN = 1.0 / 16.0;     // RFC 3550
+// A sender clock stepping back or jumping further than this was reset or wrapped
+constexpr int64_t CLOCK_BACKSTEP_MS = 1000;
+constexpr double CLOCK_JUMP_MS = 10000.0;
+constexpr int64_t MAX_GAP_32 = 1 << 16;
+
+// Histogram bucket of a gap: its bit width, so [2^(i-1), 2^i) lands in i
+size_t intervalBucket(int64_t gapUs) {
+    uint64_t ms = static_cast<uint64_t>(std::max<int64_t>(gapUs, 0)) / 1000;
+    size_t bucket = 0;
+    while (ms != 0 && bucket < LinkStats::HISTOGRAM_BUCKETS - 1) {
+        ms >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void addCounts(SequenceCounts& total, const SequenceCounts& counts) {
+    total.received += counts.received;
+    total.lost += counts.lost;
+    total.duplicates += counts.duplicates;
+    total.reordered += counts.reordered;
+    total.resyncs += counts.resyncs;
+}
+
+} // namespace
+
+SequenceTracker::SequenceTracker(int bits) {
+    bits = std::clamp(bits, 8, 32);
+    mask = bits == 32 ? UINT32_MAX : (1u << bits) - 1u;
+    // Beyond half the sequence space a jump cannot be told from one back
+    maxGap = std::min<int64_t>(static_cast<int64_t>(mask / 2), MAX_GAP_32);
+}
+
+void SequenceTracker::update(uint32_t seq, SequenceCounts& counts) {
+    seq &= mask;
+    counts.received++;
+    if (!started) {
+        started = true;
+        highest = seq;
+        seen = 1;
+        return;
+    }
+
+    // Signed distance from the highest sequence number, modulo 2^bits
+    int64_t delta = static_cast<int64_t>((seq - highest) & mask);
+    if (delta > static_cast<int64_t>(mask / 2)) {
+        delta -= static_cast<int64_t>(mask) + 1;
+    }
+
+    if (delta > maxGap || delta <= -WINDOW) {
+        counts.resyncs++;
+        highest = seq;
+        seen = 1;
+    } else if (delta > 0) {
+        counts.lost += static_cast<uint64_t>(delta - 1);
+        seen = delta >= WINDOW ? 1 : (seen << delta) | 1u;
+        highest = seq;
+    } else if (delta == 0) {
+        counts.duplicates++;
+    } else {
+        const uint64_t bit = uint64_t{1} << -delta;
+        if (seen & bit) {
+            counts.duplicates++;
+        } else {
+            // Counted lost when the gap opened
+            seen |= bit;
+            counts.reordered++;
+            if (counts.lost > 0) counts.lost--;
+        }
+    }
+}
+
+LinkQuality::RateCounter::RateCounter() {
+    std::fill(std::begin(second), std::end(second), INT64_MIN);
+    std::fill(std::begin(count), std::end(count), 0);
+}
+
+void LinkQuality::RateCounter::add(int64_t nowSecond, uint64_t n) {
+    const auto bucket = static_cast<size_t>(nowSecond % static_cast<int64_t>(RATE_BUCKETS));
+    if (second[bucket] != nowSecond) {
+        second[bucket] = nowSecond;
+        count[bucket] = 0;
+    }
+    count[bucket] += n;
+}
+
+// Over the last RATE_WINDOW_S whole seconds; the current one is still filling
+double LinkQuality::RateCounter::rate(int64_t nowSecond) const {
+    uint64_t total = 0;
+    for (size_t i = 0; i < RATE_BUCKETS; i++) {
+        if (second[i] >= nowSecond - RATE_WINDOW_S && second[i] < nowSecond) {
+            total += count[i];
+        }
+    }
+    return static_cast<double>(total) / RATE_WINDOW_S;
+}
+
+LinkQuality::LinkQuality() = default;
+
+void LinkQuality::setSequenceBits(int32_t linkId, int bits) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Link* link = findLink(linkId, true);
+    if (link) {
+        resetLink(*link, linkId, bits);
+    }
+}
+
+void LinkQuality::recordFrame(int32_t linkId, int32_t sysid, int32_t compid, uint32_t seq,
+                              int64_t arrivalUs, uint32_t bytes) {
+    const int64_t nowSecond = arrivalUs / 1000000;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    Link* link = findLink(linkId, true);
+    if (!link) return;
+
+    if (link->totalMessages > 0) {
+        link->histogram[intervalBucket(arrivalUs - link->lastArrivalUs)]++;
+    }
+    link->bytes.add(nowSecond, bytes);
+    link->totalMessages++;
+    link->totalBytes += bytes;
+    link->lastArrivalUs = arrivalUs;
+
+    Sender* sender = findSender(*link, sysid, compid);
+    if (!sender) return;
+
+    sender->tracker.update(seq, sender->sequence);
+    sender->messages.add(nowSecond, 1);
+    sender->lastArrivalUs = arrivalUs;
+}
+
+void LinkQuality::recordMessage(int32_t linkId, int32_t sysid, int32_t compid, size_t typeIndex,
+                                int64_t sentMs, int64_t arrivalUs) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Link* link = findLink(linkId, true);
+    if (!link) return;
+
+    if (typeIndex < LinkStats::MESSAGE_TYPE_COUNT) {
+        link->messages[typeIndex].add(arrivalUs / 1000000, 1);
+    }
+
+    Sender* sender = findSender(*link, sysid, compid);
+    if (!sender) return;
+
+    // Variation of the one-way transit time; the clock offset cancels out.
+    // A sender clock that restarted or wrapped starts a new baseline.
+    if (sentMs < 0) return;
+    const double transitMs = static_cast<double>(arrivalUs) / 1000.0 - static_cast<double>(sentMs);
+    if (sender->hasTransit && sentMs > sender->lastSentMs - CLOCK_BACKSTEP_MS) {
+        const double difference = std::fabs(transitMs - sender->lastTransitMs);
+        if (difference < CLOCK_JUMP_MS) {
+            sender->jitterMs += (difference - sender->jitterMs) * JITTER_GAIN;
+        }
+    }
+    sender->lastSentMs = sentMs;
+    sender->lastTransitMs = transitMs;
+    sender->hasTransit = true;
+}
+
+void LinkQuality::removeLink(int32_t linkId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Link* link = findLink(linkId, false);
+    if (link) {
+        resetLink(*link, UNUSED, 32);
+    }
+}
+
+void LinkQuality::getLinkStats(int64_t nowUs, std::vector<LinkStats>& out) const {
+    const int64_t nowSecond = nowUs / 1000000;
+    out.clear();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const Link& link : links) {
+        if (link.linkId == UNUSED) continue;
+
+        LinkStats stats{};
+        stats.linkId = link.linkId;
+        for (const Sender& sender : link.senders) {
+            if (sender.sysid == UNUSED) break;
+            addCounts(stats.sequence, sender.sequence);
+            stats.jitter_ms = std::max(stats.jitter_ms, sender.jitterMs);
+        }
+        std::copy(std::begin(link.histogram), std::end(link.histogram), stats.interval_histogram);
+        for (size_t type = 0; type < LinkStats::MESSAGE_TYPE_COUNT; type++) {
+            stats.rate_hz[type] = link.messages[type].rate(nowSecond);
+        }
+        stats.bytes_per_s = link.bytes.rate(nowSecond);
+        stats.total_messages = link.totalMessages;
+        stats.total_bytes = link.totalBytes;
+        stats.last_arrival_ms = link.lastArrivalUs / 1000;
+        out.push_back(stats);
+    }
+}
+
+void LinkQuality::getSenderStats(int64_t nowUs, std::vector<LinkSenderStats>& out) const {
+    const int64_t nowSecond = nowUs / 1000000;
+    out.clear();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const Link& link : links) {
+        if (link.linkId == UNUSED) continue;
+        for (const Sender& sender : link.senders) {
+            if (sender.sysid == UNUSED) break;
+            out.push_back({link.linkId, sender.sysid, sender.compid, sender.sequence, sender.jitterMs,
+                           sender.messages.rate(nowSecond), sender.lastArrivalUs / 1000});
+        }
+    }
+}
+
+void LinkQuality::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (Link& link : links) {
+        resetLink(link, UNUSED, 32);
+    }
+}
+
+// Caller holds mutex; null once the link's sender table is full
+LinkQuality::Sender* LinkQuality::findSender(Link& link, int32_t sysid, int32_t compid) {
+    for (Sender& candidate : link.senders) {
+        if (candidate.sysid == sysid && candidate.compid == compid) {
+            return &candidate;
+        }
+        if (candidate.sysid == UNUSED) {
+            candidate = Sender{};
+            candidate.sysid = sysid;
+            candidate.compid = compid;
+            candidate.tracker = SequenceTracker(link.sequenceBits);
+            return &candidate;
+        }
+    }
+    return nullptr;
+}
+
+// Caller holds mutex
+LinkQuality::Link* LinkQuality::findLink(int32_t linkId, bool create) {
+    for (Link& link : links) {
+        if (link.linkId == linkId) return &link;
+    }
+    if (!create || linkId == UNUSED) return nullptr;
+    for (Link& link : links) {
+        if (link.linkId == UNUSED) {
+            resetLink(link, linkId, 32);
+            return &link;
+        }
+    }
+    return nullptr;
+}
+
+void LinkQuality::resetLink(Link& link, int32_t linkId, int sequenceBits) {
+    link = Link{};
+    link.linkId = linkId;
+    link.sequenceBits = sequenceBits;
+}
+
+} // namespace pixhawk
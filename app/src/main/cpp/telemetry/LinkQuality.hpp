@@ -0,0 +1,149 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace pixhawk {
+
+struct SequenceCounts {
+    uint64_t received = 0;
+    uint64_t lost = 0;          // skipped sequence numbers that never turned up
+    uint64_t duplicates = 0;
+    uint64_t reordered = 0;     // arrived after a later sequence number
+    uint64_t resyncs = 0;       // jumps too large to be loss, e.g. a sender reboot
+};
+
+// Sequence accounting for one sender: a replay-style window over the last
+// WINDOW sequence numbers below the highest seen tells duplicates from late
+// arrivals, and a late arrival takes back the loss counted for its gap.
+// Sequence numbers wrap at 2^bits.
+class SequenceTracker {
+public:
+    static constexpr int WINDOW = 64;
+
+    SequenceTracker() : SequenceTracker(32) {}
+    explicit SequenceTracker(int bits);
+
+    void update(uint32_t seq, SequenceCounts& counts);
+
+private:
+    uint32_t mask;
+    int64_t maxGap;             // larger forward jumps resync instead of counting loss
+    bool started = false;
+    uint32_t highest = 0;
+    uint64_t seen = 0;          // bit i: highest - i has arrived
+};
+
+struct LinkSenderStats {
+    int32_t linkId;
+    int32_t sysid;
+    int32_t compid;
+    SequenceCounts sequence;
+    double jitter_ms;           // RFC 3550 interarrival jitter of the sender's own timestamps
+    double rate_hz;             // frames
+    int64_t last_arrival_ms;
+};
+
+struct LinkStats {
+    static constexpr size_t HISTOGRAM_BUCKETS = 16;
+    static constexpr size_t MESSAGE_TYPE_COUNT = 4;
+
+    int32_t linkId;
+    SequenceCounts sequence;    // summed over the link's senders
+    double jitter_ms;           // worst of the link's senders
+    // Gaps between consecutive arrivals on the link: bucket 0 is under 1 ms,
+    // bucket i covers [2^(i-1), 2^i) ms and the last one everything longer
+    uint64_t interval_histogram[HISTOGRAM_BUCKETS];
+    double rate_hz[MESSAGE_TYPE_COUNT];     // decoded messages by MessageType
+    double bytes_per_s;
+    uint64_t total_messages;    // frames, decoded or not
+    uint64_t total_bytes;
+    int64_t last_arrival_ms;
+};
+
+// Per-link and per-sender quality of incoming telemetry: sequence loss,
+// duplicates and reordering, jitter, inter-arrival histogram, message
+// rates by type and byte throughput. A sender is one component of a
+// system, since each MAVLink component numbers its messages separately.
+// Every frame is accounted in constant time into fixed-size tables; rates
+// cover the last RATE_WINDOW_S whole seconds. Links and senders beyond the
+// table sizes are not tracked.
+class LinkQuality {
+public:
+    static constexpr size_t MAX_LINKS = 32;
+    static constexpr size_t MAX_SENDERS = 16;      // per link
+    static constexpr int RATE_WINDOW_S = 5;
+
+    LinkQuality();
+
+    // Width of the sequence numbers on a link, e.g. 8 for MAVLink; 32 by
+    // default. Resets the link's statistics.
+    void setSequenceBits(int32_t linkId, int bits);
+
+    // Every frame on the link, whether or not it was decoded, so each
+    // sequence number is seen; arrivalUs is the local steady clock
+    void recordFrame(int32_t linkId, int32_t sysid, int32_t compid, uint32_t seq,
+                     int64_t arrivalUs, uint32_t bytes);
+    // A decoded message, after its frame. sentMs is the sender's own clock,
+    // negative if the message carries none; jitter only counts messages
+    // that have it.
+    void recordMessage(int32_t linkId, int32_t sysid, int32_t compid, size_t typeIndex,
+                       int64_t sentMs, int64_t arrivalUs);
+
+    // Drops a closed link's statistics and frees its slot
+    void removeLink(int32_t linkId);
+
+    void getLinkStats(int64_t nowUs, std::vector<LinkStats>& links) const;
+    void getSenderStats(int64_t nowUs, std::vector<LinkSenderStats>& senders) const;
+
+    void clear();
+
+private:
+    static constexpr int32_t UNUSED = -1;
+    static constexpr size_t RATE_BUCKETS = RATE_WINDOW_S + 1;
+
+    // Counts per whole second in a ring of buckets
+    struct RateCounter {
+        int64_t second[RATE_BUCKETS];
+        uint64_t count[RATE_BUCKETS];
+
+        RateCounter();
+        void add(int64_t nowSecond, uint64_t n);
+        double rate(int64_t nowSecond) const;
+    };
+
+    struct Sender {
+        int32_t sysid = UNUSED;
+        int32_t compid = 0;
+        SequenceTracker tracker;
+        SequenceCounts sequence;
+        double jitterMs = 0.0;
+        double lastTransitMs = 0.0;
+        int64_t lastSentMs = 0;
+        bool hasTransit = false;
+        RateCounter messages;
+        int64_t lastArrivalUs = 0;
+    };
+
+    struct Link {
+        int32_t linkId = UNUSED;
+        int sequenceBits = 32;
+        Sender senders[MAX_SENDERS];
+        uint64_t histogram[LinkStats::HISTOGRAM_BUCKETS] = {};
+        RateCounter messages[LinkStats::MESSAGE_TYPE_COUNT];
+        RateCounter bytes;
+        uint64_t totalMessages = 0;
+        uint64_t totalBytes = 0;
+        int64_t lastArrivalUs = 0;
+    };
+
+    mutable std::mutex mutex;
+    Link links[MAX_LINKS];
+
+    Link* findLink(int32_t linkId, bool create);
+    Sender* findSender(Link& link, int32_t sysid, int32_t compid);
+    static void resetLink(Link& link, int32_t linkId, int sequenceBits);
+};
+
+} // namespace pixhawk
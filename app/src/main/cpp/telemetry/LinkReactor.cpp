@@ -0,0 +1,627 @@
+#include "LinkReactor.hpp"
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <termios.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef PIXHAWKCORE_VERBOSE
+#include <android/log.h>
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, "LinkReactor", __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, "LinkReactor", __VA_ARGS__)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#endif
+
+namespace pixhawk {
+
+namespace {
+
+constexpr uint64_t WAKE_ID = 0;                 // link ids start at 1
+constexpr int RECEIVE_BUFFER_BYTES = 1 << 20;   // absorbs bursts between wakeups
+
+struct BaudRate {
+    int baud;
+    speed_t speed;
+};
+
+constexpr BaudRate BAUD_RATES[] = {
+    {9600, B9600}, {19200, B19200}, {38400, B38400}, {57600, B57600},
+    {115200, B115200}, {230400, B230400}, {460800, B460800}, {500000, B500000},
+    {921600, B921600}, {1000000, B1000000}, {1500000, B1500000}, {2000000, B2000000},
+};
+
+bool resolve(const std::string& host, uint16_t port, int socketType, bool passive,
+             sockaddr_storage& address, socklen_t& length, std::string& error) {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = socketType;
+    hints.ai_flags = AI_NUMERICSERV | (passive ? AI_PASSIVE : 0);
+
+    addrinfo* result = nullptr;
+    const char* node = host.empty() || host == "*" ? nullptr : host.c_str();
+    const int status = getaddrinfo(node, std::to_string(port).c_str(), &hints, &result);
+    if (status != 0 || !result) {
+        error = std::string("cannot resolve ") + (node ? node : "address") + ": " + gai_strerror(status);
+        return false;
+    }
+    std::memcpy(&address, result->ai_addr, result->ai_addrlen);
+    length = result->ai_addrlen;
+    freeaddrinfo(result);
+    return true;
+}
+
+std::string formatAddress(const sockaddr_storage& address) {
+    char host[INET6_ADDRSTRLEN] = "?";
+    uint16_t port = 0;
+    if (address.ss_family == AF_INET) {
+        const auto& ipv4 = reinterpret_cast<const sockaddr_in&>(address);
+        inet_ntop(AF_INET, &ipv4.sin_addr, host, sizeof(host));
+        port = ntohs(ipv4.sin_port);
+        return std::string(host) + ":" + std::to_string(port);
+    }
+    if (address.ss_family == AF_INET6) {
+        const auto& ipv6 = reinterpret_cast<const sockaddr_in6&>(address);
+        inet_ntop(AF_INET6, &ipv6.sin6_addr, host, sizeof(host));
+        port = ntohs(ipv6.sin6_port);
+    }
+    return std::string("[") + host + "]:" + std::to_string(port);
+}
+
+std::string systemError(const char* what) {
+    return std::string(what) + ": " + std::strerror(errno);
+}
+
+// Socket of the address's family; -1 with 'error' set on failure
+int openSocket(const sockaddr_storage& address, int socketType, std::string& error) {
+    const int fd = socket(address.ss_family, socketType | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        error = systemError("socket");
+    }
+    return fd;
+}
+
+// "host:port" or "[v6 address]:port"
+bool splitHostPort(const std::string& text, std::string& host, uint16_t& port, std::string& error) {
+    size_t separator;
+    if (!text.empty() && text[0] == '[') {
+        const size_t close = text.find(']');
+        if (close == std::string::npos || close + 1 >= text.size() || text[close + 1] != ':') {
+            error = "bad address " + text;
+            return false;
+        }
+        host = text.substr(1, close - 1);
+        separator = close + 1;
+    } else {
+        separator = text.rfind(':');
+        if (separator == std::string::npos) {
+            error = "missing port in " + text;
+            return false;
+        }
+        host = text.substr(0, separator);
+    }
+
+    const std::string digits = text.substr(separator + 1);
+    char* end = nullptr;
+    const unsigned long value = std::strtoul(digits.c_str(), &end, 10);
+    if (digits.empty() || *end != '\0' || value > 65535) {
+        error = "bad port in " + text;
+        return false;
+    }
+    port = static_cast<uint16_t>(value);
+    return true;
+}
+
+} // namespace
+
+LinkReactor::LinkReactor(DataHandler handler, TickHandler tick, int tickIntervalMs)
+    : handler(std::move(handler)), tick(std::move(tick)), tickIntervalMs(std::max(tickIntervalMs, 1)) {
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epollFd < 0 || wakeFd < 0) {
+        LOGE("Reactor setup failed: %s", std::strerror(errno));
+    } else {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = WAKE_ID;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event);
+    }
+
+    arena.resize(std::max(BATCH_SIZE * DATAGRAM_BYTES, STREAM_BYTES));
+    for (size_t i = 0; i < BATCH_SIZE; i++) {
+        vectors[i].iov_base = arena.data() + i * DATAGRAM_BYTES;
+        vectors[i].iov_len = DATAGRAM_BYTES;
+        datagrams[i] = mmsghdr{};
+        datagrams[i].msg_hdr.msg_iov = &vectors[i];
+        datagrams[i].msg_hdr.msg_iovlen = 1;
+        datagrams[i].msg_hdr.msg_name = &senders[i];
+    }
+}
+
+LinkReactor::~LinkReactor() {
+    stop();
+    for (auto& entry : links) {
+        if (entry.second->fd >= 0) ::close(entry.second->fd);
+    }
+    if (wakeFd >= 0) ::close(wakeFd);
+    if (epollFd >= 0) ::close(epollFd);
+}
+
+bool LinkReactor::start() {
+    if (running.load()) {
+        return true;
+    }
+    if (epollFd < 0 || wakeFd < 0) {
+        return false;
+    }
+    // The loop may have ended on its own after an epoll failure
+    if (reactorThread.joinable()) {
+        reactorThread.join();
+    }
+
+    running.store(true);
+    try {
+        reactorThread = std::thread(&LinkReactor::reactorLoop, this);
+        return true;
+    } catch (const std::exception& e) {
+        LOGE("Failed to start reactor thread: %s", e.what());
+        running.store(false);
+        return false;
+    }
+}
+
+void LinkReactor::stop() {
+    running.store(false);
+    if (reactorThread.joinable()) {
+        const uint64_t one = 1;
+        if (write(wakeFd, &one, sizeof(one)) < 0) {
+            LOGE("Waking reactor failed: %s", std::strerror(errno));
+        }
+        reactorThread.join();
+    }
+}
+
+bool LinkReactor::isRunning() const {
+    return running.load();
+}
+
+int32_t LinkReactor::open(const std::string& uri, std::string& error) {
+    const size_t colon = uri.find(':');
+    if (colon == std::string::npos) {
+        error = "bad link " + uri;
+        return 0;
+    }
+    const std::string scheme = uri.substr(0, colon);
+
+    if (scheme == "serial") {
+        std::string path = uri.substr(colon + 1);
+        if (path.compare(0, 2, "//") == 0) path.erase(0, 2);
+        int baud = DEFAULT_BAUD;
+        // A trailing ":digits" after the last path component is the baud rate
+        const size_t separator = path.rfind(':');
+        if (separator != std::string::npos && separator > path.rfind('/') && separator + 1 < path.size() &&
+            std::all_of(path.begin() + static_cast<std::ptrdiff_t>(separator) + 1, path.end(),
+                        [](char c) { return c >= '0' && c <= '9'; })) {
+            baud = std::atoi(path.c_str() + separator + 1);
+            path.erase(separator);
+        }
+        return openSerial(path, baud, error);
+    }
+
+    if (uri.compare(colon, 3, "://") != 0) {
+        error = "bad link " + uri;
+        return 0;
+    }
+    std::string host;
+    uint16_t port = 0;
+    if (!splitHostPort(uri.substr(colon + 3), host, port, error)) {
+        return 0;
+    }
+    if (scheme == "udp") return openUdpListen(host, port, error);
+    if (scheme == "udpout") return openUdpConnect(host, port, error);
+    if (scheme == "tcp") return openTcpClient(host, port, error);
+    if (scheme == "tcpserver") return openTcpServer(host, port, error);
+    error = "unknown link type " + scheme;
+    return 0;
+}
+
+int32_t LinkReactor::openUdpListen(const std::string& address, uint16_t port, std::string& error) {
+    sockaddr_storage local{};
+    socklen_t length = 0;
+    if (!resolve(address, port, SOCK_DGRAM, true, local, length, error)) return 0;
+    const int fd = openSocket(local, SOCK_DGRAM, error);
+    if (fd < 0) return 0;
+
+    const int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &RECEIVE_BUFFER_BYTES, sizeof(RECEIVE_BUFFER_BYTES));
+    if (bind(fd, reinterpret_cast<const sockaddr*>(&local), length) != 0) {
+        error = systemError("bind");
+        ::close(fd);
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return add(LinkType::UDP_LISTEN, fd, formatAddress(local), 0, false, error);
+}
+
+int32_t LinkReactor::openUdpConnect(const std::string& host, uint16_t port, std::string& error) {
+    sockaddr_storage remote{};
+    socklen_t length = 0;
+    if (!resolve(host, port, SOCK_DGRAM, false, remote, length, error)) return 0;
+    const int fd = openSocket(remote, SOCK_DGRAM, error);
+    if (fd < 0) return 0;
+
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &RECEIVE_BUFFER_BYTES, sizeof(RECEIVE_BUFFER_BYTES));
+    if (connect(fd, reinterpret_cast<const sockaddr*>(&remote), length) != 0) {
+        error = systemError("connect");
+        ::close(fd);
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return add(LinkType::UDP_CONNECT, fd, formatAddress(remote), 0, false, error);
+}
+
+int32_t LinkReactor::openTcpClient(const std::string& host, uint16_t port, std::string& error) {
+    sockaddr_storage remote{};
+    socklen_t length = 0;
+    if (!resolve(host, port, SOCK_STREAM, false, remote, length, error)) return 0;
+    const int fd = openSocket(remote, SOCK_STREAM, error);
+    if (fd < 0) return 0;
+
+    const int on = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    // Non-blocking, so the handshake finishes on the reactor thread
+    bool connecting = false;
+    if (connect(fd, reinterpret_cast<const sockaddr*>(&remote), length) != 0) {
+        if (errno != EINPROGRESS) {
+            error = systemError("connect");
+            ::close(fd);
+            return 0;
+        }
+        connecting = true;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return add(LinkType::TCP_CLIENT, fd, formatAddress(remote), 0, connecting, error);
+}
+
+int32_t LinkReactor::openTcpServer(const std::string& address, uint16_t port, std::string& error) {
+    sockaddr_storage local{};
+    socklen_t length = 0;
+    if (!resolve(address, port, SOCK_STREAM, true, local, length, error)) return 0;
+    const int fd = openSocket(local, SOCK_STREAM, error);
+    if (fd < 0) return 0;
+
+    const int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    if (bind(fd, reinterpret_cast<const sockaddr*>(&local), length) != 0 || listen(fd, SOMAXCONN) != 0) {
+        error = systemError("listen");
+        ::close(fd);
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return add(LinkType::TCP_SERVER, fd, formatAddress(local), 0, false, error);
+}
+
+int32_t LinkReactor::openSerial(const std::string& path, int baud, std::string& error) {
+    const BaudRate* rate = nullptr;
+    for (const BaudRate& candidate : BAUD_RATES) {
+        if (candidate.baud == baud) rate = &candidate;
+    }
+    if (!rate) {
+        error = "unsupported baud rate " + std::to_string(baud);
+        return 0;
+    }
+
+    const int fd = ::open(path.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        error = systemError(path.c_str());
+        return 0;
+    }
+
+    // Raw 8N1: no line editing, echo or translation of the binary stream
+    termios options{};
+    if (tcgetattr(fd, &options) != 0) {
+        error = systemError(path.c_str());
+        ::close(fd);
+        return 0;
+    }
+    cfmakeraw(&options);
+    options.c_cflag |= CLOCAL | CREAD;
+    cfsetispeed(&options, rate->speed);
+    cfsetospeed(&options, rate->speed);
+    if (tcsetattr(fd, TCSANOW, &options) != 0) {
+        error = systemError(path.c_str());
+        ::close(fd);
+        return 0;
+    }
+    tcflush(fd, TCIFLUSH);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return add(LinkType::SERIAL, fd, path + ":" + std::to_string(baud), 0, false, error);
+}
+
+bool LinkReactor::close(int32_t linkId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = links.find(linkId);
+    if (it == links.end()) {
+        return false;
+    }
+    Link& link = *it->second;
+    if (link.fd >= 0) {
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, link.fd, nullptr);
+        ::close(link.fd);
+    }
+    links.erase(it);
+    return true;
+}
+
+bool LinkReactor::send(int32_t linkId, const uint8_t* data, size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = links.find(linkId);
+    if (it == links.end()) {
+        return false;
+    }
+    const Link& link = *it->second;
+    if (!link.open || link.connecting) {
+        return false;
+    }
+
+    ssize_t written = -1;
+    switch (link.type) {
+        case LinkType::UDP_LISTEN:
+            if (link.peerLength == 0) return false;
+            written = sendto(link.fd, data, size, MSG_DONTWAIT | MSG_NOSIGNAL,
+                             reinterpret_cast<const sockaddr*>(&link.peer), link.peerLength);
+            break;
+        case LinkType::UDP_CONNECT:
+        case LinkType::TCP_CLIENT:
+        case LinkType::TCP_ACCEPTED:
+            written = ::send(link.fd, data, size, MSG_DONTWAIT | MSG_NOSIGNAL);
+            break;
+        case LinkType::SERIAL:
+            written = write(link.fd, data, size);
+            break;
+        case LinkType::TCP_SERVER:
+            return false;
+    }
+    return written == static_cast<ssize_t>(size);
+}
+
+std::vector<LinkInfo> LinkReactor::getLinks() const {
+    std::vector<LinkInfo> result;
+    std::lock_guard<std::mutex> lock(mutex);
+    result.reserve(links.size());
+    for (const auto& entry : links) {
+        const Link& link = *entry.second;
+        result.push_back({link.id, link.type, link.endpoint, link.parentId, link.open, link.error,
+                          link.bytes, link.packets, link.reads});
+    }
+    std::sort(result.begin(), result.end(), [](const LinkInfo& a, const LinkInfo& b) { return a.id < b.id; });
+    return result;
+}
+
+size_t LinkReactor::getLinkCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return links.size();
+}
+
+uint16_t LinkReactor::getLocalPort(int32_t linkId) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = links.find(linkId);
+    if (it == links.end() || it->second->type == LinkType::SERIAL || it->second->fd < 0) {
+        return 0;
+    }
+    sockaddr_storage local{};
+    socklen_t length = sizeof(local);
+    if (getsockname(it->second->fd, reinterpret_cast<sockaddr*>(&local), &length) != 0) {
+        return 0;
+    }
+    if (local.ss_family == AF_INET) return ntohs(reinterpret_cast<const sockaddr_in&>(local).sin_port);
+    if (local.ss_family == AF_INET6) return ntohs(reinterpret_cast<const sockaddr_in6&>(local).sin6_port);
+    return 0;
+}
+
+const char* LinkReactor::typeName(LinkType type) {
+    switch (type) {
+        case LinkType::UDP_LISTEN: return "udp";
+        case LinkType::UDP_CONNECT: return "udpout";
+        case LinkType::TCP_CLIENT: return "tcp";
+        case LinkType::TCP_SERVER: return "tcpserver";
+        case LinkType::TCP_ACCEPTED: return "tcpaccepted";
+        case LinkType::SERIAL: return "serial";
+    }
+    return "unknown";
+}
+
+void LinkReactor::reactorLoop() {
+    LOGI("Reactor thread started");
+    using Clock = std::chrono::steady_clock;
+    const auto interval = std::chrono::milliseconds(tickIntervalMs);
+    auto nextTick = Clock::now() + interval;
+    epoll_event events[MAX_EVENTS];
+
+    while (running.load()) {
+        int timeout = -1;
+        if (tick) {
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(nextTick - Clock::now());
+            timeout = static_cast<int>(std::max<int64_t>(remaining.count(), 0));
+        }
+
+        const int count = epoll_wait(epollFd, events, MAX_EVENTS, timeout);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            LOGE("epoll_wait failed: %s", std::strerror(errno));
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (int i = 0; i < count; i++) {
+                if (events[i].data.u64 == WAKE_ID) {
+                    uint64_t value;
+                    while (read(wakeFd, &value, sizeof(value)) > 0) {}
+                    continue;
+                }
+                // Closed since epoll_wait returned
+                auto it = links.find(static_cast<int32_t>(events[i].data.u64));
+                if (it == links.end() || !it->second->open) continue;
+                handleEvent(*it->second, events[i].events);
+            }
+        }
+
+        if (tick && Clock::now() >= nextTick) {
+            tick();
+            nextTick = Clock::now() + interval;
+        }
+    }
+
+    LOGI("Reactor thread ended");
+}
+
+// Caller holds mutex. Takes ownership of fd, closing it on failure.
+int32_t LinkReactor::add(LinkType type, int fd, const std::string& endpoint, int32_t parentId,
+                         bool connecting, std::string& error) {
+    const int32_t id = nextId++;
+    epoll_event event{};
+    event.events = connecting ? EPOLLOUT : EPOLLIN;
+    event.data.u64 = static_cast<uint64_t>(id);
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        error = systemError("epoll_ctl");
+        ::close(fd);
+        return 0;
+    }
+
+    auto link = std::make_unique<Link>();
+    link->id = id;
+    link->type = type;
+    link->fd = fd;
+    link->endpoint = endpoint;
+    link->parentId = parentId;
+    link->connecting = connecting;
+    links.emplace(id, std::move(link));
+    LOGI("Opened %s link %d: %s", typeName(type), id, endpoint.c_str());
+    return id;
+}
+
+// Caller holds mutex
+void LinkReactor::handleEvent(Link& link, uint32_t events) {
+    if (link.connecting) {
+        int status = 0;
+        socklen_t length = sizeof(status);
+        getsockopt(link.fd, SOL_SOCKET, SO_ERROR, &status, &length);
+        if (status != 0) {
+            disconnect(link, std::string("connect: ") + std::strerror(status));
+            return;
+        }
+        link.connecting = false;
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = static_cast<uint64_t>(link.id);
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, link.fd, &event);
+        return;
+    }
+
+    switch (link.type) {
+        case LinkType::UDP_LISTEN:
+        case LinkType::UDP_CONNECT:
+            readDatagrams(link);
+            break;
+        case LinkType::TCP_SERVER:
+            acceptConnections(link);
+            break;
+        case LinkType::TCP_CLIENT:
+        case LinkType::TCP_ACCEPTED:
+        case LinkType::SERIAL:
+            readStream(link);
+            break;
+    }
+}
+
+// Caller holds mutex
+void LinkReactor::readDatagrams(Link& link) {
+    for (size_t i = 0; i < BATCH_SIZE; i++) {
+        datagrams[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+    }
+    // One batch per wakeup; anything left keeps the socket ready
+    const int count = recvmmsg(link.fd, datagrams, BATCH_SIZE, MSG_DONTWAIT, nullptr);
+    link.reads++;
+    if (count < 0) {
+        // A connected peer that is not listening yet reports ECONNREFUSED
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR && errno != ECONNREFUSED) {
+            disconnect(link, systemError("recvmmsg"));
+        }
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        const size_t size = datagrams[i].msg_len;
+        link.packets++;
+        link.bytes += size;
+        handler(link.id, arena.data() + static_cast<size_t>(i) * DATAGRAM_BYTES, size);
+    }
+    if (link.type == LinkType::UDP_LISTEN && count > 0) {
+        link.peer = senders[count - 1];
+        link.peerLength = datagrams[count - 1].msg_hdr.msg_namelen;
+    }
+}
+
+// Caller holds mutex
+void LinkReactor::readStream(Link& link) {
+    const ssize_t size = read(link.fd, arena.data(), STREAM_BYTES);
+    link.reads++;
+    if (size > 0) {
+        link.packets++;
+        link.bytes += static_cast<uint64_t>(size);
+        handler(link.id, arena.data(), static_cast<size_t>(size));
+    } else if (size == 0) {
+        disconnect(link, "closed by peer");
+    } else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+        disconnect(link, systemError("read"));
+    }
+}
+
+// Caller holds mutex
+void LinkReactor::acceptConnections(Link& link) {
+    for (;;) {
+        sockaddr_storage peer{};
+        socklen_t length = sizeof(peer);
+        const int fd = accept4(link.fd, reinterpret_cast<sockaddr*>(&peer), &length, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR && errno != ECONNABORTED) {
+                LOGE("accept on link %d failed: %s", link.id, std::strerror(errno));
+            }
+            return;
+        }
+        std::string error;
+        if (add(LinkType::TCP_ACCEPTED, fd, formatAddress(peer), link.id, false, error) == 0) {
+            LOGE("Dropping connection on link %d: %s", link.id, error.c_str());
+        }
+    }
+}
+
+// Caller holds mutex. The link stays listed, closed, until close() removes it.
+void LinkReactor::disconnect(Link& link, const std::string& reason) {
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, link.fd, nullptr);
+    ::close(link.fd);
+    link.fd = -1;
+    link.open = false;
+    link.connecting = false;
+    link.error = reason;
+    LOGI("Link %d closed: %s", link.id, reason.c_str());
+}
+
+} // namespace pixhawk
@@ -0,0 +1,144 @@
+#pragma once
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace pixhawk {
+
+enum class LinkType {
+    UDP_LISTEN,
+    UDP_CONNECT,
+    TCP_CLIENT,
+    TCP_SERVER,
+    TCP_ACCEPTED,       // connection taken by a TCP_SERVER link
+    SERIAL
+};
+
+struct LinkInfo {
+    int32_t id;
+    LinkType type;
+    std::string endpoint;
+    int32_t parentId;           // the server of an accepted connection, else 0
+    bool open;                  // false once the peer hung up or a read failed
+    std::string error;
+    uint64_t bytes;
+    uint64_t packets;           // datagrams, or reads on stream links
+    uint64_t reads;             // system calls; fewer than packets when batched
+};
+
+// Single-threaded epoll reactor owning the telemetry links: UDP listen and
+// connect, TCP client and server, and serial or pseudo-terminal devices.
+// Datagrams are taken in batches with recvmmsg and stream links in one
+// read per wakeup, into a receive arena allocated once; the handler gets
+// pointers into it, valid until it returns. Ready links are served one
+// read each per wakeup, so a busy link cannot starve the others.
+//
+// Links can be opened and closed from any thread. The handlers run on the
+// reactor thread with the link table locked, so they must not call back
+// into the reactor; once close() returns, the link's handler no longer runs.
+class LinkReactor {
+public:
+    static constexpr size_t BATCH_SIZE = 32;            // datagrams per recvmmsg
+    static constexpr size_t DATAGRAM_BYTES = 2048;
+    static constexpr size_t STREAM_BYTES = 65536;
+    static constexpr int MAX_EVENTS = 64;
+    static constexpr int DEFAULT_BAUD = 57600;
+
+    using DataHandler = std::function<void(int32_t linkId, const uint8_t* data, size_t size)>;
+    using TickHandler = std::function<void()>;
+
+    // 'tick' runs on the reactor thread about every tickIntervalMs
+    explicit LinkReactor(DataHandler handler, TickHandler tick = {}, int tickIntervalMs = 100);
+    ~LinkReactor();
+
+    LinkReactor(const LinkReactor&) = delete;
+    LinkReactor& operator=(const LinkReactor&) = delete;
+
+    bool start();
+    void stop();
+    bool isRunning() const;
+
+    // Opens a link from a URI and returns its id (from 1), or 0 with a
+    // message in 'error':
+    //   udp://[address]:port        listen for datagrams (address defaults to any)
+    //   udpout://host:port          send to and receive from one peer
+    //   tcp://host:port             connect
+    //   tcpserver://[address]:port  accept connections, each becoming a link
+    //   serial:/dev/ttyS1[:baud]    serial device or pseudo-terminal, raw mode
+    int32_t open(const std::string& uri, std::string& error);
+
+    int32_t openUdpListen(const std::string& address, uint16_t port, std::string& error);
+    int32_t openUdpConnect(const std::string& host, uint16_t port, std::string& error);
+    int32_t openTcpClient(const std::string& host, uint16_t port, std::string& error);
+    int32_t openTcpServer(const std::string& address, uint16_t port, std::string& error);
+    int32_t openSerial(const std::string& path, int baud, std::string& error);
+
+    bool close(int32_t linkId);
+
+    // Writes to a link: the peer of a connected or stream link, or the last
+    // sender on a listening UDP link. False if it could not be sent whole.
+    bool send(int32_t linkId, const uint8_t* data, size_t size);
+
+    std::vector<LinkInfo> getLinks() const;
+    size_t getLinkCount() const;
+    // Bound port of a socket link, e.g. after listening on port 0; 0 if none
+    uint16_t getLocalPort(int32_t linkId) const;
+
+    static const char* typeName(LinkType type);
+
+private:
+    struct Link {
+        int32_t id;
+        LinkType type;
+        int fd;
+        std::string endpoint;
+        int32_t parentId = 0;
+        bool open = true;
+        bool connecting = false;        // TCP client waiting for the handshake
+        std::string error;
+        uint64_t bytes = 0;
+        uint64_t packets = 0;
+        uint64_t reads = 0;
+        sockaddr_storage peer{};        // last sender on a listening UDP link
+        socklen_t peerLength = 0;
+    };
+
+    DataHandler handler;
+    TickHandler tick;
+    int tickIntervalMs;
+
+    int epollFd = -1;
+    int wakeFd = -1;
+    std::atomic<bool> running{false};
+    std::thread reactorThread;
+
+    mutable std::mutex mutex;
+    std::unordered_map<int32_t, std::unique_ptr<Link>> links;
+    int32_t nextId = 1;
+
+    // Receive arena and the recvmmsg headers pointing into it; reactor thread only
+    std::vector<uint8_t> arena;
+    mmsghdr datagrams[BATCH_SIZE];
+    iovec vectors[BATCH_SIZE];
+    sockaddr_storage senders[BATCH_SIZE];
+
+    void reactorLoop();
+    int32_t add(LinkType type, int fd, const std::string& endpoint, int32_t parentId,
+                bool connecting, std::string& error);
+    void handleEvent(Link& link, uint32_t events);
+    void readDatagrams(Link& link);
+    void readStream(Link& link);
+    void acceptConnections(Link& link);
+    void disconnect(Link& link, const std::string& reason);
+};
+
+} // namespace pixhawk
@@ -0,0 +1,347 @@
+#include "MavlinkDecoder.hpp"
+#include "TelemetryEngine.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+
+namespace pixhawk {
+
+namespace {
+
+constexpr uint8_t MAGIC_V1 = 0xFE;
+constexpr uint8_t MAGIC_V2 = 0xFD;
+constexpr size_t HEADER_V1 = 6;
+constexpr size_t HEADER_V2 = 10;
+constexpr size_t CHECKSUM_BYTES = 2;
+constexpr size_t SIGNATURE_BYTES = 13;
+constexpr uint8_t INCOMPAT_SIGNED = 0x01;
+
+constexpr uint32_t MSG_HEARTBEAT = 0;
+constexpr uint32_t MSG_SYS_STATUS = 1;
+constexpr uint32_t MSG_ATTITUDE = 30;
+constexpr uint32_t MSG_GLOBAL_POSITION_INT = 33;
+
+constexpr uint8_t MAV_AUTOPILOT_INVALID = 8;
+constexpr uint8_t MAV_MODE_FLAG_SAFETY_ARMED = 0x80;
+constexpr double RAD_TO_DEG = 180.0 / M_PI;
+
+// Checksum seed and MAVLink 1 payload length of the common messages and
+// the ArduPilot ones autopilots stream by default, sorted by id; the seed
+// folds in the message definition, so frames of other versions fail
+struct MessageInfo {
+    uint32_t id;
+    uint8_t crcExtra;
+    uint8_t length;
+};
+
+constexpr MessageInfo MESSAGES[] = {
+    {MSG_HEARTBEAT, 50, 9},
+    {MSG_SYS_STATUS, 124, 31},
+    {2, 137, 12},  // SYSTEM_TIME
+    {4, 237, 14},  // PING
+    {11, 89, 6},  // SET_MODE
+    {20, 214, 20},  // PARAM_REQUEST_READ
+    {21, 159, 2},  // PARAM_REQUEST_LIST
+    {22, 220, 25},  // PARAM_VALUE
+    {23, 168, 23},  // PARAM_SET
+    {24, 24, 30},  // GPS_RAW_INT
+    {25, 23, 101},  // GPS_STATUS
+    {26, 170, 22},  // SCALED_IMU
+    {27, 144, 26},  // RAW_IMU
+    {28, 67, 16},  // RAW_PRESSURE
+    {29, 115, 14},  // SCALED_PRESSURE
+    {MSG_ATTITUDE, 39, 28},
+    {31, 246, 32},  // ATTITUDE_QUATERNION
+    {32, 185, 28},  // LOCAL_POSITION_NED
+    {MSG_GLOBAL_POSITION_INT, 104, 28},
+    {34, 237, 22},  // RC_CHANNELS_SCALED
+    {35, 244, 22},  // RC_CHANNELS_RAW
+    {36, 222, 21},  // SERVO_OUTPUT_RAW
+    {39, 254, 37},  // MISSION_ITEM
+    {40, 230, 4},  // MISSION_REQUEST
+    {41, 28, 4},  // MISSION_SET_CURRENT
+    {42, 28, 2},  // MISSION_CURRENT
+    {43, 132, 2},  // MISSION_REQUEST_LIST
+    {44, 221, 4},  // MISSION_COUNT
+    {45, 232, 2},  // MISSION_CLEAR_ALL
+    {46, 11, 2},  // MISSION_ITEM_REACHED
+    {47, 153, 3},  // MISSION_ACK
+    {49, 39, 12},  // GPS_GLOBAL_ORIGIN
+    {51, 196, 4},  // MISSION_REQUEST_INT
+    {62, 183, 26},  // NAV_CONTROLLER_OUTPUT
+    {65, 118, 42},  // RC_CHANNELS
+    {66, 148, 6},  // REQUEST_DATA_STREAM
+    {69, 243, 11},  // MANUAL_CONTROL
+    {70, 124, 18},  // RC_CHANNELS_OVERRIDE
+    {73, 38, 37},  // MISSION_ITEM_INT
+    {74, 20, 20},  // VFR_HUD
+    {75, 158, 35},  // COMMAND_INT
+    {76, 152, 33},  // COMMAND_LONG
+    {77, 143, 3},  // COMMAND_ACK
+    {83, 22, 37},  // ATTITUDE_TARGET
+    {85, 140, 51},  // POSITION_TARGET_LOCAL_NED
+    {87, 150, 51},  // POSITION_TARGET_GLOBAL_INT
+    {105, 93, 62},  // HIGHRES_IMU
+    {109, 185, 9},  // RADIO_STATUS
+    {111, 34, 16},  // TIMESYNC
+    {116, 76, 22},  // SCALED_IMU2
+    {124, 87, 35},  // GPS2_RAW
+    {125, 203, 6},  // POWER_STATUS
+    {129, 46, 22},  // SCALED_IMU3
+    {132, 85, 14},  // DISTANCE_SENSOR
+    {136, 1, 22},  // TERRAIN_REPORT
+    {137, 195, 14},  // SCALED_PRESSURE2
+    {141, 47, 32},  // ALTITUDE
+    {147, 154, 36},  // BATTERY_STATUS
+    {148, 178, 60},  // AUTOPILOT_VERSION
+    {152, 208, 4},  // MEMINFO
+    {163, 127, 28},  // AHRS
+    {165, 21, 3},  // HWSTATUS
+    {168, 1, 12},  // WIND
+    {173, 83, 8},  // RANGEFINDER
+    {178, 47, 24},  // AHRS2
+    {193, 71, 22},  // EKF_STATUS_REPORT
+    {194, 98, 25},  // PID_TUNING
+    {230, 163, 42},  // ESTIMATOR_STATUS
+    {241, 90, 32},  // VIBRATION
+    {242, 104, 52},  // HOME_POSITION
+    {245, 130, 2},  // EXTENDED_SYS_STATE
+    {246, 184, 38},  // ADSB_VEHICLE
+    {253, 83, 51},  // STATUSTEXT
+};
+
+constexpr bool sortedById() {
+    for (size_t i = 1; i < std::size(MESSAGES); i++) {
+        if (MESSAGES[i - 1].id >= MESSAGES[i].id) return false;
+    }
+    return true;
+}
+static_assert(sortedById(), "message table sorted by id");
+
+constexpr size_t MAX_PAYLOAD_BYTES = 255;
+
+const MessageInfo* findMessage(uint32_t id) {
+    const MessageInfo* it = std::lower_bound(std::begin(MESSAGES), std::end(MESSAGES), id,
+        [](const MessageInfo& info, uint32_t key) { return info.id < key; });
+    return it != std::end(MESSAGES) && it->id == id ? it : nullptr;
+}
+
+// CRC-16/MCRF4XX, the X.25 checksum MAVLink uses
+uint16_t crcAccumulate(uint8_t byte, uint16_t crc) {
+    uint8_t tmp = static_cast<uint8_t>(byte ^ (crc & 0xFF));
+    tmp = static_cast<uint8_t>(tmp ^ (tmp << 4));
+    return static_cast<uint16_t>((crc >> 8) ^ (tmp << 8) ^ (tmp << 3) ^ (tmp >> 4));
+}
+
+uint16_t readU16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t readU32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+int32_t readI32(const uint8_t* p) {
+    return static_cast<int32_t>(readU32(p));
+}
+
+float readFloat(const uint8_t* p) {
+    const uint32_t bits = readU32(p);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // namespace
+
+MavlinkDecoder::MavlinkDecoder(int32_t linkId) : linkId(linkId) {}
+
+void MavlinkDecoder::feed(const uint8_t* data, size_t size, int64_t nowMs,
+                          const FrameHandler& onFrame, const MessageHandler& onMessage) {
+    size_t offset = 0;
+    size_t length = 0;
+
+    // Finish the frame split across the previous read first, topping the
+    // carry buffer up only with the bytes it still needs
+    while (carrySize > 0) {
+        const Parse result = parse(carry, carrySize, length);
+        if (result == Parse::NEED_MORE) {
+            if (offset == size) return;
+            const size_t take = std::min(length - carrySize, size - offset);
+            std::memcpy(carry + carrySize, data + offset, take);
+            carrySize += take;
+            offset += take;
+            continue;
+        }
+        if (result == Parse::FRAME) {
+            decode(carry, length, nowMs, onFrame, onMessage);
+        } else {
+            stats.droppedBytes += length;
+        }
+        carrySize -= length;
+        std::memmove(carry, carry + length, carrySize);
+    }
+
+    // Then straight out of the caller's buffer
+    while (offset < size) {
+        const Parse result = parse(data + offset, size - offset, length);
+        if (result == Parse::NEED_MORE) {
+            carrySize = size - offset;
+            std::memcpy(carry, data + offset, carrySize);
+            return;
+        }
+        if (result == Parse::FRAME) {
+            decode(data + offset, length, nowMs, onFrame, onMessage);
+        } else {
+            stats.droppedBytes += length;
+        }
+        offset += length;
+    }
+}
+
+MavlinkDecoder::Parse MavlinkDecoder::parse(const uint8_t* data, size_t size, size_t& length) {
+    if (data[0] != MAGIC_V1 && data[0] != MAGIC_V2) {
+        // Skip to the next possible frame start
+        length = 1;
+        while (length < size && data[length] != MAGIC_V1 && data[length] != MAGIC_V2) {
+            length++;
+        }
+        return Parse::BAD;
+    }
+
+    const bool v2 = data[0] == MAGIC_V2;
+    const size_t header = v2 ? HEADER_V2 : HEADER_V1;
+    if (size < 3) {
+        length = 3;
+        return Parse::NEED_MORE;
+    }
+    // Incompatibility flags this decoder does not know make it no frame
+    if (v2 && (data[2] & ~INCOMPAT_SIGNED)) {
+        length = 1;
+        return Parse::BAD;
+    }
+    const size_t payloadLength = data[1];
+    const size_t frameLength = header + payloadLength + CHECKSUM_BYTES +
+                               (v2 && (data[2] & INCOMPAT_SIGNED) ? SIGNATURE_BYTES : 0);
+    if (size < frameLength) {
+        length = frameLength;
+        return Parse::NEED_MORE;
+    }
+
+    const uint32_t id = v2 ? data[7] | (data[8] << 8) | (static_cast<uint32_t>(data[9]) << 16) : data[5];
+    const MessageInfo* info = findMessage(id);
+    if (!info) {
+        // Without the seed the checksum cannot be verified; the length is
+        // trusted only when another frame starts right after it
+        if (size < frameLength + 1) {
+            length = frameLength + 1;
+            return Parse::NEED_MORE;
+        }
+        if (data[frameLength] != MAGIC_V1 && data[frameLength] != MAGIC_V2) {
+            length = 1;
+            return Parse::BAD;
+        }
+        stats.unknown++;
+        length = frameLength;
+        return Parse::FRAME;
+    }
+    length = 1;
+    // MAVLink 1 payloads are never truncated or extended
+    if (!v2 && payloadLength != info->length) {
+        return Parse::BAD;
+    }
+
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 1; i < header + payloadLength; i++) {
+        crc = crcAccumulate(data[i], crc);
+    }
+    crc = crcAccumulate(info->crcExtra, crc);
+    if (crc != readU16(data + header + payloadLength)) {
+        stats.crcErrors++;
+        return Parse::BAD;
+    }
+
+    stats.frames++;
+    length = frameLength;
+    return Parse::FRAME;
+}
+
+void MavlinkDecoder::decode(const uint8_t* frame, size_t length, int64_t nowMs,
+                            const FrameHandler& onFrame, const MessageHandler& onMessage) {
+    const bool v2 = frame[0] == MAGIC_V2;
+    const size_t payloadLength = frame[1];
+    const uint32_t id = v2 ? frame[7] | (frame[8] << 8) | (static_cast<uint32_t>(frame[9]) << 16) : frame[5];
+    const MessageInfo* info = findMessage(id);
+
+    FrameHeader header;
+    header.seq = v2 ? frame[4] : frame[2];
+    header.sysid = v2 ? frame[5] : frame[3];
+    header.compid = v2 ? frame[6] : frame[4];
+    header.msgid = id;
+    header.length = static_cast<uint32_t>(length);
+    onFrame(header);
+    if (!info) return;
+
+    // MAVLink 2 drops trailing zero bytes of the payload; extensions past
+    // the MAVLink 1 fields are not used
+    const size_t copied = std::min<size_t>(payloadLength, info->length);
+    uint8_t payload[MAX_PAYLOAD_BYTES];
+    std::memcpy(payload, frame + (v2 ? HEADER_V2 : HEADER_V1), copied);
+    std::memset(payload + copied, 0, info->length - copied);
+
+    TelemetryMessage msg;
+    msg.timestamp_ms = nowMs;
+    msg.seq = static_cast<int32_t>(header.seq);
+    msg.sysid = header.sysid;
+    msg.compid = header.compid;
+    msg.linkId = linkId;
+    msg.length = header.length;
+
+    // Once a system's flight controller is known, its other components
+    // (gimbal, camera, companion computer) do not speak for the vehicle
+    uint8_t& autopilot = autopilotCompid[header.sysid & 0xFF];
+    if (id != MSG_HEARTBEAT && autopilot != 0 && autopilot != header.compid) return;
+
+    switch (id) {
+        case MSG_HEARTBEAT:
+            // Ground stations, gimbals and companion computers send
+            // MAV_AUTOPILOT_INVALID; only the flight controller's heartbeat
+            // carries the vehicle's armed state and mode
+            if (payload[5] == MAV_AUTOPILOT_INVALID) return;
+            autopilot = static_cast<uint8_t>(header.compid);
+            msg.type = MessageType::HEARTBEAT;
+            msg.data.armed = (payload[6] & MAV_MODE_FLAG_SAFETY_ARMED) != 0;
+            std::snprintf(msg.data.mode, sizeof(msg.data.mode), "%u", readU32(payload));
+            break;
+        case MSG_SYS_STATUS:
+            msg.type = MessageType::BATTERY;
+            msg.data.voltage = readU16(payload + 14) / 1000.0;
+            msg.data.current = static_cast<int16_t>(readU16(payload + 16)) / 100.0;
+            msg.data.remaining = static_cast<int8_t>(payload[30]);
+            break;
+        case MSG_ATTITUDE:
+            msg.type = MessageType::ATTITUDE;
+            msg.sender_time_ms = readU32(payload);
+            msg.data.roll = readFloat(payload + 4) * RAD_TO_DEG;
+            msg.data.pitch = readFloat(payload + 8) * RAD_TO_DEG;
+            msg.data.yaw = readFloat(payload + 12) * RAD_TO_DEG;
+            break;
+        case MSG_GLOBAL_POSITION_INT:
+            msg.type = MessageType::GPS;
+            msg.sender_time_ms = readU32(payload);
+            msg.data.lat = readI32(payload + 4) / 1e7;
+            msg.data.lon = readI32(payload + 8) / 1e7;
+            msg.data.alt = readI32(payload + 12) / 1000.0;
+            break;
+        default:
+            return;
+    }
+
+    stats.decoded++;
+    onMessage(msg);
+}
+
+} // namespace pixhawk
@@ -0,0 +1,72 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace pixhawk {
+
+struct TelemetryMessage;
+
+// Header of a frame that passed its checksum, whether decoded or not, or
+// of a message without a checksum seed framed by its length alone
+struct FrameHeader {
+    int32_t sysid;
+    int32_t compid;
+    uint32_t seq;
+    uint32_t msgid;
+    uint32_t length;            // bytes on the wire
+};
+
+struct DecoderStats {
+    uint64_t frames = 0;        // passed the checksum
+    uint64_t decoded = 0;       // turned into telemetry messages
+    uint64_t crcErrors = 0;
+    uint64_t unknown = 0;       // frames of ids it has no checksum seed for
+    uint64_t droppedBytes = 0;  // skipped while looking for a frame start
+};
+
+// Incremental MAVLink 1/2 frame decoder for one link. Frames are parsed in
+// place in the caller's buffer; only a frame split across two reads is
+// carried over, in a small fixed buffer. HEARTBEAT, SYS_STATUS, ATTITUDE
+// and GLOBAL_POSITION_INT become TelemetryMessages stamped with the arrival
+// time, the latter two also with the vehicle's time_boot_ms as sender time.
+// Other common and ArduPilot messages are checksummed and skipped; other
+// ids are skipped by their length when the next frame start follows.
+// Vehicle state is taken only from the component whose heartbeat names an
+// autopilot. Signatures are not checked.
+class MavlinkDecoder {
+public:
+    static constexpr size_t MAX_FRAME_BYTES = 280;   // MAVLink 2 with signature
+
+    using FrameHandler = std::function<void(const FrameHeader&)>;
+    using MessageHandler = std::function<void(const TelemetryMessage&)>;
+
+    explicit MavlinkDecoder(int32_t linkId);
+
+    // onFrame runs for every frame, then onMessage for those decoded
+    void feed(const uint8_t* data, size_t size, int64_t nowMs,
+              const FrameHandler& onFrame, const MessageHandler& onMessage);
+
+    const DecoderStats& getStats() const { return stats; }
+
+private:
+    enum class Parse {
+        NEED_MORE,
+        BAD,
+        FRAME
+    };
+
+    int32_t linkId;
+    uint8_t carry[MAX_FRAME_BYTES + 1];     // a frame and the byte after it
+    size_t carrySize = 0;
+    uint8_t autopilotCompid[256] = {};      // per sysid, 0 until its heartbeat
+    DecoderStats stats;
+
+    // FRAME sets 'length' to the frame's size, NEED_MORE to the bytes
+    // needed before it can tell, one past the frame for an unknown id
+    Parse parse(const uint8_t* data, size_t size, size_t& length);
+    void decode(const uint8_t* frame, size_t length, int64_t nowMs,
+                const FrameHandler& onFrame, const MessageHandler& onMessage);
+};
+
+} // namespace pixhawk
@@ -15,15 +15,37 @@
 
 namespace pixhawk {
 
+namespace {
+
+// MAVLink 2 frame sizes of the messages the simulator stands in for: 12
+// bytes of framing plus HEARTBEAT, ATTITUDE, GLOBAL_POSITION_INT and
+// SYS_STATUS payloads
+constexpr uint32_t HEARTBEAT_FRAME_BYTES = 21;
+constexpr uint32_t ATTITUDE_FRAME_BYTES = 40;
+constexpr uint32_t GPS_FRAME_BYTES = 40;
+constexpr uint32_t BATTERY_FRAME_BYTES = 43;
+
+// The highest MAVLink system id, which no vehicle should use
+constexpr int32_t SIM_SYSID = 255;
+
+} // namespace
+
 TelemetryMessage::TelemetryMessage() {
     type = MessageType::HEARTBEAT;
     timestamp_ms = 0;
+    sender_time_ms = -1;
     seq = 0;
+    sysid = 1;
+    compid = 1;
+    linkId = 0;
+    length = 0;
     memset(&data, 0, sizeof(data));
     strcpy(data.mode, "MANUAL");
 }
 
-TelemetryEngine::TelemetryEngine() {
+TelemetryEngine::TelemetryEngine()
+    : reactor([this](int32_t linkId, const uint8_t* data, size_t size) { ingestBytes(linkId, data, size); },
+              [this]() { checkAlertTimers(); }, TICK_INTERVAL_MS) {
     LOGI("TelemetryEngine constructor");
     
     // Initialize ring buffer
@@ -82,6 +104,9 @@ std::vector<TelemetryMessage> TelemetryEngine::getBatch(int maxCount) {
         return batch;
     }
     
+    // The simulator and the reactor thread write concurrently
+    std::lock_guard<std::mutex> lock(ringMutex);
+    
     int currentWrite = writeIndex.load();
     int currentRead = readIndex.load();
     
@@ -96,9 +121,10 @@ std::vector<TelemetryMessage> TelemetryEngine::getBatch(int maxCount) {
     int count = std::min(available, maxCount);
     batch.reserve(count);
     
-    // Read from ring buffer (oldest first)
+    // Read the newest messages from the ring buffer (oldest first)
+    int first = (currentWrite - count + RING_BUFFER_SIZE) % RING_BUFFER_SIZE;
     for (int i = 0; i < count; i++) {
-        int idx = (currentRead + i) % RING_BUFFER_SIZE;
+        int idx = (first + i) % RING_BUFFER_SIZE;
         batch.push_back(ringBuffer[idx]);
     }
     
@@ -150,7 +176,11 @@ void TelemetryEngine::workerLoop() {
     LOGI("Worker thread started");
     
     while (running.load()) {
-        pushSimulatedTick();
+        // Real links take over from the simulator while any is open
+        if (reactor.getLinkCount() == 0) {
+            pushSimulatedTick();
+        }
+        checkAlertTimers();
         
         std::this_thread::sleep_for(std::chrono::milliseconds(TICK_INTERVAL_MS));
     }
@@ -184,19 +214,199 @@ void TelemetryEngine::pushSimulatedTick() {
         msg = createAttitude();
     }
     
-    // Store in ring buffer
-    int writeIdx = writeIndex.load();
-    ringBuffer[writeIdx] = msg;
-    writeIndex.store((writeIdx + 1) % RING_BUFFER_SIZE);
+    msg.sysid = SIM_SYSID;
     
-    // Update read index if we're overwriting
-    int readIdx = readIndex.load();
-    if (writeIdx == readIdx) {
-        readIndex.store((readIdx + 1) % RING_BUFFER_SIZE);
+    // The simulator stands in for the framing layer too
+    const int64_t arrivalUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    linkQuality.recordFrame(msg.linkId, msg.sysid, msg.compid, static_cast<uint32_t>(msg.seq), arrivalUs, msg.length);
+    ingest(msg);
+}
+
+void TelemetryEngine::ingest(const TelemetryMessage& msg) {
+    {
+        std::lock_guard<std::mutex> lock(ringMutex);
+        
+        // Store in ring buffer
+        int writeIdx = writeIndex.load();
+        ringBuffer[writeIdx] = msg;
+        int nextWrite = (writeIdx + 1) % RING_BUFFER_SIZE;
+        writeIndex.store(nextWrite);
+        
+        // Drop the oldest message once the buffer is full
+        int readIdx = readIndex.load();
+        if (nextWrite == readIdx) {
+            readIndex.store((readIdx + 1) % RING_BUFFER_SIZE);
+        }
     }
     
+    updateLatest(msg);
+    
     // Update statistics
     updateStats(msg);
+    
+    const int64_t arrivalUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    linkQuality.recordMessage(msg.linkId, msg.sysid, msg.compid, static_cast<size_t>(msg.type),
+                              msg.sender_time_ms, arrivalUs);
+    
+    // No allocation unless an alert was raised or cleared
+    std::vector<AlertEvent> events;
+    if (alerts.evaluate(msg, arrivalUs / 1000, events) > 0) {
+        queueAlertEvents(events);
+    }
+    
+    if (msg.type == MessageType::GPS) {
+        checkGeofences(msg);
+    }
+}
+
+std::vector<GeofenceEvent> TelemetryEngine::getGeofenceEvents(int maxCount) {
+    std::lock_guard<std::mutex> lock(geofenceMutex);
+    size_t count = std::min(geofenceEvents.size(), static_cast<size_t>(std::max(maxCount, 0)));
+    std::vector<GeofenceEvent> events(geofenceEvents.begin(), geofenceEvents.begin() + count);
+    geofenceEvents.erase(geofenceEvents.begin(), geofenceEvents.begin() + count);
+    return events;
+}
+
+void TelemetryEngine::checkGeofences(const TelemetryMessage& msg) {
+    // No allocation unless a fence was crossed
+    std::vector<GeofenceEvent> events;
+    if (geofence.update(msg.sysid, msg.timestamp_ms, msg.data.lat, msg.data.lon, msg.data.alt, events) == 0) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(geofenceMutex);
+    for (const GeofenceEvent& event : events) {
+        if (geofenceEvents.size() == MAX_GEOFENCE_EVENTS) {
+            geofenceEvents.pop_front();
+        }
+        geofenceEvents.push_back(event);
+    }
+}
+
+std::vector<AlertEvent> TelemetryEngine::getAlertEvents(int maxCount) {
+    std::lock_guard<std::mutex> lock(alertMutex);
+    size_t count = std::min(alertEvents.size(), static_cast<size_t>(std::max(maxCount, 0)));
+    std::vector<AlertEvent> events(alertEvents.begin(), alertEvents.begin() + count);
+    alertEvents.erase(alertEvents.begin(), alertEvents.begin() + count);
+    return events;
+}
+
+void TelemetryEngine::checkAlertTimers() {
+    std::vector<AlertEvent> events;
+    const int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    if (alerts.evaluateTimers(nowMs, events) > 0) {
+        queueAlertEvents(events);
+    }
+}
+
+void TelemetryEngine::queueAlertEvents(const std::vector<AlertEvent>& events) {
+    std::lock_guard<std::mutex> lock(alertMutex);
+    for (const AlertEvent& event : events) {
+        if (alertEvents.size() == MAX_ALERT_EVENTS) {
+            alertEvents.pop_front();
+        }
+        alertEvents.push_back(event);
+    }
+}
+
+int32_t TelemetryEngine::openLink(const std::string& uri, std::string& error) {
+    if (!reactor.start()) {
+        error = "Failed to start link reactor";
+        return 0;
+    }
+    return reactor.open(uri, error);
+}
+
+bool TelemetryEngine::closeLink(int32_t linkId) {
+    // The reactor no longer calls ingestBytes for the link once this returns
+    if (!reactor.close(linkId)) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(decoderMutex);
+        decoders.erase(linkId);
+    }
+    linkQuality.removeLink(linkId);
+    return true;
+}
+
+bool TelemetryEngine::getDecoderStats(int32_t linkId, DecoderStats& stats) const {
+    std::lock_guard<std::mutex> lock(decoderMutex);
+    auto it = decoders.find(linkId);
+    if (it == decoders.end()) {
+        return false;
+    }
+    stats = it->second->getStats();
+    return true;
+}
+
+void TelemetryEngine::ingestBytes(int32_t linkId, const uint8_t* data, size_t size) {
+    const int64_t arrivalUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    
+    std::lock_guard<std::mutex> lock(decoderMutex);
+    auto it = decoders.find(linkId);
+    if (it == decoders.end()) {
+        // MAVLink sequence numbers are 8 bits wide
+        linkQuality.setSequenceBits(linkId, 8);
+        it = decoders.emplace(linkId, std::make_unique<MavlinkDecoder>(linkId)).first;
+    }
+    it->second->feed(data, size, arrivalUs / 1000,
+                     [this, linkId, arrivalUs](const FrameHeader& frame) {
+                         linkQuality.recordFrame(linkId, frame.sysid, frame.compid, frame.seq, arrivalUs, frame.length);
+                     },
+                     [this](const TelemetryMessage& msg) { ingest(msg); });
+}
+
+bool TelemetryEngine::getLatest(int32_t sysid, MessageType type, TelemetryMessage& msg) const {
+    const auto index = static_cast<size_t>(type);
+    const LatestValues* vehicle = findVehicle(sysid);
+    if (!vehicle || index >= MESSAGE_TYPE_COUNT) {
+        return false;
+    }
+    
+    // The seqlock's first store is its default value in the constructor
+    const SeqLock<TelemetryMessage>& slot = vehicle->messages[index];
+    if (slot.version() < 2) {
+        return false;
+    }
+    msg = slot.load();
+    return true;
+}
+
+const TelemetryEngine::LatestValues* TelemetryEngine::findVehicle(int32_t sysid) const {
+    for (const LatestValues& vehicle : latest) {
+        const int32_t id = vehicle.sysid.load(std::memory_order_acquire);
+        if (id == sysid) return &vehicle;
+        if (id == NO_VEHICLE) break;    // slots are claimed in order
+    }
+    return nullptr;
+}
+
+void TelemetryEngine::updateLatest(const TelemetryMessage& msg) {
+    const auto index = static_cast<size_t>(msg.type);
+    if (index >= MESSAGE_TYPE_COUNT || msg.sysid == NO_VEHICLE) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(latestWriteMutex);
+    for (LatestValues& vehicle : latest) {
+        const int32_t id = vehicle.sysid.load(std::memory_order_relaxed);
+        if (id == NO_VEHICLE) {
+            // Publish the slot only once it holds this message
+            vehicle.messages[index].store(msg);
+            vehicle.sysid.store(msg.sysid, std::memory_order_release);
+            return;
+        }
+        if (id == msg.sysid) {
+            vehicle.messages[index].store(msg);
+            return;
+        }
+    }
+    // More vehicles than slots: the newcomers are not tracked
 }
 
 void TelemetryEngine::updateStats(const TelemetryMessage& msg) {
@@ -240,6 +450,7 @@ TelemetryMessage TelemetryEngine::createHeartbeat() {
     
     TelemetryMessage msg;
     msg.type = MessageType::HEARTBEAT;
+    msg.length = HEARTBEAT_FRAME_BYTES;
     msg.timestamp_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::steady_clock::now().time_since_epoch()).count();
     msg.seq = messageSeq.fetch_add(1);
@@ -266,6 +477,7 @@ TelemetryMessage TelemetryEngine::createAttitude() {
     
     TelemetryMessage msg;
     msg.type = MessageType::ATTITUDE;
+    msg.length = ATTITUDE_FRAME_BYTES;
     msg.timestamp_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::steady_clock::now().time_since_epoch()).count();
     msg.seq = messageSeq.fetch_add(1);
@@ -286,6 +498,7 @@ TelemetryMessage TelemetryEngine::createGps() {
     
     TelemetryMessage msg;
     msg.type = MessageType::GPS;
+    msg.length = GPS_FRAME_BYTES;
     msg.timestamp_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::steady_clock::now().time_since_epoch()).count();
     msg.seq = messageSeq.fetch_add(1);
@@ -309,6 +522,7 @@ TelemetryMessage TelemetryEngine::createBattery() {
     
     TelemetryMessage msg;
     msg.type = MessageType::BATTERY;
+    msg.length = BATTERY_FRAME_BYTES;
     msg.timestamp_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::steady_clock::now().time_since_epoch()).count();
     msg.seq = messageSeq.fetch_add(1);
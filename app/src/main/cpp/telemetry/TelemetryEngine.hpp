@@ -1,11 +1,20 @@
 #pragma once
 
 #include <vector>
+#include <deque>
 #include <string>
 #include <thread>
 #include <atomic>
 #include <mutex>
 #include <chrono>
+#include <memory>
+#include <unordered_map>
+#include "AlertEngine.hpp"
+#include "Geofence.hpp"
+#include "LinkQuality.hpp"
+#include "LinkReactor.hpp"
+#include "MavlinkDecoder.hpp"
+#include "SeqLock.hpp"
 
 namespace pixhawk {
 
@@ -19,7 +28,12 @@ enum class MessageType : int {
 struct TelemetryMessage {
     MessageType type;
     int64_t timestamp_ms;
+    int64_t sender_time_ms;             // sender's own clock, e.g. MAVLink time_boot_ms; -1 if none
     int32_t seq;
+    int32_t sysid;                      // MAVLink system id of the sending vehicle; 255 for the simulator
+    int32_t compid;                     // component within it; 1 is the autopilot
+    int32_t linkId;                     // link it arrived on; 0 for the simulator
+    uint32_t length;                    // bytes on the wire, 0 if unknown
     
     // Union-like data fields - interpretation depends on type
     struct {
@@ -53,18 +67,66 @@ public:
     bool isRunning() const;
     
     // Data access methods  
+    // Newest messages, up to maxCount, oldest first; nothing is consumed
     std::vector<TelemetryMessage> getBatch(int maxCount);
     TelemetryStats getStats();
     
+    // Stores a message and runs everything that reacts to it: the latest
+    // values, statistics, link quality, alert rules, and fence checks on
+    // GPS fixes. Its frame goes to LinkQuality::recordFrame first, so
+    // sequence numbers of frames not decoded are counted as well.
+    void ingest(const TelemetryMessage& msg);
+    
+    // Fences checked on every GPS fix; enter/leave events queue up until
+    // taken, oldest first
+    Geofence& getGeofence() { return geofence; }
+    std::vector<GeofenceEvent> getGeofenceEvents(int maxCount);
+    
+    // Rules run on the messages they read, and on every tick for durations
+    // and message ages; raised/cleared events queue up until taken
+    AlertEngine& getAlerts() { return alerts; }
+    std::vector<AlertEvent> getAlertEvents(int maxCount);
+    
+    // Sequence loss, jitter, rates and throughput per link and sender
+    LinkQuality& getLinkQuality() { return linkQuality; }
+    
+    // Real links served by the reactor thread; MAVLink arriving on them is
+    // decoded and ingested. The simulator pauses from the first openLink
+    // until closeLink has removed every link. Returns the link id, or 0 with
+    // 'error' set; see LinkReactor::open for the URI forms.
+    int32_t openLink(const std::string& uri, std::string& error);
+    bool closeLink(int32_t linkId);
+    std::vector<LinkInfo> getLinks() const { return reactor.getLinks(); }
+    bool getDecoderStats(int32_t linkId, DecoderStats& stats) const;
+    
+    // Newest message of a type from a vehicle; false if none arrived yet.
+    // Lock-free and allocation-free, for readers polling at display rate.
+    bool getLatest(int32_t sysid, MessageType type, TelemetryMessage& msg) const;
+    
 private:
     static constexpr int RING_BUFFER_SIZE = 10000;
     static constexpr int STATS_WINDOW_MS = 5000;
     static constexpr int TICK_INTERVAL_MS = 100; // 10 Hz
+    static constexpr size_t MAX_GEOFENCE_EVENTS = 1000;
+    static constexpr size_t MAX_ALERT_EVENTS = 1000;
+    static constexpr size_t MAX_VEHICLES = 16;
+    static constexpr size_t MESSAGE_TYPE_COUNT = 4;
+    static constexpr int32_t NO_VEHICLE = -1;
+    
+    // Latest value of each message type for one vehicle. A slot is claimed
+    // by the first message of its sysid and kept for the engine's lifetime.
+    struct LatestValues {
+        std::atomic<int32_t> sysid{NO_VEHICLE};
+        SeqLock<TelemetryMessage> messages[MESSAGE_TYPE_COUNT];
+    };
     
-    // Ring buffer for messages
+    // Ring buffer for messages; the simulator and the reactor thread both
+    // write to it and getBatch reads it, all under ringMutex. readIndex is
+    // the oldest message kept.
     TelemetryMessage ringBuffer[RING_BUFFER_SIZE];
     std::atomic<int> writeIndex{0};
     std::atomic<int> readIndex{0};
+    std::mutex ringMutex;
     
     // Thread control
     std::atomic<bool> running{false};
@@ -79,15 +141,45 @@ private:
     // Sequence counter
     std::atomic<int32_t> messageSeq{0};
     
+    LinkQuality linkQuality;
+    
+    // Geofencing
+    Geofence geofence;
+    std::mutex geofenceMutex;
+    std::deque<GeofenceEvent> geofenceEvents;
+    
+    // Alert rules
+    AlertEngine alerts;
+    std::mutex alertMutex;
+    std::deque<AlertEvent> alertEvents;
+    
+    // Newest messages per vehicle; the mutex only orders concurrent ingest
+    // calls, since each seqlock takes one writer at a time
+    LatestValues latest[MAX_VEHICLES];
+    std::mutex latestWriteMutex;
+    
+    // One decoder per link, created with its first bytes
+    std::unordered_map<int32_t, std::unique_ptr<MavlinkDecoder>> decoders;
+    mutable std::mutex decoderMutex;
+    
+    // Last, so its thread stops before the state it feeds is destroyed
+    LinkReactor reactor;
+    
     // Worker thread function
     void workerLoop();
     
-    // Generate simulated telemetry
+    // Generate simulated telemetry, as system 255
     void pushSimulatedTick();
     
     // Helper methods
     void updateStats(const TelemetryMessage& msg);
     void cleanOldStats(int64_t currentTime);
+    void checkGeofences(const TelemetryMessage& msg);
+    void queueAlertEvents(const std::vector<AlertEvent>& events);
+    void checkAlertTimers();
+    void ingestBytes(int32_t linkId, const uint8_t* data, size_t size);
+    void updateLatest(const TelemetryMessage& msg);
+    const LatestValues* findVehicle(int32_t sysid) const;
     TelemetryMessage createHeartbeat();
     TelemetryMessage createAttitude(); 
     TelemetryMessage createGps();
@@ -11,16 +11,78 @@ class SystemBridge {
     }
 
     // Native method declarations
+    // Returns once telemetry is usable; models, terrain and map tiles keep
+    // loading in the background. getInitStatus() reports per-subsystem state
+    // and timings, and calls into a subsystem fail until it is ready.
     external fun initSystems(assetManager: android.content.res.AssetManager): String
+    external fun getInitStatus(): String
     external fun startTelemetry(): String
     external fun stopTelemetry(): String
     external fun getTelemetryBatch(maxCount: Int): String
     external fun getTelemetryStats(): String
+    // Newest values of one vehicle without locking or allocating, for HUD
+    // widgets polled every frame. 'out' holds at least 14 doubles:
+    // [attitude ts, yaw, pitch, roll, gps ts, lat, lon, alt,
+    //  battery ts, voltage, current, remaining, heartbeat ts, armed (0/1)].
+    // A type not received yet has ts 0 and NaN values; false if nothing
+    // arrived from the vehicle.
+    external fun getVehicleState(sysid: Int, out: DoubleArray): Boolean
+    // Fences checked on every GPS fix; the add calls return the fence id, or 0
+    external fun addGeofencePolygon(lat: DoubleArray, lon: DoubleArray, exclusion: Boolean): Int
+    external fun addGeofenceCircle(lat: Double, lon: Double, radius: Double, exclusion: Boolean): Int
+    external fun removeGeofence(id: Int): Boolean
+    external fun getGeofenceEvents(maxCount: Int): String
+    // Alert rules run natively on every message they read, e.g.
+    // addAlertRule("low battery", "battery.voltage < 10.5", "battery.voltage > 11", 5000, 2)
+    // raises after 5 s below 10.5 V and clears above 11 V. An empty clear
+    // condition clears when the condition turns false. Returns the rule id
+    // or the compile error; see AlertEngine.hpp for the syntax.
+    external fun addAlertRule(name: String, condition: String, clearCondition: String, forMs: Int, severity: Int): String
+    external fun removeAlertRule(id: Int): Boolean
+    external fun getAlertEvents(maxCount: Int): String
+    // Real MAVLink links read natively; the simulator, system 255, pauses
+    // while any is open:
+    // "udp://[address]:port" (listen), "udpout://host:port",
+    // "tcp://host:port", "tcpserver://[address]:port" or
+    // "serial:/dev/ttyACM0[:baud]". openLink returns the link id, which
+    // tags the link's messages in getTelemetryStats().
+    external fun openLink(uri: String): String
+    external fun closeLink(id: Int): Boolean
+    external fun getLinks(): String
     
     // Additional methods from existing CMakeLists.txt structure
     external fun getAttitude(): String
     external fun getPath(): String  
+    // Plans from (lat, lon, alt) to the target; the result and getPath()
+    // list waypoints as [lat, lon, alt] triples
+    external fun planPath(lat: Double, lon: Double, alt: Double, targetLat: Double, targetLon: Double, targetAlt: Double): String
+    // No-fly polygons for planning; addNoFlyZone returns the zone id, or 0
+    external fun addNoFlyZone(lat: DoubleArray, lon: DoubleArray): Int
+    external fun removeNoFlyZone(id: Int): Boolean
+    // Visiting order of mission waypoints; climbWeight is the cost of a meter
+    // of altitude change in meters flown
+    external fun optimizeRoute(lat: DoubleArray, lon: DoubleArray, alt: DoubleArray, closed: Boolean, climbWeight: Double): String
+    // model_date_valid is false once today is past the magnetic model's
+    // validity; the result is then for the model's last valid date
     external fun getDeclination(lat: Double, lon: Double): String
+    // grid is false when no geoid grid asset is installed; the separation
+    // then comes from a placeholder table and can be off by over 100 m
     external fun getGeoidSeparation(lat: Double, lon: Double): String
+
+    // Batch queries: one result per lat/lon pair, written into 'out'. The
+    // Direct variants take direct ByteBuffers in native byte order holding
+    // 'count' doubles each and avoid copying.
+    external fun getDeclinationBatch(lat: DoubleArray, lon: DoubleArray, out: DoubleArray): Boolean
+    external fun getGeoidSeparationBatch(lat: DoubleArray, lon: DoubleArray, out: DoubleArray): Boolean
+    external fun getDeclinationBatchDirect(lat: java.nio.ByteBuffer, lon: java.nio.ByteBuffer, out: java.nio.ByteBuffer, count: Int): Boolean
+    external fun getGeoidSeparationBatchDirect(lat: java.nio.ByteBuffer, lon: java.nio.ByteBuffer, out: java.nio.ByteBuffer, count: Int): Boolean
+
+    external fun setTerrainDirectory(path: String): String
+    external fun getTerrainProfile(lat0: Double, lon0: Double, lat1: Double, lon1: Double, count: Int): DoubleArray?
+    // Offline map tiles from the bundled chunks, by Web Mercator x/y at the
+    // zoom reported in getMapTileStats(); prefetch the view box while panning
+    external fun getMapTile(x: Int, y: Int): ByteArray?
+    external fun prefetchMapTiles(south: Double, west: Double, north: Double, east: Double): Int
+    external fun getMapTileStats(): String
     external fun getLogSummary(logData: String): String
 }
\ No newline at end of file
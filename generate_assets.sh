@@ -45,7 +45,8 @@ with open(filename, 'wb') as f:
         # 16-31: Timestamp-like data
         # 32-63: GPS coordinates (8 doubles)
         # 64-127: Sensor data (16 floats)
-        # 128-255: Reserved/padding
+        # 128-131: CRC32 of the whole block without these four bytes
+        # 132-255: Reserved/padding
         
         struct.pack_into('<I', header, 0, 0x50495848)  # 'PIXH' magic
         struct.pack_into('<I', header, 4, block_idx)
@@ -83,6 +84,12 @@ with open(filename, 'wb') as f:
         crc = zlib.crc32(data) & 0xffffffff
         struct.pack_into('<I', header, 12, crc)
         
+        # Block CRC32 checked by the native tile store
+        block_crc = zlib.crc32(header[:128])
+        block_crc = zlib.crc32(header[132:], block_crc)
+        block_crc = zlib.crc32(data, block_crc) & 0xffffffff
+        struct.pack_into('<I', header, 128, block_crc)
+        
         # Write header and data
         f.write(header)
         f.write(data)
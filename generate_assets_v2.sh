@@ -21,6 +21,7 @@ generate_binary_file() {
 import struct
 import os
 import random
+import zlib
 
 filename = '$filename'
 target_size = $target_size
@@ -56,7 +57,8 @@ with open(filename, 'wb') as f:
         # 16-31: Timestamp-like data
         # 32-63: GPS coordinates (8 doubles)
         # 64-127: Sensor data (16 floats)
-        # 128-255: Random padding
+        # 128-131: CRC32 of the whole block without these four bytes
+        # 132-255: Random padding
         
         struct.pack_into('<I', header, 0, 0x50495848)  # 'PIXH' magic
         struct.pack_into('<I', header, 4, block_idx)
@@ -89,6 +91,12 @@ with open(filename, 'wb') as f:
         random.seed(block_seed)
         data = bytearray(random.randint(0, 255) for _ in range(data_size))
         
+        # Block CRC32 checked by the native tile store
+        block_crc = zlib.crc32(header[:128])
+        block_crc = zlib.crc32(header[132:], block_crc)
+        block_crc = zlib.crc32(data, block_crc) & 0xffffffff
+        struct.pack_into('<I', header, 128, block_crc)
+        
         # Write header and data
         f.write(header)
         f.write(data)
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Convert a global geoid undulation grid into the int16 .pxgd asset that
+GeoidModel memory-maps.
+
+Supported inputs:
+  * NGA ASCII grids such as WW15MGH.GRD (EGM96 15'). The first line is
+    "south north west east dlat dlon", followed by the values row by row
+    from north to south.
+  * GeographicLib PGM geoid files such as egm2008-5.pgm (EGM2008 5'). These
+    are 16-bit big-endian with "# Offset" and "# Scale" header comments.
+
+Usage:
+  scripts/generate_geoid_grid.py WW15MGH.GRD
+  scripts/generate_geoid_grid.py egm2008-5.pgm -o app/src/main/assets/geoid/geoid.pxgd
+"""
+
+import argparse
+import array
+import os
+import struct
+import sys
+
+MAGIC = 0x44475850          # 'PXGD'
+VERSION = 1
+HEADER_SIZE = 64
+FLAG_WRAPS_LONGITUDE = 1
+SCALE = 0.005               # meters per count: +-163 m range, 5 mm resolution
+
+DEFAULT_OUTPUT = "app/src/main/assets/geoid/geoid.pxgd"
+
+
+def read_nga_grid(path):
+    with open(path) as f:
+        tokens = f.read().split()
+    south, north, west, east, dlat, dlon = (float(t) for t in tokens[:6])
+    if abs(dlat - dlon) > 1e-9:
+        sys.exit("only square cells are supported")
+    rows = int(round((north - south) / dlat)) + 1
+    cols = int(round((east - west) / dlon)) + 1
+    values = [float(t) for t in tokens[6:]]
+    if len(values) != rows * cols:
+        sys.exit("expected %d values, found %d" % (rows * cols, len(values)))
+    return north, west, dlat, rows, cols, values
+
+
+def read_pgm_grid(path):
+    with open(path, "rb") as f:
+        raw = f.read()
+
+    # Header: magic, comments, width height, maxval, then one whitespace byte
+    offset, scale = 0.0, 1.0
+    pos = 0
+    fields = []
+    while len(fields) < 4:
+        end = raw.index(b"\n", pos)
+        line = raw[pos:end].decode("ascii").strip()
+        pos = end + 1
+        if line.startswith("#"):
+            parts = line[1:].split()
+            if len(parts) == 2 and parts[0] == "Offset":
+                offset = float(parts[1])
+            elif len(parts) == 2 and parts[0] == "Scale":
+                scale = float(parts[1])
+            continue
+        fields.extend(line.split())
+    if fields[0] != "P5" or int(fields[3]) != 65535:
+        sys.exit("not a 16-bit binary PGM")
+
+    cols, rows = int(fields[1]), int(fields[2])
+    counts = array.array("H")
+    counts.frombytes(raw[pos:pos + rows * cols * 2])
+    if sys.byteorder == "little":
+        counts.byteswap()
+    values = [offset + scale * c for c in counts]
+    return 90.0, 0.0, 360.0 / cols, rows, cols, values
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="WW15MGH.GRD-style ASCII grid or GeographicLib .pgm")
+    parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT)
+    args = parser.parse_args()
+
+    if args.input.lower().endswith(".pgm"):
+        north, west, spacing, rows, cols, values = read_pgm_grid(args.input)
+    else:
+        north, west, spacing, rows, cols, values = read_nga_grid(args.input)
+
+    # Drop a repeated 360-degree column; the model wraps longitude itself
+    wraps = abs(cols * spacing - 360.0) < 1e-6
+    if abs((cols - 1) * spacing - 360.0) < 1e-6:
+        values = [v for i, v in enumerate(values) if i % cols != cols - 1]
+        cols -= 1
+        wraps = True
+
+    samples = array.array("h")
+    for v in values:
+        count = int(round(v / SCALE))
+        if not -32768 <= count <= 32767:
+            sys.exit("value %.3f m out of int16 range" % v)
+        samples.append(count)
+    if sys.byteorder != "little":
+        samples.byteswap()
+
+    header = bytearray(HEADER_SIZE)
+    struct.pack_into("<IHHII", header, 0, MAGIC, VERSION, HEADER_SIZE, rows, cols)
+    struct.pack_into("<ddddd", header, 16, north, west, spacing, SCALE, 0.0)
+    struct.pack_into("<I", header, 56, FLAG_WRAPS_LONGITUDE if wraps else 0)
+
+    os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+    with open(args.output, "wb") as f:
+        f.write(header)
+        f.write(samples.tobytes())
+    print("%s: %d x %d at %.4f deg, %d bytes" % (args.output, rows, cols, spacing, HEADER_SIZE + len(samples) * 2))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+"""Generate the coarse global magnetic field table compiled into
+MagneticModel from the WMM coefficients in WmmCoeffs.inl.
+
+Each node holds the north and east field components on the ellipsoid at
+the model epoch and their secular variation, so the table is exact at the
+nodes for any date the model covers. Declination is taken from the
+interpolated components, which keeps it continuous across the +-180 degree
+wrap near the magnetic poles.
+
+The build runs this when Python is available; the checked-in copy under
+geospatial/data is used otherwise.
+
+Usage:
+  scripts/generate_magnetic_table.py app/src/main/cpp/geospatial/data/WmmCoeffs.inl
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+SPACING = 5.0               # degrees
+DEFAULT_OUTPUT = "app/src/main/cpp/geospatial/data/MagneticFieldTable.inl"
+
+WGS84_A = 6378.137          # km
+WGS84_F = 1.0 / 298.257223563
+WGS84_E2 = WGS84_F * (2.0 - WGS84_F)
+WMM_REFERENCE_RADIUS = 6371.2
+MIN_COS_LAT = 1e-10
+
+
+def read_coefficients(path):
+    with open(path) as f:
+        text = f.read()
+    epoch = float(re.search(r"WMM_EPOCH\s*=\s*([-\d.]+)", text).group(1))
+    max_degree = int(re.search(r"WMM_MAX_DEGREE\s*=\s*(\d+)", text).group(1))
+    rows = re.findall(r"\{\s*(\d+),\s*(\d+),\s*([-\d.]+),\s*([-\d.]+),\s*([-\d.]+),\s*([-\d.]+)\s*\}", text)
+    if not rows:
+        sys.exit("no coefficients found in %s" % path)
+    main = {}
+    rate = {}
+    for n, m, g, h, dg, dh in rows:
+        main[(int(n), int(m))] = (float(g), float(h))
+        rate[(int(n), int(m))] = (float(dg), float(dh))
+    return epoch, max_degree, main, rate
+
+
+def legendre(max_degree, s, c):
+    """Schmidt semi-normalized P(n,m) and dP/dlat, same recursion as MagneticModel."""
+    p = {(0, 0): 1.0}
+    dp = {(0, 0): 0.0}
+    for n in range(1, max_degree + 1):
+        for m in range(n):
+            denom = float(n * n - m * m)
+            a = (2.0 * n - 1.0) / math.sqrt(denom)
+            p[(n, m)] = a * s * p[(n - 1, m)]
+            dp[(n, m)] = a * (s * dp[(n - 1, m)] + c * p[(n - 1, m)])
+            if n - 2 >= m:
+                b = math.sqrt(((n - 1) * (n - 1) - m * m) / denom)
+                p[(n, m)] -= b * p[(n - 2, m)]
+                dp[(n, m)] -= b * dp[(n - 2, m)]
+        k = 1.0 if n == 1 else math.sqrt(1.0 - 1.0 / (2.0 * n))
+        p[(n, n)] = k * c * p[(n - 1, n - 1)]
+        dp[(n, n)] = k * (c * dp[(n - 1, n - 1)] - s * p[(n - 1, n - 1)])
+    return p, dp
+
+
+def north_east(max_degree, coeffs, lat, lon):
+    """Field north and east components (nT) on the ellipsoid."""
+    phi = math.radians(lat)
+    sin_phi, cos_phi = math.sin(phi), math.cos(phi)
+    rc = WGS84_A / math.sqrt(1.0 - WGS84_E2 * sin_phi * sin_phi)
+    p = rc * cos_phi
+    z = rc * (1.0 - WGS84_E2) * sin_phi
+    r = math.hypot(p, z)
+    s = z / r
+    c = max(p / r, MIN_COS_LAT)
+
+    pnm, dpnm = legendre(max_degree, s, c)
+    lam = math.radians(lon)
+    bx = by = bz = 0.0
+    ratio = WMM_REFERENCE_RADIUS / r
+    for n in range(1, max_degree + 1):
+        radial = ratio ** (n + 2)
+        for m in range(n + 1):
+            g, h = coeffs.get((n, m), (0.0, 0.0))
+            cos_m, sin_m = math.cos(m * lam), math.sin(m * lam)
+            in_phase = g * cos_m + h * sin_m
+            quadrature = g * sin_m - h * cos_m
+            bx -= radial * in_phase * dpnm[(n, m)]
+            by += radial * m * quadrature * pnm[(n, m)]
+            bz -= radial * (n + 1) * in_phase * pnm[(n, m)]
+    by /= c
+
+    cos_psi = c * cos_phi + s * sin_phi
+    sin_psi = s * cos_phi - c * sin_phi
+    return bx * cos_psi - bz * sin_psi, by
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("coefficients", help="WmmCoeffs.inl")
+    parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT)
+    args = parser.parse_args()
+
+    epoch, max_degree, main_coeffs, rate_coeffs = read_coefficients(args.coefficients)
+    rows = int(round(180.0 / SPACING)) + 1
+    cols = int(round(360.0 / SPACING))
+
+    lines = []
+    for row in range(rows):
+        lat = 90.0 - row * SPACING
+        for col in range(cols):
+            lon = -180.0 + col * SPACING
+            north, east = north_east(max_degree, main_coeffs, lat, lon)
+            d_north, d_east = north_east(max_degree, rate_coeffs, lat, lon)
+            lines.append("    {%.1ff, %.1ff, %.2ff, %.2ff}," % (north, east, d_north, d_east))
+
+    os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+    with open(args.output, "w") as f:
+        f.write("// Coarse global magnetic field table, generated by\n")
+        f.write("// scripts/generate_magnetic_table.py from WmmCoeffs.inl. Do not edit.\n")
+        f.write("// Rows run north to south from 90 degrees, columns east from -180 degrees.\n")
+        f.write("namespace pixhawk {\nnamespace data {\n\n")
+        f.write("const double MAG_TABLE_EPOCH = %.1f;\n" % epoch)
+        f.write("const double MAG_TABLE_SPACING = %.1f;\n" % SPACING)
+        f.write("const int MAG_TABLE_ROWS = %d;\n" % rows)
+        f.write("const int MAG_TABLE_COLS = %d;\n\n" % cols)
+        f.write("const float MAG_TABLE[][4] = {\n")
+        f.write("    // north, east (nT), d_north, d_east (nT/year)\n")
+        f.write("\n".join(lines))
+        f.write("\n};\n\n} // namespace data\n} // namespace pixhawk\n")
+    print("%s: %d x %d at %.1f deg" % (args.output, rows, cols, SPACING))
+
+
+if __name__ == "__main__":
+    main()
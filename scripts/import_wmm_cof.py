@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Convert a World Magnetic Model coefficient file (WMM.COF, as published
+by NOAA NCEI) into the WmmCoeffs.inl compiled into MagneticModel.
+
+The COF header line gives the epoch and model name; each model is valid
+for five years from its epoch. With --test-values, the declination and
+the north and east components at zero height are checked against NOAA's
+test value file for the model (columns: date, height in km, latitude,
+longitude, X, Y, Z, H, F, I, D, ...).
+
+Regenerate the magnetic table afterwards (see generate_magnetic_table.py).
+
+Usage:
+  scripts/import_wmm_cof.py WMM.COF [--test-values WMM2025_TEST_VALUES.txt]
+"""
+
+import argparse
+import math
+import os
+import sys
+
+from generate_magnetic_table import north_east
+
+DEFAULT_OUTPUT = "app/src/main/cpp/geospatial/data/WmmCoeffs.inl"
+VALIDITY_YEARS = 5.0
+
+# Test values are printed to 0.1 nT and 0.01 degrees
+COMPONENT_TOLERANCE = 0.15      # nT
+DECLINATION_TOLERANCE = 0.015   # degrees
+
+
+def read_cof(path):
+    with open(path) as f:
+        lines = [line.split() for line in f if line.strip()]
+    if not lines or len(lines[0]) < 2:
+        sys.exit("%s: missing header line" % path)
+    epoch = float(lines[0][0])
+    name = lines[0][1].replace("-", "")
+    rows = []
+    for fields in lines[1:]:
+        if fields[0].startswith("9999"):
+            break
+        n, m = int(fields[0]), int(fields[1])
+        # Adding 0.0 turns the COF's -0.0 rates into 0.0
+        rows.append((n, m) + tuple(float(v) + 0.0 for v in fields[2:6]))
+    if not rows:
+        sys.exit("%s: no coefficients" % path)
+    return epoch, name, rows
+
+
+def check_test_values(path, epoch, max_degree, rows):
+    main = {(n, m): (g, h) for n, m, g, h, _, _ in rows}
+    rate = {(n, m): (dg, dh) for n, m, _, _, dg, dh in rows}
+    checked = failed = 0
+    with open(path) as f:
+        for line in f:
+            fields = line.split()
+            if len(fields) < 11 or line.lstrip().startswith("#"):
+                continue
+            date, height, lat, lon = (float(v) for v in fields[:4])
+            if height != 0.0:
+                continue
+            x, y, d = float(fields[4]), float(fields[5]), float(fields[10])
+            north, east = north_east(max_degree, main, lat, lon)
+            d_north, d_east = north_east(max_degree, rate, lat, lon)
+            north += (date - epoch) * d_north
+            east += (date - epoch) * d_east
+            declination = math.degrees(math.atan2(east, north))
+            checked += 1
+            if (abs(north - x) > COMPONENT_TOLERANCE or abs(east - y) > COMPONENT_TOLERANCE or
+                    abs(declination - d) > DECLINATION_TOLERANCE):
+                failed += 1
+                print("%.1f %g %g: X %.1f/%.1f Y %.1f/%.1f D %.2f/%.2f" %
+                      (date, lat, lon, north, x, east, y, declination, d))
+    if checked == 0:
+        sys.exit("%s: no zero-height test values" % path)
+    print("%d of %d test values match" % (checked - failed, checked))
+    return failed == 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("cof", help="WMM.COF")
+    parser.add_argument("--test-values", help="NOAA test value file for the same model")
+    parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT)
+    args = parser.parse_args()
+
+    epoch, name, rows = read_cof(args.cof)
+    max_degree = max(n for n, *_ in rows)
+    if args.test_values and not check_test_values(args.test_values, epoch, max_degree, rows):
+        sys.exit("test values do not match; %s not written" % args.output)
+
+    os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+    with open(args.output, "w") as f:
+        f.write("// World Magnetic Model coefficients\n")
+        f.write("// %s main field and secular variation (NOAA NCEI / BGS), epoch %.1f,\n" % (name, epoch))
+        f.write("// valid %.1f - %.1f. Schmidt semi-normalized, nT and nT/year.\n" % (epoch, epoch + VALIDITY_YEARS))
+        f.write("namespace pixhawk {\nnamespace data {\n\n")
+        f.write("const double WMM_EPOCH = %.1f;\n" % epoch)
+        f.write("const double WMM_VALID_UNTIL = %.1f;\n" % (epoch + VALIDITY_YEARS))
+        f.write("const int WMM_MAX_DEGREE = %d;\n\n" % max_degree)
+        f.write("const double WMM_COEFFS[][6] = {\n")
+        f.write("    // n, m, g_nm, h_nm, dg_dt, dh_dt\n")
+        for n, m, g, h, dg, dh in rows:
+            f.write("    {%d, %d, %.1f, %.1f, %.1f, %.1f},\n" % (n, m, g, h, dg, dh))
+        f.write("};\n\n")
+        f.write("const int WMM_COEFFS_COUNT = sizeof(WMM_COEFFS) / sizeof(WMM_COEFFS[0]);\n\n")
+        f.write("} // namespace data\n} // namespace pixhawk\n")
+    print("%s: %s, %d coefficients, valid %.1f - %.1f" %
+          (args.output, name, len(rows), epoch, epoch + VALIDITY_YEARS))
+
+
+if __name__ == "__main__":
+    main()